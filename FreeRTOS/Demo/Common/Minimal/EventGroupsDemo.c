@@ -268,7 +268,7 @@ EventBits_t uxSynchronisationBit, uxReturned;
 
 	/* The bit to use to indicate this task is at the synchronisation point is
 	passed in as the task parameter. */
-	uxSynchronisationBit = ( EventBits_t ) pvParameters;
+	uxSynchronisationBit = ( EventBits_t ) ( size_t ) pvParameters;
 
 	for( ;; )
 	{
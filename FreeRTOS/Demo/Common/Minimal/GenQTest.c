@@ -707,7 +707,10 @@ static void prvTakeTwoMutexesReturnInDifferentOrder( SemaphoreHandle_t xMutex, S
 	simplification to allow FreeRTOS to be integrated with middleware that
 	attempts to hold multiple mutexes without bloating the code with complex
 	algorithms.  It is possible that the high priority mutex task will
-	execute as it shares a priority with this task. */
+	execute as it shares a priority with this task.  When transitive priority
+	inheritance is used the priority is instead recalculated from the mutexes
+	that are still held, and as no tasks are waiting for the local mutex the
+	priority is disinherited straight away. */
 	if( xSemaphoreGive( xMutex ) != pdPASS )
 	{
 		xErrorDetected = pdTRUE;
@@ -717,18 +720,36 @@ static void prvTakeTwoMutexesReturnInDifferentOrder( SemaphoreHandle_t xMutex, S
 		taskYIELD();
 	#endif
 
-	/* The guarded variable is only incremented by the medium priority task,
-	which still should not have executed as this task should remain at the
-	higher priority, ensure this is the case. */
-	if( ulGuardedVariable != 0 )
+	#if( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
 	{
-		xErrorDetected = pdTRUE;
-	}
+		/* The medium priority task has a priority above the priority to
+		which this task disinherited, so will already have executed. */
+		if( ulGuardedVariable != 1 )
+		{
+			xErrorDetected = pdTRUE;
+		}
 
-	if( uxTaskPriorityGet( NULL ) != genqMUTEX_HIGH_PRIORITY )
+		if( uxTaskPriorityGet( NULL ) != genqMUTEX_TEST_PRIORITY )
+		{
+			xErrorDetected = pdTRUE;
+		}
+	}
+	#else
 	{
-		xErrorDetected = pdTRUE;
+		/* The guarded variable is only incremented by the medium priority
+		task, which still should not have executed as this task should remain
+		at the higher priority, ensure this is the case. */
+		if( ulGuardedVariable != 0 )
+		{
+			xErrorDetected = pdTRUE;
+		}
+
+		if( uxTaskPriorityGet( NULL ) != genqMUTEX_HIGH_PRIORITY )
+		{
+			xErrorDetected = pdTRUE;
+		}
 	}
+	#endif /* configUSE_TRANSITIVE_PRIORITY_INHERITANCE */
 
 	/* Now also give back the local mutex, taking the held count back to 0.
 	This time the priority of this task should be disinherited back to the
@@ -345,11 +345,24 @@ static void prvTakeAndGiveInTheOppositeOrder( void )
 
 	/* Should still be at the priority of the slave task as this task still
 	holds one semaphore (this is a simplification in the priority inheritance
-	mechanism. */
-	if( uxTaskPriorityGet( NULL ) != intsemSLAVE_PRIORITY )
+	mechanism.  When transitive inheritance is used the priority is instead
+	recalculated from the mutexes that are still held, and no task is waiting
+	for the ISR mutex. */
+	#if( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
 	{
-		xErrorDetected = pdTRUE;
+		if( uxTaskPriorityGet( NULL ) != intsemMASTER_PRIORITY )
+		{
+			xErrorDetected = pdTRUE;
+		}
+	}
+	#else
+	{
+		if( uxTaskPriorityGet( NULL ) != intsemSLAVE_PRIORITY )
+		{
+			xErrorDetected = pdTRUE;
+		}
 	}
+	#endif
 
 	/* Give back the ISR semaphore, which should result in the priority being
 	disinherited as it was the last mutex held. */
@@ -0,0 +1,1118 @@
+/*
+ * FreeRTOS Kernel V10.1.1
+ * Copyright (C) 2018 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+
+/*
+ * Measures the execution time of the kernel primitives that are used most
+ * often, so the cost of each can be tracked as the kernel changes.  The
+ * benchmark task times configBENCHMARK_SAMPLES calls to each primitive, then
+ * outputs one line per primitive, in the following machine readable form:
+ *
+ * BENCH_BEGIN,<kernel version>
+ * BENCH,case,unit,samples,min,mean,max
+ * BENCH,<case>,<unit>,<samples>,<min>,<mean>,<max>
+ * ...
+ * BENCH_END,<PASS or FAIL>
+ *
+ * The "timestamp" case is the time taken to read the timestamp itself, which
+ * is included in the time measured for every other case.  The "tick_interrupt"
+ * case is the longest gap between consecutive timestamp reads while the
+ * benchmark task waits for the tick count to change, which is the time taken
+ * by a tick interrupt that does not cause a context switch, plus the time taken
+ * to read the tick count and the timestamp.  The two round trip
+ * cases each include two context switches - the "yield_round_trip" case yields
+ * to a task of equal priority that yields straight back, and the
+ * "notify_round_trip" case unblocks a higher priority task that blocks again
+ * immediately.  The "timer_command" case includes the time taken by the timer
+ * service task to process the command, as the timer service task has the
+ * higher priority.  The "malloc" and "free" cases are measured after the heap
+ * has been fragmented by freeing every other one of a set of small blocks, so
+ * they show how the heap implementation copes with many small free blocks.  The
+ * "task_get_handle" case looks up the name of a Blocked state task, and is only
+ * measured if INCLUDE_xTaskGetHandle is 1.  The "mutex_chain_block" case is
+ * the time the benchmark task is blocked waiting for a mutex held by a task
+ * that is itself blocked on a mutex held by a third, lower priority, task - all
+ * while a fourth task, with a priority between that of the benchmark task and
+ * the other two, is ready to run.  With transitive priority inheritance the
+ * fourth task cannot delay the benchmark task, so the time does not include the
+ * time for which the fourth task runs.  It is only measured if configUSE_MUTEXES
+ * and INCLUDE_vTaskPrioritySet are both 1.  FAIL is output if any primitive did
+ * not behave as expected, in which case the measurements cannot be trusted.
+ *
+ * The following can be defined in FreeRTOSConfig.h:
+ *
+ * configBENCHMARK_GET_TIMESTAMP() - returns a free running count in the units
+ * named by configBENCHMARK_TIMESTAMP_UNITS.  Defaults to the run time stats
+ * counter.  Use the highest resolution counter available, ideally a cycle
+ * counter.
+ *
+ * configBENCHMARK_TIMESTAMP_TYPE - the type returned by
+ * configBENCHMARK_GET_TIMESTAMP().  Elapsed times are calculated using unsigned
+ * arithmetic of this type, so a counter narrower than 32-bits can be used
+ * directly provided it cannot wrap more than once while a single call is being
+ * timed.  Defaults to uint32_t.
+ *
+ * configBENCHMARK_PRINT_STRING( pcString ) - outputs a null terminated string.
+ * By default the results are not output.
+ *
+ * configBENCHMARK_SAMPLES - the number of calls made to each primitive.
+ *
+ * The benchmark assumes configUSE_PREEMPTION is 1, that the benchmark task is
+ * created at a priority below configTIMER_TASK_PRIORITY and at least three
+ * below configMAX_PRIORITIES, and that no other application tasks are ready to
+ * run while the benchmark executes.
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "timers.h"
+#include "event_groups.h"
+#include "stream_buffer.h"
+
+/* Demo program include files. */
+#include "KernelBenchmark.h"
+
+#ifndef configBENCHMARK_GET_TIMESTAMP
+	#define configBENCHMARK_GET_TIMESTAMP()	portGET_RUN_TIME_COUNTER_VALUE()
+#endif
+
+#ifndef configBENCHMARK_TIMESTAMP_TYPE
+	#define configBENCHMARK_TIMESTAMP_TYPE	uint32_t
+#endif
+
+#ifndef configBENCHMARK_TIMESTAMP_UNITS
+	#define configBENCHMARK_TIMESTAMP_UNITS	"counts"
+#endif
+
+#ifndef configBENCHMARK_PRINT_STRING
+	#define configBENCHMARK_PRINT_STRING( pcString ) ( void ) ( pcString )
+#endif
+
+#ifndef configBENCHMARK_SAMPLES
+	#define configBENCHMARK_SAMPLES			( 64 )
+#endif
+
+/* A block time of 0 just means "don't block". */
+#define kbDONT_BLOCK				( 0 )
+
+/* The number of bytes written to, and read from, the stream buffer by each
+call. */
+#define kbSTREAM_BYTES				( 4 )
+
+/* The bit set in, and cleared from, the event group. */
+#define kbEVENT_BIT					( ( EventBits_t ) 0x01 )
+
+/* The period of the timer that is reset.  It never expires as it is reset
+much more frequently than this. */
+#define kbTIMER_PERIOD				pdMS_TO_TICKS( 1000 )
+
+/* The heap is fragmented by allocating kbHEAP_BLOCKS blocks of
+kbHEAP_SMALL_SIZE bytes, then freeing every other one.  The block allocated by
+the measured calls is too large to fit in the gaps that are left. */
+#define kbHEAP_BLOCKS				( 16 )
+#define kbHEAP_SMALL_SIZE			( 16 )
+#define kbHEAP_LARGE_SIZE			( 48 )
+
+/* The number of times the tasks in the mutex chain case loop while they hold
+a mutex, and the number of times the task that interferes with them loops each
+time it runs. */
+#define kbCHAIN_SPIN_COUNT			( 200 )
+
+/* The size of the buffer into which each line of output is formatted. */
+#define kbLINE_LENGTH				( 96 )
+
+/*-----------------------------------------------------------*/
+
+/* Each measurement is one of the following cases. */
+typedef enum
+{
+	eTimestamp = 0,
+	eTickInterrupt,
+	eQueueSend,
+	eQueueReceive,
+	eSemaphoreGive,
+	eSemaphoreTake,
+	eNotifyGive,
+	eNotifyTake,
+	eStreamBufferSend,
+	eStreamBufferReceive,
+	eEventGroupSetBits,
+	eEventGroupClearBits,
+	eTimerCommand,
+	eYieldRoundTrip,
+	eNotifyRoundTrip,
+	eMalloc,
+	eFree,
+	eTaskGetHandle,
+	eMutexChainBlock,
+	eNumberOfCases /* Must be last. */
+} BenchmarkCase_t;
+
+/* The statistics gathered for each case. */
+typedef struct BENCHMARK_RESULT
+{
+	uint32_t ulMin;
+	uint32_t ulMax;
+	uint32_t ulTotal;
+	uint32_t ulSamples;
+} BenchmarkResult_t;
+
+typedef configBENCHMARK_TIMESTAMP_TYPE BenchmarkTimestamp_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The task that performs the measurements, and the two tasks it switches to
+ * when measuring the round trip cases.
+ */
+static void prvBenchmarkTask( void *pvParameters );
+static void prvYieldPeerTask( void *pvParameters );
+static void prvNotifyPeerTask( void *pvParameters );
+
+/*
+ * The tasks that form the mutex chain measured by the mutex chain case, and
+ * the task that interferes with them.
+ */
+static void prvChainLowTask( void *pvParameters );
+static void prvChainMediumTask( void *pvParameters );
+static void prvChainInterferingTask( void *pvParameters );
+
+/*
+ * Loop kbCHAIN_SPIN_COUNT times, to represent the work done by the tasks in the
+ * mutex chain case.
+ */
+static void prvSpin( void );
+
+/*
+ * Each function times configBENCHMARK_SAMPLES calls to one set of primitives.
+ */
+static void prvTimeTimestamp( void );
+static void prvTimeTickInterrupt( void );
+static void prvTimeQueue( void );
+static void prvTimeSemaphore( void );
+static void prvTimeNotification( void );
+static void prvTimeStreamBuffer( void );
+static void prvTimeEventGroup( void );
+static void prvTimeTimerCommand( void );
+static void prvTimeYieldRoundTrip( void );
+static void prvTimeNotifyRoundTrip( void );
+static void prvTimeHeap( void );
+static void prvTimeTaskGetHandle( void );
+static void prvTimeMutexChain( void );
+
+/*
+ * Add the time between xStart and xEnd to the statistics for eCase.
+ */
+static void prvRecordSample( BenchmarkCase_t eCase, BenchmarkTimestamp_t xStart, BenchmarkTimestamp_t xEnd );
+
+/*
+ * Output the statistics gathered for every case.
+ */
+static void prvPrintResults( void );
+
+/*
+ * Write a string, or an unsigned number in decimal, to pcBuffer, returning a
+ * pointer to the terminating null.  Used in place of sprintf() as not all
+ * sprintf() implementations can print 32-bit numbers on 16-bit targets.
+ */
+static char *prvWriteString( char *pcBuffer, const char *pcString );
+static char *prvWriteUnsigned( char *pcBuffer, uint32_t ulValue );
+
+/*
+ * The callback function of the timer that is reset.  It is not expected to
+ * execute.
+ */
+static void prvTimerCallback( TimerHandle_t xExpiredTimer );
+
+/*-----------------------------------------------------------*/
+
+/* The names output for each case, in the order of BenchmarkCase_t. */
+static const char * const pcCaseNames[ eNumberOfCases ] =
+{
+	"timestamp",
+	"tick_interrupt",
+	"queue_send",
+	"queue_receive",
+	"semaphore_give",
+	"semaphore_take",
+	"notify_give",
+	"notify_take",
+	"stream_buffer_send",
+	"stream_buffer_receive",
+	"event_group_set_bits",
+	"event_group_clear_bits",
+	"timer_command",
+	"yield_round_trip",
+	"notify_round_trip",
+	"malloc",
+	"free",
+	"task_get_handle",
+	"mutex_chain_block"
+};
+
+/* The statistics gathered for each case. */
+static BenchmarkResult_t xResults[ eNumberOfCases ];
+
+/* The objects used by the measured primitives. */
+static QueueHandle_t xQueue = NULL;
+static SemaphoreHandle_t xSemaphore = NULL;
+static StreamBufferHandle_t xStreamBuffer = NULL;
+static EventGroupHandle_t xEventGroup = NULL;
+static TimerHandle_t xTimer = NULL;
+static TaskHandle_t xBenchmarkTask = NULL, xYieldPeerTask = NULL, xNotifyPeerTask = NULL;
+
+/* The tasks and mutexes used by the mutex chain case.  The low priority task
+holds the low mutex.  The medium priority task holds the high mutex while it is
+blocked on the low mutex.  The benchmark task blocks on the high mutex. */
+static TaskHandle_t xChainLowTask = NULL, xChainMediumTask = NULL, xChainInterferingTask = NULL;
+static SemaphoreHandle_t xChainLowMutex = NULL, xChainHighMutex = NULL;
+
+/* Incremented each time the interfering task runs. */
+static volatile uint32_t ulChainInterferingCycles = 0UL;
+
+/* Set to pdTRUE while the yield peer task should keep yielding back to the
+benchmark task. */
+static volatile BaseType_t xYieldPeerActive = pdFALSE;
+
+/* Incremented each time a peer task runs, so the benchmark task can check the
+round trip cases really did switch to the peer task. */
+static volatile uint32_t ulYieldPeerCycles = 0UL, ulNotifyPeerCycles = 0UL;
+
+/* Set to pdFAIL if any primitive does not behave as expected. */
+static volatile BaseType_t xErrorStatus = pdPASS;
+
+/* Set to pdTRUE when the results have been output. */
+static volatile BaseType_t xBenchmarkComplete = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+void vStartKernelBenchmarkTask( UBaseType_t uxPriority )
+{
+	/* The timer command case relies on the timer service task emptying the
+	timer command queue each time a command is sent, and the notify round trip
+	case needs a priority above that of the benchmark task. */
+	configASSERT( uxPriority < configTIMER_TASK_PRIORITY );
+	configASSERT( ( uxPriority + 1 ) < configMAX_PRIORITIES );
+
+	/* Create the objects used by the measured primitives. */
+	xQueue = xQueueCreate( 1, sizeof( uint32_t ) );
+	xSemaphore = xSemaphoreCreateBinary();
+	xStreamBuffer = xStreamBufferCreate( kbSTREAM_BYTES * 2, 1 );
+	xEventGroup = xEventGroupCreate();
+	xTimer = xTimerCreate( "Bench", kbTIMER_PERIOD, pdFALSE, NULL, prvTimerCallback );
+
+	configASSERT( xQueue );
+	configASSERT( xSemaphore );
+	configASSERT( xStreamBuffer );
+	configASSERT( xEventGroup );
+	configASSERT( xTimer );
+
+	/* Create the benchmark task, and the peer tasks it switches to. */
+	xTaskCreate( prvBenchmarkTask, "Bench", configMINIMAL_STACK_SIZE * 2, NULL, uxPriority, &xBenchmarkTask );
+	xTaskCreate( prvYieldPeerTask, "BYield", configMINIMAL_STACK_SIZE, NULL, uxPriority, &xYieldPeerTask );
+	xTaskCreate( prvNotifyPeerTask, "BNotify", configMINIMAL_STACK_SIZE, NULL, uxPriority + 1, &xNotifyPeerTask );
+
+	#if( ( configUSE_MUTEXES == 1 ) && ( INCLUDE_vTaskPrioritySet == 1 ) )
+	{
+		/* The mutex chain case raises the priority of the benchmark task above
+		the priorities of the three tasks created here. */
+		configASSERT( ( uxPriority + 3 ) < configMAX_PRIORITIES );
+
+		xChainLowMutex = xSemaphoreCreateMutex();
+		xChainHighMutex = xSemaphoreCreateMutex();
+		configASSERT( xChainLowMutex );
+		configASSERT( xChainHighMutex );
+
+		xTaskCreate( prvChainLowTask, "BChainL", configMINIMAL_STACK_SIZE, NULL, uxPriority, &xChainLowTask );
+		xTaskCreate( prvChainMediumTask, "BChainM", configMINIMAL_STACK_SIZE, NULL, uxPriority + 1, &xChainMediumTask );
+		xTaskCreate( prvChainInterferingTask, "BChainI", configMINIMAL_STACK_SIZE, NULL, uxPriority + 2, &xChainInterferingTask );
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchmarkTask( void *pvParameters )
+{
+	/* Remove compiler warning about unused parameter. */
+	( void ) pvParameters;
+
+	prvTimeTimestamp();
+	prvTimeTickInterrupt();
+	prvTimeQueue();
+	prvTimeSemaphore();
+	prvTimeNotification();
+	prvTimeStreamBuffer();
+	prvTimeEventGroup();
+	prvTimeTimerCommand();
+	prvTimeYieldRoundTrip();
+	prvTimeNotifyRoundTrip();
+	prvTimeHeap();
+	prvTimeTaskGetHandle();
+	prvTimeMutexChain();
+
+	/* The results are only output once all the measurements have been taken so
+	the output does not disturb the measurements. */
+	prvPrintResults();
+	xBenchmarkComplete = pdTRUE;
+
+	/* There is nothing more to do. */
+	for( ;; )
+	{
+		vTaskSuspend( NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvYieldPeerTask( void *pvParameters )
+{
+	/* Remove compiler warning about unused parameter. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		/* Wait for the benchmark task to start timing the yield round trip. */
+		ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+		/* Yield straight back to the benchmark task each time it yields to this
+		task. */
+		while( xYieldPeerActive != pdFALSE )
+		{
+			ulYieldPeerCycles++;
+			taskYIELD();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifyPeerTask( void *pvParameters )
+{
+	/* Remove compiler warning about unused parameter. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		/* This task has a priority above the benchmark task, so runs as soon as
+		it is notified, then immediately blocks again, returning to the
+		benchmark task. */
+		ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+		ulNotifyPeerCycles++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvChainLowTask( void *pvParameters )
+{
+	/* Remove compiler warning about unused parameter. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		/* Wait for the benchmark task to start a sample. */
+		ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+		if( xSemaphoreTake( xChainLowMutex, kbDONT_BLOCK ) != pdPASS )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		/* The medium priority task runs as soon as it is notified, and takes
+		the high mutex before blocking on the low mutex.  Then the benchmark
+		task runs as soon as it is notified, and blocks on the high mutex. */
+		xTaskNotifyGive( xChainMediumTask );
+		xTaskNotifyGive( xBenchmarkTask );
+
+		/* Both mutexes are only given back once this task has completed its
+		work. */
+		prvSpin();
+
+		if( xSemaphoreGive( xChainLowMutex ) != pdPASS )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		/* This task has the lowest priority in the chain, so by the time it
+		runs again the other tasks are waiting to be started again.  Let the
+		benchmark task know the sample is complete. */
+		xTaskNotifyGive( xBenchmarkTask );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvChainMediumTask( void *pvParameters )
+{
+	/* Remove compiler warning about unused parameter. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+		/* Take the high mutex, then block on the low mutex while still holding
+		it. */
+		if( xSemaphoreTake( xChainHighMutex, kbDONT_BLOCK ) != pdPASS )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		if( xSemaphoreTake( xChainLowMutex, portMAX_DELAY ) != pdPASS )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		prvSpin();
+
+		if( ( xSemaphoreGive( xChainLowMutex ) != pdPASS ) || ( xSemaphoreGive( xChainHighMutex ) != pdPASS ) )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvChainInterferingTask( void *pvParameters )
+{
+	/* Remove compiler warning about unused parameter. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		/* This task has a priority above the low and medium priority tasks in
+		the chain, so runs as soon as it is notified unless one of them has
+		inherited a higher priority. */
+		ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+		ulChainInterferingCycles++;
+		prvSpin();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSpin( void )
+{
+volatile uint32_t ulCount;
+
+	for( ulCount = 0UL; ulCount < kbCHAIN_SPIN_COUNT; ulCount++ )
+	{
+		/* Just use time. */
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimeTimestamp( void )
+{
+BenchmarkTimestamp_t xStart, xEnd;
+uint32_t ulSample;
+
+	for( ulSample = 0; ulSample < configBENCHMARK_SAMPLES; ulSample++ )
+	{
+		xStart = configBENCHMARK_GET_TIMESTAMP();
+		xEnd = configBENCHMARK_GET_TIMESTAMP();
+		prvRecordSample( eTimestamp, xStart, xEnd );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimeTickInterrupt( void )
+{
+BenchmarkTimestamp_t xPrevious, xNow, xGapStart, xGapEnd;
+uint32_t ulSample;
+TickType_t xTickCount;
+
+	/* Start each sample just after a tick interrupt. */
+	xTickCount = xTaskGetTickCount();
+	while( xTaskGetTickCount() == xTickCount )
+	{
+		/* Wait for the next tick. */
+	}
+
+	for( ulSample = 0; ulSample < configBENCHMARK_SAMPLES; ulSample++ )
+	{
+		/* Read the timestamp continuously until the tick count changes,
+		remembering the longest gap between consecutive reads.  No other task
+		is ready to run, so the longest gap is the one in which the next tick
+		interrupt executed. */
+		xTickCount = xTaskGetTickCount();
+		xPrevious = configBENCHMARK_GET_TIMESTAMP();
+		xGapStart = xPrevious;
+		xGapEnd = xPrevious;
+
+		do
+		{
+			xNow = configBENCHMARK_GET_TIMESTAMP();
+
+			if( ( BenchmarkTimestamp_t ) ( xNow - xPrevious ) > ( BenchmarkTimestamp_t ) ( xGapEnd - xGapStart ) )
+			{
+				xGapStart = xPrevious;
+				xGapEnd = xNow;
+			}
+
+			xPrevious = xNow;
+		} while( xTaskGetTickCount() == xTickCount );
+
+		/* The tick interrupt might have executed after the last timestamp was
+		read. */
+		xNow = configBENCHMARK_GET_TIMESTAMP();
+
+		if( ( BenchmarkTimestamp_t ) ( xNow - xPrevious ) > ( BenchmarkTimestamp_t ) ( xGapEnd - xGapStart ) )
+		{
+			xGapStart = xPrevious;
+			xGapEnd = xNow;
+		}
+
+		prvRecordSample( eTickInterrupt, xGapStart, xGapEnd );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimeQueue( void )
+{
+BenchmarkTimestamp_t xStart, xEnd;
+uint32_t ulSample, ulReceived = 0UL;
+BaseType_t xReturned;
+
+	for( ulSample = 0; ulSample < configBENCHMARK_SAMPLES; ulSample++ )
+	{
+		xStart = configBENCHMARK_GET_TIMESTAMP();
+		xReturned = xQueueSend( xQueue, &ulSample, kbDONT_BLOCK );
+		xEnd = configBENCHMARK_GET_TIMESTAMP();
+		prvRecordSample( eQueueSend, xStart, xEnd );
+
+		if( xReturned != pdPASS )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		xStart = configBENCHMARK_GET_TIMESTAMP();
+		xReturned = xQueueReceive( xQueue, &ulReceived, kbDONT_BLOCK );
+		xEnd = configBENCHMARK_GET_TIMESTAMP();
+		prvRecordSample( eQueueReceive, xStart, xEnd );
+
+		if( ( xReturned != pdPASS ) || ( ulReceived != ulSample ) )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimeSemaphore( void )
+{
+BenchmarkTimestamp_t xStart, xEnd;
+uint32_t ulSample;
+BaseType_t xReturned;
+
+	for( ulSample = 0; ulSample < configBENCHMARK_SAMPLES; ulSample++ )
+	{
+		xStart = configBENCHMARK_GET_TIMESTAMP();
+		xReturned = xSemaphoreGive( xSemaphore );
+		xEnd = configBENCHMARK_GET_TIMESTAMP();
+		prvRecordSample( eSemaphoreGive, xStart, xEnd );
+
+		if( xReturned != pdPASS )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		xStart = configBENCHMARK_GET_TIMESTAMP();
+		xReturned = xSemaphoreTake( xSemaphore, kbDONT_BLOCK );
+		xEnd = configBENCHMARK_GET_TIMESTAMP();
+		prvRecordSample( eSemaphoreTake, xStart, xEnd );
+
+		if( xReturned != pdPASS )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimeNotification( void )
+{
+BenchmarkTimestamp_t xStart, xEnd;
+uint32_t ulSample, ulValue;
+
+	for( ulSample = 0; ulSample < configBENCHMARK_SAMPLES; ulSample++ )
+	{
+		/* The task notifies itself, so the notification does not cause a
+		context switch. */
+		xStart = configBENCHMARK_GET_TIMESTAMP();
+		xTaskNotifyGive( xBenchmarkTask );
+		xEnd = configBENCHMARK_GET_TIMESTAMP();
+		prvRecordSample( eNotifyGive, xStart, xEnd );
+
+		xStart = configBENCHMARK_GET_TIMESTAMP();
+		ulValue = ulTaskNotifyTake( pdTRUE, kbDONT_BLOCK );
+		xEnd = configBENCHMARK_GET_TIMESTAMP();
+		prvRecordSample( eNotifyTake, xStart, xEnd );
+
+		if( ulValue != 1UL )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimeStreamBuffer( void )
+{
+BenchmarkTimestamp_t xStart, xEnd;
+uint32_t ulSample;
+size_t xReturned;
+uint8_t ucTxData[ kbSTREAM_BYTES ] = { 0 }, ucRxData[ kbSTREAM_BYTES ];
+
+	for( ulSample = 0; ulSample < configBENCHMARK_SAMPLES; ulSample++ )
+	{
+		ucTxData[ 0 ] = ( uint8_t ) ulSample;
+
+		xStart = configBENCHMARK_GET_TIMESTAMP();
+		xReturned = xStreamBufferSend( xStreamBuffer, ucTxData, kbSTREAM_BYTES, kbDONT_BLOCK );
+		xEnd = configBENCHMARK_GET_TIMESTAMP();
+		prvRecordSample( eStreamBufferSend, xStart, xEnd );
+
+		if( xReturned != kbSTREAM_BYTES )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		xStart = configBENCHMARK_GET_TIMESTAMP();
+		xReturned = xStreamBufferReceive( xStreamBuffer, ucRxData, kbSTREAM_BYTES, kbDONT_BLOCK );
+		xEnd = configBENCHMARK_GET_TIMESTAMP();
+		prvRecordSample( eStreamBufferReceive, xStart, xEnd );
+
+		if( ( xReturned != kbSTREAM_BYTES ) || ( memcmp( ucTxData, ucRxData, kbSTREAM_BYTES ) != 0 ) )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimeEventGroup( void )
+{
+BenchmarkTimestamp_t xStart, xEnd;
+uint32_t ulSample;
+EventBits_t xBits;
+
+	for( ulSample = 0; ulSample < configBENCHMARK_SAMPLES; ulSample++ )
+	{
+		xStart = configBENCHMARK_GET_TIMESTAMP();
+		xBits = xEventGroupSetBits( xEventGroup, kbEVENT_BIT );
+		xEnd = configBENCHMARK_GET_TIMESTAMP();
+		prvRecordSample( eEventGroupSetBits, xStart, xEnd );
+
+		if( ( xBits & kbEVENT_BIT ) == 0 )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		/* xEventGroupClearBits() returns the bits as they were before they were
+		cleared. */
+		xStart = configBENCHMARK_GET_TIMESTAMP();
+		xBits = xEventGroupClearBits( xEventGroup, kbEVENT_BIT );
+		xEnd = configBENCHMARK_GET_TIMESTAMP();
+		prvRecordSample( eEventGroupClearBits, xStart, xEnd );
+
+		if( ( xBits & kbEVENT_BIT ) == 0 )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimeTimerCommand( void )
+{
+BenchmarkTimestamp_t xStart, xEnd;
+uint32_t ulSample;
+BaseType_t xReturned;
+
+	for( ulSample = 0; ulSample < configBENCHMARK_SAMPLES; ulSample++ )
+	{
+		/* xTimerReset() sends a command to the timer service task using
+		xTimerGenericCommand(). */
+		xStart = configBENCHMARK_GET_TIMESTAMP();
+		xReturned = xTimerReset( xTimer, kbDONT_BLOCK );
+		xEnd = configBENCHMARK_GET_TIMESTAMP();
+		prvRecordSample( eTimerCommand, xStart, xEnd );
+
+		if( xReturned != pdPASS )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+
+	if( xTimerStop( xTimer, kbDONT_BLOCK ) != pdPASS )
+	{
+		xErrorStatus = pdFAIL;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimeYieldRoundTrip( void )
+{
+BenchmarkTimestamp_t xStart, xEnd;
+uint32_t ulSample, ulStartCycles;
+
+	/* Start the yield peer task, then yield to it so it enters its yield
+	loop. */
+	xYieldPeerActive = pdTRUE;
+	xTaskNotifyGive( xYieldPeerTask );
+	taskYIELD();
+	ulStartCycles = ulYieldPeerCycles;
+
+	for( ulSample = 0; ulSample < configBENCHMARK_SAMPLES; ulSample++ )
+	{
+		xStart = configBENCHMARK_GET_TIMESTAMP();
+		taskYIELD();
+		xEnd = configBENCHMARK_GET_TIMESTAMP();
+		prvRecordSample( eYieldRoundTrip, xStart, xEnd );
+	}
+
+	/* The peer task must have run.  The number of times it ran is not
+	checked as a tick interrupt can switch between the two tasks too. */
+	if( ulYieldPeerCycles == ulStartCycles )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* Yield once more so the peer task sees it should block again. */
+	xYieldPeerActive = pdFALSE;
+	taskYIELD();
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimeNotifyRoundTrip( void )
+{
+BenchmarkTimestamp_t xStart, xEnd;
+uint32_t ulSample, ulStartCycles;
+
+	ulStartCycles = ulNotifyPeerCycles;
+
+	for( ulSample = 0; ulSample < configBENCHMARK_SAMPLES; ulSample++ )
+	{
+		xStart = configBENCHMARK_GET_TIMESTAMP();
+		xTaskNotifyGive( xNotifyPeerTask );
+		xEnd = configBENCHMARK_GET_TIMESTAMP();
+		prvRecordSample( eNotifyRoundTrip, xStart, xEnd );
+	}
+
+	/* The peer task has the higher priority, so must have run once for each
+	notification. */
+	if( ( ulNotifyPeerCycles - ulStartCycles ) != configBENCHMARK_SAMPLES )
+	{
+		xErrorStatus = pdFAIL;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimeHeap( void )
+{
+BenchmarkTimestamp_t xStart, xEnd;
+uint32_t ulSample;
+BaseType_t xBlock;
+void *pvBlocks[ kbHEAP_BLOCKS ], *pvMeasured;
+
+	/* Fragment the heap. */
+	for( xBlock = 0; xBlock < kbHEAP_BLOCKS; xBlock++ )
+	{
+		pvBlocks[ xBlock ] = pvPortMalloc( kbHEAP_SMALL_SIZE );
+
+		if( pvBlocks[ xBlock ] == NULL )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+
+	for( xBlock = 0; xBlock < kbHEAP_BLOCKS; xBlock += 2 )
+	{
+		vPortFree( pvBlocks[ xBlock ] );
+		pvBlocks[ xBlock ] = NULL;
+	}
+
+	for( ulSample = 0; ulSample < configBENCHMARK_SAMPLES; ulSample++ )
+	{
+		xStart = configBENCHMARK_GET_TIMESTAMP();
+		pvMeasured = pvPortMalloc( kbHEAP_LARGE_SIZE );
+		xEnd = configBENCHMARK_GET_TIMESTAMP();
+		prvRecordSample( eMalloc, xStart, xEnd );
+
+		if( pvMeasured == NULL )
+		{
+			xErrorStatus = pdFAIL;
+		}
+		else
+		{
+			/* Write to the whole block so an overlap with another block will
+			corrupt the heap. */
+			memset( pvMeasured, ( int ) ulSample, kbHEAP_LARGE_SIZE );
+		}
+
+		xStart = configBENCHMARK_GET_TIMESTAMP();
+		vPortFree( pvMeasured );
+		xEnd = configBENCHMARK_GET_TIMESTAMP();
+		prvRecordSample( eFree, xStart, xEnd );
+	}
+
+	/* Return the heap to its original state.  vPortFree() ignores the NULL
+	entries. */
+	for( xBlock = 0; xBlock < kbHEAP_BLOCKS; xBlock++ )
+	{
+		vPortFree( pvBlocks[ xBlock ] );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimeTaskGetHandle( void )
+{
+	#if( INCLUDE_xTaskGetHandle == 1 )
+	{
+	BenchmarkTimestamp_t xStart, xEnd;
+	uint32_t ulSample;
+	TaskHandle_t xHandle;
+
+		/* The notify peer task is blocked waiting for a notification. */
+		for( ulSample = 0; ulSample < configBENCHMARK_SAMPLES; ulSample++ )
+		{
+			xStart = configBENCHMARK_GET_TIMESTAMP();
+			xHandle = xTaskGetHandle( "BNotify" );
+			xEnd = configBENCHMARK_GET_TIMESTAMP();
+			prvRecordSample( eTaskGetHandle, xStart, xEnd );
+
+			if( xHandle != xNotifyPeerTask )
+			{
+				xErrorStatus = pdFAIL;
+			}
+		}
+	}
+	#endif /* INCLUDE_xTaskGetHandle */
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimeMutexChain( void )
+{
+	#if( ( configUSE_MUTEXES == 1 ) && ( INCLUDE_vTaskPrioritySet == 1 ) )
+	{
+	BenchmarkTimestamp_t xStart, xEnd;
+	uint32_t ulSample, ulStartCycles;
+	BaseType_t xReturned;
+	const UBaseType_t uxBenchmarkPriority = uxTaskPriorityGet( NULL );
+
+		/* This task takes the part of the highest priority task in the chain,
+		above the priority of the interfering task. */
+		vTaskPrioritySet( NULL, uxBenchmarkPriority + 3 );
+
+		for( ulSample = 0; ulSample < configBENCHMARK_SAMPLES; ulSample++ )
+		{
+			/* Wait until the low priority task holds the low mutex and the
+			medium priority task holds the high mutex and is blocked on the low
+			mutex. */
+			xTaskNotifyGive( xChainLowTask );
+			ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+			ulStartCycles = ulChainInterferingCycles;
+
+			/* Make the interfering task ready to run, then block on the high
+			mutex. */
+			xStart = configBENCHMARK_GET_TIMESTAMP();
+			xTaskNotifyGive( xChainInterferingTask );
+			xReturned = xSemaphoreTake( xChainHighMutex, portMAX_DELAY );
+			xEnd = configBENCHMARK_GET_TIMESTAMP();
+			prvRecordSample( eMutexChainBlock, xStart, xEnd );
+
+			if( xReturned != pdPASS )
+			{
+				xErrorStatus = pdFAIL;
+			}
+
+			#if( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+			{
+				/* The low priority task should have inherited the priority of
+				this task through the medium priority task, so the interfering
+				task should not have run. */
+				if( ulChainInterferingCycles != ulStartCycles )
+				{
+					xErrorStatus = pdFAIL;
+				}
+			}
+			#else
+			{
+				( void ) ulStartCycles;
+			}
+			#endif
+
+			if( xSemaphoreGive( xChainHighMutex ) != pdPASS )
+			{
+				xErrorStatus = pdFAIL;
+			}
+
+			/* Wait for the low priority task to complete the sample. */
+			ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+		}
+
+		vTaskPrioritySet( NULL, uxBenchmarkPriority );
+	}
+	#endif /* ( configUSE_MUTEXES == 1 ) && ( INCLUDE_vTaskPrioritySet == 1 ) */
+}
+/*-----------------------------------------------------------*/
+
+static void prvRecordSample( BenchmarkCase_t eCase, BenchmarkTimestamp_t xStart, BenchmarkTimestamp_t xEnd )
+{
+BenchmarkResult_t *pxResult = &( xResults[ eCase ] );
+uint32_t ulElapsed;
+
+	/* The subtraction is performed using the type of the timestamp so a
+	counter that is narrower than 32-bits wraps correctly. */
+	ulElapsed = ( uint32_t ) ( BenchmarkTimestamp_t ) ( xEnd - xStart );
+
+	if( pxResult->ulSamples == 0UL )
+	{
+		pxResult->ulMin = ulElapsed;
+		pxResult->ulMax = ulElapsed;
+	}
+	else
+	{
+		if( ulElapsed < pxResult->ulMin )
+		{
+			pxResult->ulMin = ulElapsed;
+		}
+
+		if( ulElapsed > pxResult->ulMax )
+		{
+			pxResult->ulMax = ulElapsed;
+		}
+	}
+
+	pxResult->ulTotal += ulElapsed;
+	pxResult->ulSamples++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvPrintResults( void )
+{
+static char cLine[ kbLINE_LENGTH ];
+char *pcNext;
+BaseType_t xCase;
+BenchmarkResult_t *pxResult;
+
+	configBENCHMARK_PRINT_STRING( "BENCH_BEGIN," tskKERNEL_VERSION_NUMBER "\r\n" );
+	configBENCHMARK_PRINT_STRING( "BENCH,case,unit,samples,min,mean,max\r\n" );
+
+	for( xCase = 0; xCase < ( BaseType_t ) eNumberOfCases; xCase++ )
+	{
+		pxResult = &( xResults[ xCase ] );
+
+		pcNext = prvWriteString( cLine, "BENCH," );
+		pcNext = prvWriteString( pcNext, pcCaseNames[ xCase ] );
+		pcNext = prvWriteString( pcNext, "," configBENCHMARK_TIMESTAMP_UNITS "," );
+		pcNext = prvWriteUnsigned( pcNext, pxResult->ulSamples );
+		pcNext = prvWriteString( pcNext, "," );
+		pcNext = prvWriteUnsigned( pcNext, pxResult->ulMin );
+		pcNext = prvWriteString( pcNext, "," );
+		pcNext = prvWriteUnsigned( pcNext, ( pxResult->ulSamples == 0UL ) ? 0UL : ( pxResult->ulTotal / pxResult->ulSamples ) );
+		pcNext = prvWriteString( pcNext, "," );
+		pcNext = prvWriteUnsigned( pcNext, pxResult->ulMax );
+		prvWriteString( pcNext, "\r\n" );
+
+		configBENCHMARK_PRINT_STRING( cLine );
+	}
+
+	if( xErrorStatus == pdPASS )
+	{
+		configBENCHMARK_PRINT_STRING( "BENCH_END,PASS\r\n" );
+	}
+	else
+	{
+		configBENCHMARK_PRINT_STRING( "BENCH_END,FAIL\r\n" );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static char *prvWriteString( char *pcBuffer, const char *pcString )
+{
+	while( *pcString != 0x00 )
+	{
+		*pcBuffer = *pcString;
+		pcBuffer++;
+		pcString++;
+	}
+
+	*pcBuffer = 0x00;
+	return pcBuffer;
+}
+/*-----------------------------------------------------------*/
+
+static char *prvWriteUnsigned( char *pcBuffer, uint32_t ulValue )
+{
+char cDigits[ 10 ];
+BaseType_t xDigits = 0;
+
+	/* Generate the digits least significant first. */
+	do
+	{
+		cDigits[ xDigits ] = ( char ) ( '0' + ( char ) ( ulValue % 10UL ) );
+		ulValue /= 10UL;
+		xDigits++;
+	} while( ulValue != 0UL );
+
+	/* Then write them out most significant first. */
+	while( xDigits > 0 )
+	{
+		xDigits--;
+		*pcBuffer = cDigits[ xDigits ];
+		pcBuffer++;
+	}
+
+	*pcBuffer = 0x00;
+	return pcBuffer;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimerCallback( TimerHandle_t xExpiredTimer )
+{
+	/* The timer is reset more frequently than its period, then stopped, so
+	should never expire. */
+	( void ) xExpiredTimer;
+	xErrorStatus = pdFAIL;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xIsKernelBenchmarkComplete( void )
+{
+	return xBenchmarkComplete;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xGetKernelBenchmarkStatus( void )
+{
+	return xErrorStatus;
+}
+/*-----------------------------------------------------------*/
+
@@ -0,0 +1,327 @@
+/*
+ * FreeRTOS Kernel V10.1.1
+ * Copyright (C) 2018 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+
+/*
+ * Tests the xQueueSendMultiple() and xQueueReceiveMultiple() functions, and
+ * their FromISR() equivalents.
+ *
+ * A producer task sends blocks of incrementing values to a queue, the number of
+ * values in each block cycling from 1 to more than the length of the queue, so
+ * the items wrap around the end of the queue storage area and the producer has
+ * to block part way through sending a block.  A consumer task receives up to a
+ * few items at a time from the same queue and checks the values are received
+ * in order.
+ *
+ * vQueueBatchPeriodicISRDemo() is called from the tick hook and performs a
+ * similar test on a different queue using the FromISR() versions of the
+ * functions, including checking that only as many items as fit are sent and
+ * only as many items as are available are received.
+ */
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+/* Demo program include files. */
+#include "QueueBatch.h"
+
+/* The length of the queue used by the tasks.  The largest block sent is
+longer than the queue. */
+#define qbTASK_QUEUE_LENGTH		( 10 )
+#define qbMAX_TX_BLOCK			( qbTASK_QUEUE_LENGTH + 5 )
+
+/* The maximum number of items the consumer task receives at once. */
+#define qbMAX_RX_BLOCK			( 4 )
+
+/* The length of the queue used by the ISR test. */
+#define qbISR_QUEUE_LENGTH		( 5 )
+
+/* The tasks that use the queue. */
+static void prvQueueBatchProducerTask( void *pvParameters );
+static void prvQueueBatchConsumerTask( void *pvParameters );
+
+/* Called by vQueueBatchPeriodicISRDemo() to send or receive values and check
+the expected number of values were sent or received. */
+static void prvSendFromISR( size_t xItemsToSend, size_t xExpectedSent );
+static void prvReceiveFromISR( size_t xMaxItems, size_t xExpectedReceived );
+
+/* Variable that is incremented each time the consumer task receives values,
+provided no errors have been found. */
+static volatile uint32_t ulLoopCounter = 0;
+
+/* Set to pdFAIL if an error is discovered by either task. */
+static volatile BaseType_t xTaskTestStatus = pdPASS;
+
+/* Set to pdFAIL if an error is discovered by the vQueueBatchPeriodicISRDemo()
+function. */
+static volatile BaseType_t xISRTestStatus = pdPASS;
+
+/* The queue used by the tasks, and the queue used by the ISR test. */
+static QueueHandle_t xTaskQueue = NULL, xISRQueue = NULL;
+
+/* The next value to be sent to, and expected to be received from, the queue
+used by the ISR test. */
+static uint32_t ulNextISRTxValue = 0, ulNextISRRxValue = 0;
+
+/*-----------------------------------------------------------*/
+
+void vStartQueueBatchTasks( UBaseType_t uxPriority )
+{
+	xTaskQueue = xQueueCreate( qbTASK_QUEUE_LENGTH, ( UBaseType_t ) sizeof( uint16_t ) );
+	xISRQueue = xQueueCreate( qbISR_QUEUE_LENGTH, ( UBaseType_t ) sizeof( uint32_t ) );
+	configASSERT( xTaskQueue );
+	configASSERT( xISRQueue );
+
+	/* Add the queues to the registry so they can be viewed in a kernel aware
+	debugger. */
+	vQueueAddToRegistry( xTaskQueue, "Batch_Queue" );
+	vQueueAddToRegistry( xISRQueue, "Batch_ISR_Queue" );
+
+	xTaskCreate( prvQueueBatchProducerTask, "QBTx", configMINIMAL_STACK_SIZE, NULL, uxPriority, ( TaskHandle_t * ) NULL );
+	xTaskCreate( prvQueueBatchConsumerTask, "QBRx", configMINIMAL_STACK_SIZE, NULL, uxPriority, ( TaskHandle_t * ) NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvQueueBatchProducerTask( void *pvParameters )
+{
+uint16_t usTxBlock[ qbMAX_TX_BLOCK ], usNextValue = 0;
+size_t xBlockLength = 1, x;
+
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		for( x = 0; x < xBlockLength; x++ )
+		{
+			usTxBlock[ x ] = usNextValue;
+			usNextValue++;
+		}
+
+		/* Send the whole block.  Blocks longer than the queue can only be sent
+		if the task blocks part way through to let the consumer task make
+		space, and the function must not return until all the values have been
+		sent. */
+		if( xQueueSendMultiple( xTaskQueue, usTxBlock, xBlockLength, portMAX_DELAY ) != xBlockLength )
+		{
+			xTaskTestStatus = pdFAIL;
+		}
+
+		/* Send a different number of values next time. */
+		xBlockLength++;
+		if( xBlockLength > qbMAX_TX_BLOCK )
+		{
+			xBlockLength = 1;
+		}
+
+		#if( configUSE_PREEMPTION == 0 )
+			taskYIELD();
+		#endif
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvQueueBatchConsumerTask( void *pvParameters )
+{
+uint16_t usRxBlock[ qbMAX_RX_BLOCK ], usExpectedValue = 0;
+size_t xReceived, x;
+
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		/* Wait for at least one value, then receive as many as are available
+		up to the size of the buffer. */
+		xReceived = xQueueReceiveMultiple( xTaskQueue, usRxBlock, qbMAX_RX_BLOCK, portMAX_DELAY );
+
+		if( ( xReceived == 0 ) || ( xReceived > qbMAX_RX_BLOCK ) )
+		{
+			xTaskTestStatus = pdFAIL;
+		}
+		else
+		{
+			/* The values must be received in the order they were sent. */
+			for( x = 0; x < xReceived; x++ )
+			{
+				if( usRxBlock[ x ] != usExpectedValue )
+				{
+					xTaskTestStatus = pdFAIL;
+				}
+
+				usExpectedValue = ( uint16_t ) ( usRxBlock[ x ] + 1U );
+			}
+		}
+
+		if( xTaskTestStatus == pdPASS )
+		{
+			/* Increment a counter to show this task is still running without
+			error. */
+			ulLoopCounter++;
+		}
+
+		#if( configUSE_PREEMPTION == 0 )
+			taskYIELD();
+		#endif
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xAreQueueBatchTasksStillRunning( void )
+{
+static uint32_t ulLastLoopCounter = 0;
+BaseType_t xReturn;
+
+	if( ( xTaskTestStatus != pdPASS ) || ( xISRTestStatus != pdPASS ) )
+	{
+		xReturn = pdFAIL;
+	}
+	else if( ulLoopCounter != ulLastLoopCounter )
+	{
+		xReturn = pdPASS;
+	}
+	else
+	{
+		/* The tasks have stalled. */
+		xReturn = pdFAIL;
+	}
+
+	ulLastLoopCounter = ulLoopCounter;
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSendFromISR( size_t xItemsToSend, size_t xExpectedSent )
+{
+uint32_t ulBuffer[ qbISR_QUEUE_LENGTH + 1 ];
+size_t x, xSent;
+
+	configASSERT( xItemsToSend <= ( qbISR_QUEUE_LENGTH + 1 ) );
+
+	for( x = 0; x < xItemsToSend; x++ )
+	{
+		ulBuffer[ x ] = ulNextISRTxValue + ( uint32_t ) x;
+	}
+
+	xSent = xQueueSendMultipleFromISR( xISRQueue, ulBuffer, xItemsToSend, NULL );
+
+	if( xSent != xExpectedSent )
+	{
+		xISRTestStatus = pdFAIL;
+	}
+
+	ulNextISRTxValue += ( uint32_t ) xSent;
+}
+/*-----------------------------------------------------------*/
+
+static void prvReceiveFromISR( size_t xMaxItems, size_t xExpectedReceived )
+{
+uint32_t ulBuffer[ qbISR_QUEUE_LENGTH + 1 ];
+size_t x, xReceived;
+
+	configASSERT( xMaxItems <= ( qbISR_QUEUE_LENGTH + 1 ) );
+
+	xReceived = xQueueReceiveMultipleFromISR( xISRQueue, ulBuffer, xMaxItems, NULL );
+
+	if( xReceived != xExpectedReceived )
+	{
+		xISRTestStatus = pdFAIL;
+	}
+
+	/* The values must be received in the order they were sent. */
+	for( x = 0; x < xReceived; x++ )
+	{
+		if( ulBuffer[ x ] != ulNextISRRxValue )
+		{
+			xISRTestStatus = pdFAIL;
+		}
+
+		ulNextISRRxValue++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vQueueBatchPeriodicISRDemo( void )
+{
+static uint32_t ulCallCount = 0;
+const uint32_t ulNumberOfSwitchCases = 5UL;
+
+	/* This function should be called from an interrupt, such as the tick hook
+	function vApplicationTickHook().  No tasks block on the queue so the last
+	parameter of the FromISR() functions is not used.  The read and write
+	positions move on by two items on each pass through the switch statement
+	so, over time, the items sent and received wrap around the end of the queue
+	storage area at every possible position. */
+
+	configASSERT( xISRQueue );
+
+	switch( ulCallCount )
+	{
+		case 0:
+			/* The queue is empty, so all three values should be sent. */
+			prvSendFromISR( 3, 3 );
+			break;
+
+		case 1:
+			/* Receive two of the three values. */
+			prvReceiveFromISR( 2, 2 );
+			break;
+
+		case 2:
+			/* The queue holds one value, so only four of the six values will
+			fit. */
+			prvSendFromISR( 6, qbISR_QUEUE_LENGTH - 1 );
+			break;
+
+		case 3:
+			/* The queue is full, so nothing can be sent. */
+			prvSendFromISR( 1, 0 );
+			break;
+
+		case 4:
+			/* Ask for more values than are available, which should empty the
+			queue. */
+			prvReceiveFromISR( qbISR_QUEUE_LENGTH + 1, qbISR_QUEUE_LENGTH );
+			break;
+
+		default:
+			break;
+	}
+
+	/* Run the next case in the switch statement above next time this function
+	is called. */
+	ulCallCount++;
+
+	if( ulCallCount >= ulNumberOfSwitchCases )
+	{
+		/* Go back to the start. */
+		ulCallCount = 0;
+	}
+}
@@ -189,7 +189,7 @@ expected. */
 static volatile uint32_t ulISRTxValue = queuesetINITIAL_ISR_TX_VALUE;
 
 /* Used by the pseudo random number generator. */
-static size_t uxNextRand = 0;
+static uint32_t ulNextRand = 0;
 
 /* The task handles are stored so their priorities can be changed. */
 TaskHandle_t xQueueSetSendingTask, xQueueSetReceivingTask;
@@ -476,7 +476,7 @@ static uint32_t ulExpectedReceivedFromTask = 0, ulExpectedReceivedFromISR = queu
 			/* The value received is at the lower limit of the expected range.
 			Don't test it and expect to receive one higher next time. */
 		}
-		else if( ( ULONG_MAX - ulReceived ) <= queuesetIGNORED_BOUNDARY )
+		else if( ( ( uint32_t ) ULONG_MAX - ulReceived ) <= ( uint32_t ) queuesetIGNORED_BOUNDARY )
 		{
 			/* The value received is at the higher limit of the expected range.
 			Don't test it and expect to wrap soon. */
@@ -763,13 +763,14 @@ uint32_t ulValueToSend = 0;
 
 static size_t prvRand( void )
 {
-	uxNextRand = ( uxNextRand * ( size_t ) 1103515245 ) + ( size_t ) 12345;
-	return ( uxNextRand / ( size_t ) 65536 ) % ( size_t ) 32768;
+	/* The state is 32 bits wide even where size_t is 16 bits. */
+	ulNextRand = ( ulNextRand * ( uint32_t ) 1103515245 ) + ( uint32_t ) 12345;
+	return ( size_t ) ( ( ulNextRand / ( uint32_t ) 65536 ) % ( uint32_t ) 32768 );
 }
 /*-----------------------------------------------------------*/
 
 static void prvSRand( size_t uxSeed )
 {
-	uxNextRand = uxSeed;
+	ulNextRand = ( uint32_t ) uxSeed;
 }
 
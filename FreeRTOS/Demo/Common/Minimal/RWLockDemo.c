@@ -0,0 +1,341 @@
+/*
+ * FreeRTOS Kernel V10.1.1
+ * Copyright (C) 2018 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+
+/*
+ * Tests the reader-writer lock.
+ *
+ * Two reader tasks repeatedly take the lock for reading and check that two
+ * variables the writer task keeps equal are equal, yielding between reading
+ * the two so the readers overlap with each other and with the writer.  The
+ * writer task holds the lock for writing for a few ticks while it updates the
+ * variables, so readers have to wait for it, and it has to wait for readers.
+ *
+ * The writer then checks priority inheritance.  While it holds the lock for
+ * writing it resumes a higher priority reader task, which blocks on the lock,
+ * so the writer should inherit the higher priority until it releases the lock.
+ * It then checks that it times out if it asks for the lock for writing while it
+ * holds the lock for reading itself, and, when configUSE_RWLOCK_STATS is 1,
+ * that the contention statistics match what the tasks did.
+ *
+ * vRWLockPeriodicISRDemo() is called from the tick hook and tries to take the
+ * lock for reading from an interrupt, checking the variables are equal when it
+ * succeeds.
+ */
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "rwlock.h"
+
+/* Demo program include files. */
+#include "RWLockDemo.h"
+
+/* The number of tasks that read the variables at the lower priority. */
+#define rwNUM_READERS				( 2 )
+
+/* The time between reads by the lower priority reader tasks. */
+#define rwREAD_PERIOD_TICKS			( ( TickType_t ) 1 )
+
+/* The time for which the writer holds the lock for writing, and the time
+between writes. */
+#define rwWRITE_HOLD_TICKS			( ( TickType_t ) 3 )
+#define rwWRITE_PERIOD_TICKS		( ( TickType_t ) 5 )
+
+/* The time for which the writer waits for the lock when it is expected to time
+out. */
+#define rwSHORT_TIMEOUT_TICKS		( ( TickType_t ) 2 )
+
+/* The tasks that use the lock. */
+static void prvReaderTask( void *pvParameters );
+static void prvHighPriorityReaderTask( void *pvParameters );
+static void prvWriterTask( void *pvParameters );
+
+/* Counters that are incremented on each loop of the tasks, provided no errors
+have been found. */
+static volatile uint32_t ulReaderCycles[ rwNUM_READERS ] = { 0 };
+static volatile uint32_t ulHighPriorityReaderCycles = 0, ulWriterCycles = 0;
+
+/* Set to pdFAIL if an error is discovered by any of the tasks or by the
+vRWLockPeriodicISRDemo() function. */
+static volatile BaseType_t xTestStatus = pdPASS;
+
+/* The lock, and the variables it protects.  The writer keeps the variables
+equal whenever it does not hold the lock. */
+static RWLockHandle_t xRWLock = NULL;
+static volatile uint32_t ulValueA = 0, ulValueB = 0;
+
+/* The higher priority reader task, which the writer resumes. */
+static TaskHandle_t xHighPriorityReader = NULL;
+
+/*-----------------------------------------------------------*/
+
+void vStartRWLockTasks( UBaseType_t uxPriority )
+{
+BaseType_t x;
+
+	xRWLock = xRWLockCreate();
+	configASSERT( xRWLock );
+
+	for( x = 0; x < rwNUM_READERS; x++ )
+	{
+		xTaskCreate( prvReaderTask, "RWRd", configMINIMAL_STACK_SIZE, ( void * ) x, uxPriority, ( TaskHandle_t * ) NULL );
+	}
+
+	xTaskCreate( prvHighPriorityReaderTask, "RWHiRd", configMINIMAL_STACK_SIZE, NULL, uxPriority + 1, &xHighPriorityReader );
+	xTaskCreate( prvWriterTask, "RWWr", configMINIMAL_STACK_SIZE, NULL, uxPriority, ( TaskHandle_t * ) NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvReaderTask( void *pvParameters )
+{
+const BaseType_t xReader = ( BaseType_t ) pvParameters;
+uint32_t ulA, ulB;
+
+	for( ;; )
+	{
+		if( xRWLockReadLock( xRWLock, portMAX_DELAY ) != pdPASS )
+		{
+			xTestStatus = pdFAIL;
+		}
+
+		/* The writer cannot change the variables while the lock is held for
+		reading, even if other tasks run between the two reads. */
+		ulA = ulValueA;
+		taskYIELD();
+		ulB = ulValueB;
+
+		if( ulA != ulB )
+		{
+			xTestStatus = pdFAIL;
+		}
+
+		if( xRWLockReadUnlock( xRWLock ) != pdPASS )
+		{
+			xTestStatus = pdFAIL;
+		}
+
+		if( xTestStatus == pdPASS )
+		{
+			ulReaderCycles[ xReader ]++;
+		}
+
+		/* Let the lower priority tasks run. */
+		vTaskDelay( rwREAD_PERIOD_TICKS );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvHighPriorityReaderTask( void *pvParameters )
+{
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		/* Wait to be resumed by the writer. */
+		vTaskSuspend( NULL );
+
+		/* The writer holds the lock for writing, so this task will block, and
+		the writer should inherit its priority. */
+		if( xRWLockReadLock( xRWLock, portMAX_DELAY ) != pdPASS )
+		{
+			xTestStatus = pdFAIL;
+		}
+
+		if( ulValueA != ulValueB )
+		{
+			xTestStatus = pdFAIL;
+		}
+
+		if( xRWLockReadUnlock( xRWLock ) != pdPASS )
+		{
+			xTestStatus = pdFAIL;
+		}
+
+		ulHighPriorityReaderCycles++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvWriterTask( void *pvParameters )
+{
+const UBaseType_t uxPriority = uxTaskPriorityGet( NULL );
+uint32_t ulLastHighPriorityReaderCycles;
+
+#if( configUSE_RWLOCK_STATS == 1 )
+	RWLockStats_t xStats;
+	uint32_t ulExpectedWriteLocks = 0, ulExpectedTimeouts = 0;
+#endif
+
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		if( xRWLockWriteLock( xRWLock, portMAX_DELAY ) != pdPASS )
+		{
+			xTestStatus = pdFAIL;
+		}
+
+		/* Make the variables unequal for a few ticks, during which the readers
+		must not be able to see them. */
+		ulValueA++;
+		vTaskDelay( rwWRITE_HOLD_TICKS );
+		ulValueB = ulValueA;
+
+		/* The higher priority reader will block on the lock, so this task
+		should inherit its priority. */
+		ulLastHighPriorityReaderCycles = ulHighPriorityReaderCycles;
+		vTaskResume( xHighPriorityReader );
+
+		if( uxTaskPriorityGet( NULL ) != ( uxPriority + 1 ) )
+		{
+			xTestStatus = pdFAIL;
+		}
+
+		/* Releasing the lock should disinherit the priority, and let the higher
+		priority reader run before this task continues. */
+		if( xRWLockWriteUnlock( xRWLock ) != pdPASS )
+		{
+			xTestStatus = pdFAIL;
+		}
+
+		if( uxTaskPriorityGet( NULL ) != uxPriority )
+		{
+			xTestStatus = pdFAIL;
+		}
+
+		if( ulHighPriorityReaderCycles == ulLastHighPriorityReaderCycles )
+		{
+			xTestStatus = pdFAIL;
+		}
+
+		/* The lock is no longer held for writing, so it cannot be released for
+		writing again. */
+		if( xRWLockWriteUnlock( xRWLock ) != pdFAIL )
+		{
+			xTestStatus = pdFAIL;
+		}
+
+		/* Asking for the lock for writing while this task holds it for reading
+		must time out, after which the lock can still be read. */
+		if( xRWLockReadLock( xRWLock, portMAX_DELAY ) != pdPASS )
+		{
+			xTestStatus = pdFAIL;
+		}
+
+		if( xRWLockWriteLock( xRWLock, rwSHORT_TIMEOUT_TICKS ) != pdFAIL )
+		{
+			xTestStatus = pdFAIL;
+		}
+
+		if( xRWLockReadUnlock( xRWLock ) != pdPASS )
+		{
+			xTestStatus = pdFAIL;
+		}
+
+		#if( configUSE_RWLOCK_STATS == 1 )
+		{
+			/* Only this task takes the lock for writing, and only this task
+			times out.  The higher priority reader always has to wait. */
+			ulExpectedWriteLocks++;
+			ulExpectedTimeouts++;
+			vRWLockGetStats( xRWLock, &xStats );
+
+			if( ( xStats.ulWriteLocks != ulExpectedWriteLocks ) || ( xStats.ulTimeouts != ulExpectedTimeouts ) || ( xStats.ulReadContentions < ulExpectedWriteLocks ) )
+			{
+				xTestStatus = pdFAIL;
+			}
+		}
+		#endif /* configUSE_RWLOCK_STATS */
+
+		if( xTestStatus == pdPASS )
+		{
+			ulWriterCycles++;
+		}
+
+		vTaskDelay( rwWRITE_PERIOD_TICKS );
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xAreRWLockTasksStillRunning( void )
+{
+static uint32_t ulLastReaderCycles[ rwNUM_READERS ] = { 0 };
+static uint32_t ulLastWriterCycles = 0;
+BaseType_t xReturn = pdPASS, x;
+
+	if( xTestStatus != pdPASS )
+	{
+		xReturn = pdFAIL;
+	}
+
+	for( x = 0; x < rwNUM_READERS; x++ )
+	{
+		if( ulReaderCycles[ x ] == ulLastReaderCycles[ x ] )
+		{
+			/* The reader has stalled. */
+			xReturn = pdFAIL;
+		}
+
+		ulLastReaderCycles[ x ] = ulReaderCycles[ x ];
+	}
+
+	if( ulWriterCycles == ulLastWriterCycles )
+	{
+		/* The writer has stalled. */
+		xReturn = pdFAIL;
+	}
+
+	ulLastWriterCycles = ulWriterCycles;
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vRWLockPeriodicISRDemo( void )
+{
+	/* This function should be called from an interrupt, such as the tick hook
+	function vApplicationTickHook().  It can only read the variables when no
+	task holds, or is waiting for, the lock for writing. */
+	if( xRWLock != NULL )
+	{
+		if( xRWLockTryReadLockFromISR( xRWLock ) == pdPASS )
+		{
+			if( ulValueA != ulValueB )
+			{
+				xTestStatus = pdFAIL;
+			}
+
+			if( xRWLockReadUnlockFromISR( xRWLock, NULL ) != pdPASS )
+			{
+				xTestStatus = pdFAIL;
+			}
+		}
+	}
+}
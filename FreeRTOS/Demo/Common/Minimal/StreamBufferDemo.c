@@ -78,6 +78,13 @@ test.  The stack size is over generous in most cases. */
  */
 static void prvSingleTaskTests( StreamBufferHandle_t xStreamBuffer );
 
+/*
+ * Called by prvSingleTaskTests() to test writing data to, and reading data
+ * from, a stream buffer in place using the zero copy acquire and commit
+ * functions.  The stream buffer must be empty when the function is called.
+ */
+static void prvZeroCopyTests( StreamBufferHandle_t xStreamBuffer );
+
 /*
  * Tests sending and receiving various lengths of data via a stream buffer.
  * The echo client sends the data to the echo server, which then sends the
@@ -442,6 +449,9 @@ UBaseType_t uxOriginalPriority;
 	prvCheckExpectedState( xStreamBufferIsFull( xStreamBuffer ) == pdFALSE );
 	prvCheckExpectedState( xStreamBufferIsEmpty( xStreamBuffer ) == pdTRUE );
 
+	/* Test the zero copy functions, which write and read data in place. */
+	prvZeroCopyTests( xStreamBuffer );
+
 	/* Clean up with data in the buffer to ensure the tests that follow don't
 	see the data (the data should be discarded). */
 	( void ) xStreamBufferSend( xStreamBuffer, ( const void * ) pc55ByteString, sbSTREAM_BUFFER_LENGTH_BYTES / ( size_t ) 2, sbDONT_BLOCK );
@@ -450,6 +460,150 @@ UBaseType_t uxOriginalPriority;
 }
 /*-----------------------------------------------------------*/
 
+static void prvZeroCopyTests( StreamBufferHandle_t xStreamBuffer )
+{
+size_t xItem, xByte, xReturned, xWritten, xRead, xBytesToWrite;
+uint8_t *pucRegion;
+const size_t x17ByteLength = 17;
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	/* The stream buffer is empty so there is nothing to read. */
+	xReturned = xStreamBufferReceiveAcquire( xStreamBuffer, ( void ** ) &pucRegion, sbDONT_BLOCK );
+	prvCheckExpectedState( xReturned == 0 );
+
+	/* In the next loop 17 bytes are written in place then read out in place on
+	each iteration.  As 30 is not divisible by 17 the free space and the data
+	will sometimes wrap around the end of the storage area, in which case they
+	are returned in two parts.  Alternate iterations use the FromISR()
+	versions, which must be called from a critical section so this runs with
+	ports that don't support interrupt nesting. */
+	for( xItem = 0; xItem < 100; xItem++ )
+	{
+		/* Write 17 recognisable bytes directly into the stream buffer. */
+		xWritten = 0;
+		while( xWritten < x17ByteLength )
+		{
+			if( ( xItem & ( size_t ) 1 ) == ( size_t ) 0 )
+			{
+				xReturned = xStreamBufferSendAcquire( xStreamBuffer, ( void ** ) &pucRegion, sbDONT_BLOCK );
+			}
+			else
+			{
+				taskENTER_CRITICAL();
+				{
+					xReturned = xStreamBufferSendAcquireFromISR( xStreamBuffer, ( void ** ) &pucRegion );
+				}
+				taskEXIT_CRITICAL();
+			}
+
+			/* There is always space, so something must have been acquired. */
+			prvCheckExpectedState( xReturned > 0 );
+			if( xReturned == 0 )
+			{
+				break;
+			}
+
+			xBytesToWrite = configMIN( xReturned, x17ByteLength - xWritten );
+			memset( ( void * ) pucRegion, ( ( int ) '0' ) + ( int ) xItem, xBytesToWrite );
+			xWritten += xBytesToWrite;
+
+			if( ( xItem & ( size_t ) 1 ) == ( size_t ) 0 )
+			{
+				vStreamBufferSendCommit( xStreamBuffer, xBytesToWrite );
+			}
+			else
+			{
+				taskENTER_CRITICAL();
+				{
+					vStreamBufferSendCommitFromISR( xStreamBuffer, xBytesToWrite, &xHigherPriorityTaskWoken );
+				}
+				taskEXIT_CRITICAL();
+			}
+		}
+
+		prvCheckExpectedState( xStreamBufferBytesAvailable( xStreamBuffer ) == x17ByteLength );
+		prvCheckExpectedState( xStreamBufferSpacesAvailable( xStreamBuffer ) == ( sbSTREAM_BUFFER_LENGTH_BYTES - x17ByteLength ) );
+
+		/* Read the 17 bytes back out in place. */
+		xRead = 0;
+		while( xRead < x17ByteLength )
+		{
+			if( ( xItem & ( size_t ) 1 ) == ( size_t ) 0 )
+			{
+				xReturned = xStreamBufferReceiveAcquire( xStreamBuffer, ( void ** ) &pucRegion, sbRX_TX_BLOCK_TIME );
+			}
+			else
+			{
+				taskENTER_CRITICAL();
+				{
+					xReturned = xStreamBufferReceiveAcquireFromISR( xStreamBuffer, ( void ** ) &pucRegion );
+				}
+				taskEXIT_CRITICAL();
+			}
+
+			/* All the data was written, so the data acquired must not extend
+			past the end of it. */
+			prvCheckExpectedState( ( xReturned > 0 ) && ( ( xRead + xReturned ) <= x17ByteLength ) );
+			if( ( xReturned == 0 ) || ( ( xRead + xReturned ) > x17ByteLength ) )
+			{
+				break;
+			}
+
+			/* Is the data the data that was written? */
+			for( xByte = 0; xByte < xReturned; xByte++ )
+			{
+				prvCheckExpectedState( pucRegion[ xByte ] == ( uint8_t ) ( ( ( int ) '0' ) + ( int ) xItem ) );
+			}
+
+			xRead += xReturned;
+
+			if( ( xItem & ( size_t ) 1 ) == ( size_t ) 0 )
+			{
+				vStreamBufferReceiveCommit( xStreamBuffer, xReturned );
+			}
+			else
+			{
+				taskENTER_CRITICAL();
+				{
+					vStreamBufferReceiveCommitFromISR( xStreamBuffer, xReturned, &xHigherPriorityTaskWoken );
+				}
+				taskEXIT_CRITICAL();
+			}
+		}
+
+		prvCheckExpectedState( xStreamBufferIsEmpty( xStreamBuffer ) == pdTRUE );
+	}
+
+	/* Fill the buffer using the standard function, then check the free region
+	is empty, and that data written with the standard function can be read in
+	place. */
+	xReturned = xStreamBufferSend( xStreamBuffer, ( const void * ) pc55ByteString, sbSTREAM_BUFFER_LENGTH_BYTES, sbDONT_BLOCK );
+	prvCheckExpectedState( xReturned == sbSTREAM_BUFFER_LENGTH_BYTES );
+	xReturned = xStreamBufferSendAcquire( xStreamBuffer, ( void ** ) &pucRegion, sbDONT_BLOCK );
+	prvCheckExpectedState( xReturned == 0 );
+
+	xRead = 0;
+	while( xRead < sbSTREAM_BUFFER_LENGTH_BYTES )
+	{
+		xReturned = xStreamBufferReceiveAcquire( xStreamBuffer, ( void ** ) &pucRegion, sbDONT_BLOCK );
+		prvCheckExpectedState( ( xReturned > 0 ) && ( ( xRead + xReturned ) <= sbSTREAM_BUFFER_LENGTH_BYTES ) );
+		if( ( xReturned == 0 ) || ( ( xRead + xReturned ) > sbSTREAM_BUFFER_LENGTH_BYTES ) )
+		{
+			break;
+		}
+
+		prvCheckExpectedState( memcmp( ( const void * ) pucRegion, ( const void * ) &( pc55ByteString[ xRead ] ), xReturned ) == 0 );
+		vStreamBufferReceiveCommit( xStreamBuffer, xReturned );
+		xRead += xReturned;
+	}
+
+	prvCheckExpectedState( xStreamBufferIsEmpty( xStreamBuffer ) == pdTRUE );
+
+	/* Remove warning as xHigherPriorityTaskWoken is not otherwise used. */
+	( void ) xHigherPriorityTaskWoken;
+}
+/*-----------------------------------------------------------*/
+
 static void prvNonBlockingSenderTask( void *pvParameters )
 {
 StreamBufferHandle_t xStreamBuffer;
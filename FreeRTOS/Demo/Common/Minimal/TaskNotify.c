@@ -96,7 +96,7 @@ static uint32_t ulTimerNotificationsReceived = 0UL, ulTimerNotificationsSent = 0
 static TimerHandle_t xTimer = NULL;
 
 /* Used by the pseudo random number generating function. */
-static size_t uxNextRand = 0;
+static uint32_t ulNextRand = 0;
 
 /*-----------------------------------------------------------*/
 
@@ -107,7 +107,7 @@ void vStartTaskNotifyTask( void  )
 	xTaskCreate( prvNotifiedTask, "Notified", configMINIMAL_STACK_SIZE, NULL, notifyTASK_PRIORITY, &xTaskToNotify );
 
 	/* Pseudo seed the random number generator. */
-	uxNextRand = ( size_t ) prvRand;
+	ulNextRand = ( uint32_t ) ( size_t ) prvRand;
 }
 /*-----------------------------------------------------------*/
 
@@ -674,10 +674,11 @@ const uint32_t ulMaxSendReceiveDeviation = 5UL;
 
 static UBaseType_t prvRand( void )
 {
-const size_t uxMultiplier = ( size_t ) 0x015a4e35, uxIncrement = ( size_t ) 1;
+const uint32_t ulMultiplier = ( uint32_t ) 0x015a4e35, ulIncrement = ( uint32_t ) 1;
 
-	/* Utility function to generate a pseudo random number. */
-	uxNextRand = ( uxMultiplier * uxNextRand ) + uxIncrement;
-	return( ( uxNextRand >> 16 ) & ( ( size_t ) 0x7fff ) );
+	/* Utility function to generate a pseudo random number.  The state is 32
+	bits wide even where size_t is 16 bits. */
+	ulNextRand = ( ulMultiplier * ulNextRand ) + ulIncrement;
+	return( ( UBaseType_t ) ( ( ulNextRand >> 16 ) & ( ( uint32_t ) 0x7fff ) ) );
 }
 /*-----------------------------------------------------------*/
@@ -0,0 +1,262 @@
+/*
+ * FreeRTOS Kernel V10.1.1
+ * Copyright (C) 2018 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Tests the indexed task notification functions, which use the array of
+ * notifications each task holds when configTASK_NOTIFICATION_ARRAY_ENTRIES is
+ * greater than 1.
+ *
+ * The test task sends notifications to itself at every index and checks each
+ * index receives its own value and a notification at one index is never seen
+ * at another.  It then repeatedly gives a notification to a peer task that is
+ * blocked on the last index in the array, first at index 0 (which must not
+ * unblock the peer task) and then at the last index (which must).
+ */
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Demo program include files. */
+#include "TaskNotifyArray.h"
+
+#if( configTASK_NOTIFICATION_ARRAY_ENTRIES < 2 )
+	#error TaskNotifyArray.c requires configTASK_NOTIFICATION_ARRAY_ENTRIES to be at least 2.
+#endif
+
+/* The index at which the peer task blocks. */
+#define ntaPEER_INDEX			( configTASK_NOTIFICATION_ARRAY_ENTRIES - 1 )
+
+/* The time the test task waits to see if the peer task unblocks. */
+#define ntaSHORT_DELAY			pdMS_TO_TICKS( 20 )
+
+/* The tasks used by the test. */
+static void prvNotifyArrayTestTask( void *pvParameters );
+static void prvNotifyArrayPeerTask( void *pvParameters );
+
+/* Sends a notification to the test task itself at each index, then checks the
+notifications are received at the indexes to which they were sent. */
+static void prvTestSelfNotifications( uint32_t ulValueOffset );
+
+/* Checks notifications given to the peer task at the wrong index do not
+unblock it, and notifications given at the correct index do. */
+static void prvTestPeerNotifications( void );
+
+/* Incremented each time the test task completes a cycle without error. */
+static volatile uint32_t ulLoopCounter = 0;
+
+/* Incremented each time the peer task is unblocked. */
+static volatile uint32_t ulPeerNotifications = 0;
+
+/* Set to pdFAIL if an error is discovered. */
+static volatile BaseType_t xTestStatus = pdPASS;
+
+/* The handle of the peer task, so the test task can notify it. */
+static TaskHandle_t xPeerTask = NULL;
+
+/*-----------------------------------------------------------*/
+
+void vStartTaskNotifyArrayTask( void )
+{
+	/* The peer task has a higher priority than the test task so it runs as
+	soon as it is unblocked. */
+	xTaskCreate( prvNotifyArrayTestTask, "NtfyArr", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY, NULL );
+	xTaskCreate( prvNotifyArrayPeerTask, "NtfyArrP", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, &xPeerTask );
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifyArrayPeerTask( void *pvParameters )
+{
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		/* Only a notification at the last index should unblock this task, and
+		the count of notifications is expected to be exactly one. */
+		if( ulTaskNotifyTakeIndexed( ntaPEER_INDEX, pdTRUE, portMAX_DELAY ) != 1UL )
+		{
+			xTestStatus = pdFAIL;
+		}
+
+		ulPeerNotifications++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifyArrayTestTask( void *pvParameters )
+{
+uint32_t ulValueOffset = 0;
+
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		prvTestSelfNotifications( ulValueOffset );
+		prvTestPeerNotifications();
+
+		/* Use different values on the next cycle. */
+		ulValueOffset += configTASK_NOTIFICATION_ARRAY_ENTRIES;
+
+		if( xTestStatus == pdPASS )
+		{
+			/* Increment a counter to show this task is still running without
+			error. */
+			ulLoopCounter++;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestSelfNotifications( uint32_t ulValueOffset )
+{
+UBaseType_t uxIndex;
+uint32_t ulValue;
+
+	/* Nothing should be pending at any index at the start of the test. */
+	for( uxIndex = 0; uxIndex < configTASK_NOTIFICATION_ARRAY_ENTRIES; uxIndex++ )
+	{
+		if( xTaskNotifyWaitIndexed( uxIndex, 0, 0, NULL, 0 ) != pdFAIL )
+		{
+			xTestStatus = pdFAIL;
+		}
+	}
+
+	/* Send a different value to each index. */
+	for( uxIndex = 0; uxIndex < configTASK_NOTIFICATION_ARRAY_ENTRIES; uxIndex++ )
+	{
+		xTaskNotifyIndexed( xTaskGetCurrentTaskHandle(), uxIndex, ulValueOffset + ( uint32_t ) uxIndex, eSetValueWithOverwrite );
+	}
+
+	/* Each index must hold the value sent to it.  Receive them in reverse
+	order so receiving one notification cannot hide the others. */
+	uxIndex = configTASK_NOTIFICATION_ARRAY_ENTRIES;
+	while( uxIndex > 0 )
+	{
+		uxIndex--;
+		ulValue = 0;
+
+		if( xTaskNotifyWaitIndexed( uxIndex, 0, 0, &ulValue, 0 ) != pdPASS )
+		{
+			xTestStatus = pdFAIL;
+		}
+
+		if( ulValue != ( ulValueOffset + ( uint32_t ) uxIndex ) )
+		{
+			xTestStatus = pdFAIL;
+		}
+	}
+
+	/* A notification at index 0 must not be seen at the last index, and
+	clearing the state at index 0 must only clear that index. */
+	xTaskNotifyGiveIndexed( xTaskGetCurrentTaskHandle(), 0 );
+
+	if( xTaskNotifyWaitIndexed( ntaPEER_INDEX, 0, 0, NULL, 0 ) != pdFAIL )
+	{
+		xTestStatus = pdFAIL;
+	}
+
+	if( xTaskNotifyStateClearIndexed( NULL, ntaPEER_INDEX ) != pdFALSE )
+	{
+		xTestStatus = pdFAIL;
+	}
+
+	if( xTaskNotifyStateClearIndexed( NULL, 0 ) != pdTRUE )
+	{
+		xTestStatus = pdFAIL;
+	}
+
+	/* The state was cleared but the value was not, so the value can still be
+	taken.  The give incremented the value sent to index 0 earlier. */
+	if( ulTaskNotifyTakeIndexed( 0, pdTRUE, 0 ) != ( ulValueOffset + 1UL ) )
+	{
+		xTestStatus = pdFAIL;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestPeerNotifications( void )
+{
+uint32_t ulExpectedNotifications = ulPeerNotifications;
+
+	configASSERT( xPeerTask );
+
+	/* The peer task is blocked on the last index, so giving a notification
+	at index 0 must not unblock it. */
+	xTaskNotifyGiveIndexed( xPeerTask, 0 );
+	vTaskDelay( ntaSHORT_DELAY );
+
+	if( ulPeerNotifications != ulExpectedNotifications )
+	{
+		xTestStatus = pdFAIL;
+	}
+
+	/* Giving a notification at the last index must unblock it.  The peer
+	task has the higher priority so it runs before this call returns when
+	preemption is used. */
+	xTaskNotifyGiveIndexed( xPeerTask, ntaPEER_INDEX );
+	vTaskDelay( ntaSHORT_DELAY );
+	ulExpectedNotifications++;
+
+	if( ulPeerNotifications != ulExpectedNotifications )
+	{
+		xTestStatus = pdFAIL;
+	}
+
+	/* Remove the notification left at index 0 of the peer task. */
+	if( xTaskNotifyStateClearIndexed( xPeerTask, 0 ) != pdTRUE )
+	{
+		xTestStatus = pdFAIL;
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xAreTaskNotificationArrayTasksStillRunning( void )
+{
+static uint32_t ulLastLoopCounter = 0;
+BaseType_t xReturn;
+
+	if( xTestStatus != pdPASS )
+	{
+		xReturn = pdFAIL;
+	}
+	else if( ulLoopCounter != ulLastLoopCounter )
+	{
+		xReturn = pdPASS;
+	}
+	else
+	{
+		/* The task has stalled. */
+		xReturn = pdFAIL;
+	}
+
+	ulLastLoopCounter = ulLoopCounter;
+
+	return xReturn;
+}
+
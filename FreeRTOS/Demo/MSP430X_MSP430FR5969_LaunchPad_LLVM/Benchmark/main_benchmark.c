@@ -0,0 +1,161 @@
+/*
+ * FreeRTOS Kernel V10.1.1
+ * Copyright (C) 2018 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+
+/******************************************************************************
+ * NOTE 1:  This project provides three demo applications.  A simple blinky
+ * style project, a more comprehensive test and demo application, and a kernel
+ * benchmark.  The mainCREATE_SIMPLE_BLINKY_DEMO_ONLY and
+ * mainCREATE_BENCHMARK_ONLY settings are used to select between them.  See the
+ * notes at the top of main.c.  This file implements the kernel benchmark.
+ *
+ * NOTE 2:  This file only contains the source code that is specific to the
+ * benchmark.  Generic functions, such FreeRTOS hook functions, and functions
+ * required to configure the hardware, are defined in main.c.
+ *
+ ******************************************************************************
+ *
+ * main_benchmark() creates the kernel benchmark task implemented in
+ * Demo/Common/Minimal/KernelBenchmark.c, then starts the scheduler.  The
+ * benchmark times the most frequently used kernel primitives, then writes the
+ * results to UART 0 (19200 baud) in a machine readable form.  Timer A1 is run
+ * from SMCLK, which is the same clock as MCLK, so the results are in CPU
+ * cycles.  Timer A1 is also the run time stats time base.
+ *
+ * "make benchmark_placements" builds the benchmark four times, with the kernel
+ * state placed in SRAM and in FRAM (see mainPLACE_KERNEL_STATE_IN_SRAM in
+ * FreeRTOSConfig.h), each with MCLK at 8MHz and at 16MHz.  Comparing the
+ * results shows the cost of the FRAM wait state at 16MHz on the context switch
+ * and tick times.
+ *
+ * "Monitor" task - This runs at the idle priority, so only executes once the
+ * benchmark has completed.  It then toggles an LED every three seconds if the
+ * benchmark passed, or every 200ms if the benchmark reported a failure.
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Standard demo application includes. */
+#include "KernelBenchmark.h"
+#include "partest.h"
+#include "serial.h"
+
+/* The benchmark task must have a priority below that of the timer service
+task.  The monitor task uses the idle priority so it does not disturb the
+measurements. */
+#define mainBENCHMARK_TASK_PRIORITY			( tskIDLE_PRIORITY + 1 )
+#define mainMONITOR_TASK_PRIORITY			( tskIDLE_PRIORITY )
+
+/* The LED toggled by the monitor task. */
+#define mainCHECK_LED						( 0 )
+
+/* The rates at which the monitor task toggles the LED. */
+#define mainPASS_TOGGLE_PERIOD				pdMS_TO_TICKS( 3000 )
+#define mainFAIL_TOGGLE_PERIOD				pdMS_TO_TICKS( 200 )
+
+/* The length of the queue used by the serial driver to buffer characters
+waiting transmission. */
+#define mainSERIAL_QUEUE_LENGTH				( 32 )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Called by main() to run the kernel benchmark when mainCREATE_BENCHMARK_ONLY
+ * is set to 1.
+ */
+void main_benchmark( void );
+
+/*
+ * The monitor task, as described at the top of this file.
+ */
+static void prvMonitorTask( void *pvParameters );
+
+/*-----------------------------------------------------------*/
+
+void main_benchmark( void )
+{
+	/* The benchmark results are written to the UART. */
+	xSerialPortInitMinimal( configCLI_BAUD_RATE, mainSERIAL_QUEUE_LENGTH );
+
+	vStartKernelBenchmarkTask( mainBENCHMARK_TASK_PRIORITY );
+	xTaskCreate( prvMonitorTask, "Monitor", configMINIMAL_STACK_SIZE, NULL, mainMONITOR_TASK_PRIORITY, NULL );
+
+	/* Start the scheduler. */
+	vTaskStartScheduler();
+
+	/* If all is well, the scheduler will now be running, and the following
+	line will never be reached.  If the following line does execute, then
+	there was insufficient FreeRTOS heap memory available for the idle and/or
+	timer tasks to be created.  See the memory management section on the
+	FreeRTOS web site for more details on the FreeRTOS heap
+	http://www.freertos.org/a00111.html. */
+	for( ;; );
+}
+/*-----------------------------------------------------------*/
+
+static void prvMonitorTask( void *pvParameters )
+{
+TickType_t xTogglePeriod;
+
+	/* Just to stop compiler warnings. */
+	( void ) pvParameters;
+
+	/* This task has the idle priority, so should only run once the benchmark
+	task has output the results and suspended itself. */
+	while( xIsKernelBenchmarkComplete() == pdFALSE )
+	{
+		vTaskDelay( mainFAIL_TOGGLE_PERIOD );
+	}
+
+	if( xGetKernelBenchmarkStatus() == pdPASS )
+	{
+		xTogglePeriod = mainPASS_TOGGLE_PERIOD;
+	}
+	else
+	{
+		xTogglePeriod = mainFAIL_TOGGLE_PERIOD;
+	}
+
+	for( ;; )
+	{
+		vTaskDelay( xTogglePeriod );
+		vParTestToggleLED( mainCHECK_LED );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vBenchmarkPrintString( const char *pcString )
+{
+	vSerialPutString( NULL, ( const signed char * ) pcString, ( unsigned short ) strlen( pcString ) );
+}
+/*-----------------------------------------------------------*/
+
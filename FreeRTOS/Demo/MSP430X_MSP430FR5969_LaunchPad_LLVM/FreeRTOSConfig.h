@@ -46,7 +46,10 @@ __persistent keyword to be used.  See http://www.freertos.org/a00111.html#heap_4
 #define configAPPLICATION_ALLOCATED_HEAP		1
 #define configUSE_PREEMPTION					1
 #define configMAX_PRIORITIES					( 5 )
-#define configCPU_CLOCK_HZ						( 8000000 )
+#ifndef configCPU_CLOCK_HZ
+	/* 8MHz or 16MHz, see prvSetupHardware() in main.c. */
+	#define configCPU_CLOCK_HZ					( 8000000 )
+#endif
 #define configTICK_RATE_HZ						( 1000 ) /* In this non-real time simulated environment the tick frequency has to be at least a multiple of the Win32 tick frequency, and therefore very slow. */
 #define configTOTAL_HEAP_SIZE					( 14 * 1024 )
 #define configMAX_TASK_NAME_LEN					( 15 )
@@ -69,6 +72,16 @@ __persistent keyword to be used.  See http://www.freertos.org/a00111.html#heap_4
 #define configUSE_MALLOC_FAILED_HOOK	1
 #define configCHECK_FOR_STACK_OVERFLOW	2
 
+/* Low power tickless idle.  When enabled the tick interrupt is suppressed and
+the microcontroller sits in LPM3 for as long as all the tasks are blocked,
+rather than waking every tick.  The tick timer runs from the ACLK so continues
+to run in LPM3. */
+#if( mainCREATE_SIMPLE_BLINKY_DEMO_ONLY == 1 )
+#define configUSE_TICKLESS_IDLE			1
+#else
+#define configUSE_TICKLESS_IDLE			0
+#endif
+
 /* Software timer related definitions. */
 #define configUSE_TIMERS				1
 #define configTIMER_TASK_PRIORITY		( configMAX_PRIORITIES - 1 )
@@ -84,10 +97,13 @@ __persistent keyword to be used.  See http://www.freertos.org/a00111.html#heap_4
 #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
 #else
 #define configGENERATE_RUN_TIME_STATS	1
-#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() vConfigureTimerForRunTimeStats()
 #endif
-/* Return the current timer counter value + the overflow counter. */
-#define portGET_RUN_TIME_COUNTER_VALUE() 	( ( ( uint32_t ) TA1R ) + ulRunTimeCounterOverflows )
+
+/* The port provides the run time counter from timer A1 clocked from SMCLK,
+extended by the timer's overflow interrupt.  At 8MHz a 32-bit counter would
+overflow in under ten minutes, so a 64-bit counter is used. */
+#define configRUN_TIME_COUNTER_TYPE		uint64_t
+#define configRUN_TIME_TIMER_VECTOR		TIMER1_A1_VECTOR
 
 /* Co-routine definitions. */
 #define configUSE_CO_ROUTINES 			0
@@ -127,6 +143,23 @@ vApplicationSetupTimerInterrupt() generates the tick from timer A0, so in this
 case configTICK__VECTOR is set to TIMER0_A0_VECTOR. */
 #define configTICK_VECTOR				TIMER0_A0_VECTOR
 
+/* Memory placement.  The FR5969 has only 2KB of SRAM, most of which is
+otherwise unused, while FRAM accesses need a wait state when MCLK is above 8MHz.
+When mainPLACE_KERNEL_STATE_IN_SRAM is 1 the kernel variables accessed on every
+tick and context switch are placed in the .sram_data section, which
+msp430fr5969.ld locates in SRAM.  The heap, and therefore the task stacks and
+queue storage, remains in FRAM (see ucHeap in main.c).  Any other object can be
+placed in SRAM using mainSRAM_DATA. */
+#ifndef mainPLACE_KERNEL_STATE_IN_SRAM
+	#define mainPLACE_KERNEL_STATE_IN_SRAM	1
+#endif
+
+#define mainSRAM_DATA					__attribute__( ( section( ".sram_data" ) ) )
+
+#if( mainPLACE_KERNEL_STATE_IN_SRAM == 1 )
+	#define configKERNEL_STATE_PLACEMENT	mainSRAM_DATA
+#endif
+
 /* The size of the buffer used by the CLI to place output generated by the CLI.
 WARNING:  By default there is no overflow checking when writing to this
 buffer. */
@@ -144,15 +177,19 @@ CLI. */
 /* The baudrate used for the CLI. */
 #define configCLI_BAUD_RATE			19200
 
+/* Definitions used by the kernel benchmark (Demo/Common/Minimal/KernelBenchmark.c)
+when the benchmark_demo target is built.  That build runs timer A1 from SMCLK,
+which is the same clock as MCLK, so the 16-bit timer count is a CPU cycle
+count. */
+#define configBENCHMARK_TIMESTAMP_TYPE		uint16_t
+#define configBENCHMARK_GET_TIMESTAMP()		( TA1R )
+#define configBENCHMARK_TIMESTAMP_UNITS		"cycles"
+#define configBENCHMARK_PRINT_STRING( pcString ) vBenchmarkPrintString( pcString )
+
 /* Compiler specifics below here. */
 /* Prevent the following line being included from IAR asm files. */
 #ifndef __IAR_SYSTEMS_ASM__
-	void vConfigureTimerForRunTimeStats( void );
-#if( mainCREATE_SIMPLE_BLINKY_DEMO_ONLY == 1 )
-#else
-	extern volatile uint32_t ulRunTimeCounterOverflows;
-#endif
-	void vConfigureTimerForRunTimeStats( void );
+	void vBenchmarkPrintString( const char *pcString );
 #endif
 
 #ifdef __ICC430__
@@ -160,9 +160,6 @@ than in FreeRTOS_CLI.c, configAPPLICATION_PROVIDES_cOutputBuffer must be set to
 #endif
 char cOutputBuffer[ configCOMMAND_INT_MAX_OUTPUT_SIZE ] = { 0 };
 
-/* Used for maintaining a 32-bit run time stats counter from a 16-bit timer. */
-volatile uint32_t ulRunTimeCounterOverflows = 0;
-
 /*-----------------------------------------------------------*/
 
 void main_full( void )
@@ -339,29 +336,3 @@ static void prvRegTestTaskEntry2( void *pvParameters )
 }
 /*-----------------------------------------------------------*/
 
-void vConfigureTimerForRunTimeStats( void )
-{
-	/* Configure a timer that is used as the time base for run time stats.  See
-	http://www.freertos.org/rtos-run-time-stats.html */
-
-	/* Ensure the timer is stopped. */
-	TA1CTL = 0;
-
-	/* Start up clean. */
-	TA1CTL |= TACLR;
-
-	/* Run the timer from the ACLK/8, continuous mode, interrupt enable. */
-	TA1CTL = TASSEL_1 | ID__8 | MC__CONTINUOUS | TAIE;
-}
-/*-----------------------------------------------------------*/
-
-__attribute__((interrupt(TIMER1_A1_VECTOR)))
-void v4RunTimeStatsTimerOverflow( void )
-{
-	TA1CTL &= ~TAIFG;
-	
-	/* 16-bit overflow, so add 17th bit. */
-	ulRunTimeCounterOverflows += 0x10000;
-	__bic_SR_register_on_exit( SCG1 + SCG0 + OSCOFF + CPUOFF );
-}
-
@@ -33,6 +33,10 @@
  * in main_blinky.c.  The more comprehensive test and demo application is
  * implemented and described in main_full.c.
  *
+ * Setting mainCREATE_BENCHMARK_ONLY to 1 (as done by the benchmark_demo target
+ * in the Makefile) instead runs the kernel benchmark, which is implemented and
+ * described in main_benchmark.c.
+ *
  * This file implements the code that is not demo specific, including the
  * hardware setup and standard FreeRTOS hook functions.
  *
@@ -44,6 +48,9 @@
 
 #include "in430.h"
 
+/* Standard includes. */
+#include <string.h>
+
 /* Scheduler include files. */
 #include "FreeRTOS.h"
 #include "task.h"
@@ -68,11 +75,20 @@ or 0 to run the more comprehensive test and demo application. */
  */
 static void prvSetupHardware( void );
 
+/*
+ * Copy the initial values of the objects placed in SRAM by mainSRAM_DATA from
+ * FRAM.  See the memory placement definitions in FreeRTOSConfig.h.
+ */
+static void prvInitialiseSRAMData( void );
+
 /*
  * main_blinky() is used when mainCREATE_SIMPLE_BLINKY_DEMO_ONLY is set to 1.
  * main_full() is used when mainCREATE_SIMPLE_BLINKY_DEMO_ONLY is set to 0.
+ * main_benchmark() is used when mainCREATE_BENCHMARK_ONLY is set to 1.
  */
-#if( mainCREATE_SIMPLE_BLINKY_DEMO_ONLY == 1 )
+#if( mainCREATE_BENCHMARK_ONLY == 1 )
+	extern void main_benchmark( void );
+#elif( mainCREATE_SIMPLE_BLINKY_DEMO_ONLY == 1 )
 	extern void main_blinky( void );
 #else
 	extern void main_full( void );
@@ -101,12 +117,19 @@ int main( void )
 {
 	/* See http://www.FreeRTOS.org/MSP430FR5969_Free_RTOS_Demo.html */
 
+	/* This must be done before any FreeRTOS API function is called. */
+	prvInitialiseSRAMData();
+
 	/* Configure the hardware ready to run the demo. */
 	prvSetupHardware();
 
 	/* The mainCREATE_SIMPLE_BLINKY_DEMO_ONLY setting is described at the top
 	of this file. */
-	#if( mainCREATE_SIMPLE_BLINKY_DEMO_ONLY == 1 )
+	#if( mainCREATE_BENCHMARK_ONLY == 1 )
+	{
+		main_benchmark();
+	}
+	#elif( mainCREATE_SIMPLE_BLINKY_DEMO_ONLY == 1 )
 	{
 		main_blinky();
 	}
@@ -150,14 +173,20 @@ void vApplicationStackOverflowHook( TaskHandle_t pxTask, char *pcTaskName )
 
 void vApplicationIdleHook( void )
 {
-    __bis_SR_register( LPM4_bits + GIE );
-    __no_operation();
+	/* When tickless idle is used the low power mode is entered by the kernel,
+	which also keeps the tick timer running while it sleeps. */
+	#if( configUSE_TICKLESS_IDLE == 0 )
+	{
+		__bis_SR_register( LPM4_bits + GIE );
+		__no_operation();
+	}
+	#endif
 }
 /*-----------------------------------------------------------*/
 
 void vApplicationTickHook( void )
 {
-	#if( mainCREATE_SIMPLE_BLINKY_DEMO_ONLY == 0 )
+	#if( ( mainCREATE_SIMPLE_BLINKY_DEMO_ONLY == 0 ) && ( mainCREATE_BENCHMARK_ONLY == 0 ) )
 	{
 		/* Call the periodic event group from ISR demo. */
 		vPeriodicEventGroupsProcessing();
@@ -228,8 +257,21 @@ static void prvSetupHardware( void )
 	/* Set PJ.4 and PJ.5 for LFXT. */
 	GPIO_setAsPeripheralModuleFunctionInputPin(  GPIO_PORT_PJ, GPIO_PIN4 + GPIO_PIN5, GPIO_PRIMARY_MODULE_FUNCTION  );
 
-	/* Set DCO frequency to 8 MHz. */
-	CS_setDCOFreq( CS_DCORSEL_0, CS_DCOFSEL_6 );
+	#if( configCPU_CLOCK_HZ == 16000000 )
+	{
+		/* FRAM accesses need one wait state above 8 MHz, which must be set
+		before the clock frequency is increased. */
+		FRCTL0 = FRCTLPW | NWAITS_1;
+
+		/* Set DCO frequency to 16 MHz. */
+		CS_setDCOFreq( CS_DCORSEL_1, CS_DCOFSEL_4 );
+	}
+	#else
+	{
+		/* Set DCO frequency to 8 MHz. */
+		CS_setDCOFreq( CS_DCORSEL_0, CS_DCOFSEL_6 );
+	}
+	#endif
 
 	/* Set external clock frequency to 32.768 KHz. */
 	CS_setExternalClockSource( 32768, 0 );
@@ -251,6 +293,15 @@ static void prvSetupHardware( void )
 }
 /*-----------------------------------------------------------*/
 
+static void prvInitialiseSRAMData( void )
+{
+/* Defined by msp430fr5969.ld. */
+extern uint8_t __sram_data_start[], __sram_data_end[], __sram_data_load[];
+
+	memcpy( ( void * ) __sram_data_start, ( void * ) __sram_data_load, ( size_t ) ( __sram_data_end - __sram_data_start ) );
+}
+/*-----------------------------------------------------------*/
+
 int _system_pre_init( void )
 {
     /* Stop Watchdog timer. */
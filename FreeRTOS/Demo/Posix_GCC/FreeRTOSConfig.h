@@ -0,0 +1,169 @@
+/*
+ * FreeRTOS Kernel V10.1.1
+ * Copyright (C) 2018 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/*-----------------------------------------------------------
+ * Application specific definitions.
+ *
+ * These definitions should be adjusted for your particular hardware and
+ * application requirements.
+ *
+ * THESE PARAMETERS ARE DESCRIBED WITHIN THE 'CONFIGURATION' SECTION OF THE
+ * FreeRTOS API DOCUMENTATION AVAILABLE ON THE FreeRTOS.org WEB SITE.  See
+ * http://www.freertos.org/a00110.html
+ *----------------------------------------------------------*/
+
+#define configUSE_PREEMPTION					1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION	1
+#define configUSE_IDLE_HOOK						1
+#define configUSE_TICK_HOOK						1
+#define configUSE_DAEMON_TASK_STARTUP_HOOK		0
+#define configTICK_RATE_HZ						( 1000 )
+#define configMINIMAL_STACK_SIZE				( ( unsigned short ) 70 ) /* In this simulated case, the stack only has to hold one small structure as the real stack is part of the pthread. */
+#define configTOTAL_HEAP_SIZE					( ( size_t ) ( 512 * 1024 ) )
+#define configMAX_TASK_NAME_LEN					( 12 )
+#define configUSE_TASK_NAME_REGISTRY			1
+#define configUSE_TRACE_FACILITY				1
+#define configUSE_16_BIT_TICKS					0
+#define configIDLE_SHOULD_YIELD					1
+#define configUSE_MUTEXES						1
+#define configCHECK_FOR_STACK_OVERFLOW			0
+#define configUSE_STACK_WATERMARK				1
+#define configUSE_RECURSIVE_MUTEXES				1
+#define configQUEUE_REGISTRY_SIZE				20
+#define configUSE_APPLICATION_TASK_TAG			1
+#define configUSE_COUNTING_SEMAPHORES			1
+#define configUSE_ALTERNATIVE_API				0
+#define configUSE_QUEUE_SETS					1
+#define configUSE_TASK_NOTIFICATIONS			1
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES	3
+#define configSUPPORT_STATIC_ALLOCATION			1
+#define configSUPPORT_DYNAMIC_ALLOCATION		1
+#define configUSE_MALLOC_FAILED_HOOK			1
+
+/* Software timer related configuration options.  The maximum possible task
+priority is configMAX_PRIORITIES - 1. */
+#define configUSE_TIMERS						1
+#define configTIMER_TASK_PRIORITY				( configMAX_PRIORITIES - 1 )
+#define configTIMER_QUEUE_LENGTH				20
+#define configTIMER_TASK_STACK_DEPTH			( configMINIMAL_STACK_SIZE * 2 )
+
+#define configMAX_PRIORITIES					( 7 )
+
+/* Dynamically created kernel objects are taken from pools before the heap is
+used.  The pools are smaller than the number of objects the demo creates, so
+objects are taken from both the pools and the heap.  See
+FreeRTOS/Source/include/object_pool.h. */
+#define configTASK_POOL_SIZE					16
+#define configTASK_STACK_POOL_SIZE				16
+#define configTASK_STACK_POOL_DEPTH				( configMINIMAL_STACK_SIZE * 2 )
+#define configQUEUE_POOL_SIZE					16
+#define configQUEUE_POOL_STORAGE_BYTES			32
+#define configTIMER_POOL_SIZE					8
+#define configEVENT_GROUP_POOL_SIZE				4
+
+/* Tasks blocked on an event group are indexed by the bits they are waiting
+for, so setting bits only examines tasks the bits might unblock. */
+#define configUSE_EVENT_GROUP_WAITER_INDEX		1
+
+/* Tasks blocked on a queue or semaphore are held in one list per priority, so
+blocking does not search a list sorted by priority. */
+#define configUSE_PRIORITY_EVENT_LISTS			1
+
+/* A priority inherited from a task blocked on a mutex is passed along chains
+of tasks that are each blocked on a mutex held by the next. */
+#define configUSE_TRANSITIVE_PRIORITY_INHERITANCE	1
+
+/* Count how often each reader-writer lock is taken and contended. */
+#define configUSE_RWLOCK_STATS					1
+
+/* Run time stats gathering configuration options.  The run time counter is
+taken from the host's monotonic clock, in microseconds, and is 64 bits so it
+does not wrap. */
+uint64_t ullGetRunTimeCounterValue( void ); /* Prototype of function that returns run time counter. */
+void vConfigureTimerForRunTimeStats( void );	/* Prototype of function that initialises the run time counter. */
+#define configGENERATE_RUN_TIME_STATS			1
+#define configRUN_TIME_COUNTER_TYPE				uint64_t
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() vConfigureTimerForRunTimeStats()
+#define portGET_RUN_TIME_COUNTER_VALUE() ullGetRunTimeCounterValue()
+
+/* The host does not run the task woken by the tick interrupt immediately, so
+more bytes than the trigger level can arrive before the stream buffer test
+task reads the buffer. */
+#define configSTREAM_BUFFER_TRIGGER_LEVEL_TEST_MARGIN	( 4 )
+
+/* Kernel benchmark configuration, used when the posix_benchmark target is
+built.  Timestamps are taken from the host's monotonic clock in nanoseconds.
+See Demo/Common/Minimal/KernelBenchmark.c. */
+unsigned long ulGetBenchmarkTimestamp( void );
+void vBenchmarkPrintString( const char *pcString );
+#define configBENCHMARK_GET_TIMESTAMP()			ulGetBenchmarkTimestamp()
+#define configBENCHMARK_TIMESTAMP_TYPE			uint32_t
+#define configBENCHMARK_TIMESTAMP_UNITS			"ns"
+#define configBENCHMARK_PRINT_STRING( pcString ) vBenchmarkPrintString( pcString )
+#define configBENCHMARK_SAMPLES					( 1000 )
+
+/* Co-routine related configuration options. */
+#define configUSE_CO_ROUTINES 					0
+#define configMAX_CO_ROUTINE_PRIORITIES			( 2 )
+
+/* This demo can use of one or more example stats formatting functions.  These
+format the raw data provided by the uxTaskGetSystemState() function in to human
+readable ASCII form.  See the notes in the implementation of vTaskList() within
+FreeRTOS/Source/tasks.c for limitations. */
+#define configUSE_STATS_FORMATTING_FUNCTIONS	1
+
+/* Set the following definitions to 1 to include the API function, or zero
+to exclude the API function.  In most cases the linker will remove unused
+functions anyway. */
+#define INCLUDE_vTaskPrioritySet				1
+#define INCLUDE_uxTaskPriorityGet				1
+#define INCLUDE_vTaskDelete						1
+#define INCLUDE_vTaskCleanUpResources			0
+#define INCLUDE_vTaskSuspend					1
+#define INCLUDE_vTaskDelayUntil					1
+#define INCLUDE_vTaskDelay						1
+#define INCLUDE_uxTaskGetStackHighWaterMark		1
+#define INCLUDE_uxTaskGetStackHighWaterMark2	1
+#define INCLUDE_xTaskGetSchedulerState			1
+#define INCLUDE_xTimerGetTimerDaemonTaskHandle	1
+#define INCLUDE_xTaskGetIdleTaskHandle			1
+#define INCLUDE_xTaskGetHandle					1
+#define INCLUDE_eTaskGetState					1
+#define INCLUDE_xSemaphoreGetMutexHolder		1
+#define INCLUDE_xTimerPendFunctionCall			1
+#define INCLUDE_xTaskAbortDelay					1
+#define INCLUDE_xEventGroupSetBitsFromISR		1
+
+/* It is a good idea to define configASSERT() while developing.  configASSERT()
+uses the same semantics as the standard C assert() macro. */
+extern void vAssertCalled( unsigned long ulLine, const char * const pcFileName );
+#define configASSERT( x ) if( ( x ) == 0 ) vAssertCalled( __LINE__, __FILE__ )
+
+#endif /* FREERTOS_CONFIG_H */
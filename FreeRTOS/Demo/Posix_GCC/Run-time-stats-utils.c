@@ -0,0 +1,67 @@
+/*
+ * FreeRTOS Kernel V10.1.1
+ * Copyright (C) 2018 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Utility functions required to gather run time statistics.  See:
+ * http://www.freertos.org/rtos-run-time-stats.html
+ *
+ * The run time counter is the host's monotonic clock in microseconds.
+ */
+
+/* Standard includes. */
+#include <time.h>
+
+/* FreeRTOS includes. */
+#include <FreeRTOS.h>
+
+/* The monotonic clock value when the run time counter was configured.  Run
+time stats record how much time each task spends in the Running state. */
+static struct timespec xInitialRunTimeCounterValue = { 0, 0 };
+
+/*-----------------------------------------------------------*/
+
+void vConfigureTimerForRunTimeStats( void )
+{
+	/* What is the monotonic clock value now, this will be subtracted from
+	readings taken at run time. */
+	clock_gettime( CLOCK_MONOTONIC, &xInitialRunTimeCounterValue );
+}
+/*-----------------------------------------------------------*/
+
+uint64_t ullGetRunTimeCounterValue( void )
+{
+struct timespec xCurrentCount;
+uint64_t ullMicroseconds;
+
+	clock_gettime( CLOCK_MONOTONIC, &xCurrentCount );
+
+	ullMicroseconds = ( ( uint64_t ) ( xCurrentCount.tv_sec - xInitialRunTimeCounterValue.tv_sec ) * 1000000ULL );
+	ullMicroseconds += ( uint64_t ) ( ( xCurrentCount.tv_nsec - xInitialRunTimeCounterValue.tv_nsec ) / 1000L );
+
+	return ullMicroseconds;
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,289 @@
+/*
+ * FreeRTOS Kernel V10.1.1
+ * Copyright (C) 2018 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/******************************************************************************
+ * This project runs the standard demo/test tasks on a Linux (or other POSIX)
+ * host using the Posix port, so the kernel can be built, tested and measured
+ * without target hardware.  The demo is implemented and described in
+ * main_full.c.
+ *
+ * When this file is built with mainCREATE_BENCHMARK_ONLY set to 1 (see the
+ * posix_benchmark target in the Makefile) the kernel benchmark is run instead
+ * of the demo.  The benchmark is implemented in main_benchmark.c.
+ *
+ * The heap implementation is selected by the HEAP variable in the Makefile.
+ * heap_5.c and heap_6.c do not allocate their own memory, so when either is
+ * used the Makefile sets mainDEFINE_HEAP_REGIONS to 1 and this file passes the
+ * heap memory to the kernel, split into two regions, before anything else is
+ * done.
+ *
+ * This file implements the code that is not demo specific, including the
+ * FreeRTOS hook functions.
+ *
+ * The demo runs indefinitely by default.  If a number is given on the command
+ * line then the demo instead runs for that many seconds, then exits with a
+ * zero status if no errors were detected and a non-zero status otherwise, so
+ * it can be used as a regression test.
+ *
+ *******************************************************************************
+ * NOTE: The host will not be running the FreeRTOS task threads continuously,
+ * so do not expect to get real time behaviour from the Posix port or this demo
+ * application.
+ *******************************************************************************
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+
+/* FreeRTOS kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Set to 1 by the Makefile when the heap implementation needs
+vPortDefineHeapRegions() to be called. */
+#ifndef mainDEFINE_HEAP_REGIONS
+	#define mainDEFINE_HEAP_REGIONS		0
+#endif
+
+/*-----------------------------------------------------------*/
+
+/*
+ * main_benchmark() is used when mainCREATE_BENCHMARK_ONLY is set to 1.
+ * main_full() is used when mainCREATE_BENCHMARK_ONLY is set to 0.  The
+ * parameter to main_full() is the time for which the demo runs before the
+ * scheduler is ended, or 0 to run indefinitely.
+ */
+#if( mainCREATE_BENCHMARK_ONLY == 1 )
+	extern int main_benchmark( void );
+#else
+	extern int main_full( TickType_t xMaxRunTime );
+	void vFullDemoTickHookFunction( void );
+	void vFullDemoIdleFunction( void );
+#endif
+
+/*
+ * Prototypes for the standard FreeRTOS application hook (callback) functions
+ * implemented within this file.  See http://www.freertos.org/a00016.html .
+ */
+void vApplicationMallocFailedHook( void );
+void vApplicationIdleHook( void );
+void vApplicationStackOverflowHook( TaskHandle_t pxTask, char *pcTaskName );
+void vApplicationTickHook( void );
+void vApplicationGetIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint32_t *pulIdleTaskStackSize );
+void vApplicationGetTimerTaskMemory( StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint32_t *pulTimerTaskStackSize );
+
+/*
+ * Pass the heap memory to heap_5.c or heap_6.c.
+ */
+#if( mainDEFINE_HEAP_REGIONS == 1 )
+	static void prvInitialiseHeap( void );
+#endif
+
+/*-----------------------------------------------------------*/
+
+/* When configSUPPORT_STATIC_ALLOCATION is set to 1 the application writer can
+use a callback function to optionally provide the memory required by the idle
+and timer tasks.  This is the stack that will be used by the timer task.  It is
+declared here, as a global, so it can be checked by a test that is implemented
+in a different file. */
+StackType_t uxTimerTaskStack[ configTIMER_TASK_STACK_DEPTH ];
+
+/*-----------------------------------------------------------*/
+
+int main( int argc, char *argv[] )
+{
+	#if( mainDEFINE_HEAP_REGIONS == 1 )
+	{
+		prvInitialiseHeap();
+	}
+	#endif
+
+	/* The mainCREATE_BENCHMARK_ONLY setting is described at the top of this
+	file. */
+	#if( mainCREATE_BENCHMARK_ONLY == 1 )
+	{
+		( void ) argc;
+		( void ) argv;
+
+		return main_benchmark();
+	}
+	#else
+	{
+	TickType_t xMaxRunTime = 0;
+
+		if( argc > 1 )
+		{
+			xMaxRunTime = pdMS_TO_TICKS( strtoul( argv[ 1 ], NULL, 10 ) * 1000UL );
+		}
+
+		return main_full( xMaxRunTime );
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationMallocFailedHook( void )
+{
+	/* vApplicationMallocFailedHook() will only be called if
+	configUSE_MALLOC_FAILED_HOOK is set to 1 in FreeRTOSConfig.h.  It is a hook
+	function that will get called if a call to pvPortMalloc() fails.
+	pvPortMalloc() is called internally by the kernel whenever a task, queue,
+	timer or semaphore is created.  It is also called by various parts of the
+	demo application.  See http://www.freertos.org/a00111.html for more
+	information. */
+	vAssertCalled( __LINE__, __FILE__ );
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationIdleHook( void )
+{
+	/* vApplicationIdleHook() will only be called if configUSE_IDLE_HOOK is set
+	to 1 in FreeRTOSConfig.h.  It will be called on each iteration of the idle
+	task.  It is essential that code added to this hook function never attempts
+	to block in any way (for example, call xQueueReceive() with a block time
+	specified, or call vTaskDelay()). */
+	#if( mainCREATE_BENCHMARK_ONLY == 0 )
+	{
+		vFullDemoIdleFunction();
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationStackOverflowHook( TaskHandle_t pxTask, char *pcTaskName )
+{
+	( void ) pcTaskName;
+	( void ) pxTask;
+
+	/* Run time stack overflow checking is performed if
+	configCHECK_FOR_STACK_OVERFLOW is defined to 1 or 2.  This hook
+	function is called if a stack overflow is detected.  This function is
+	provided as an example only as stack overflow checking does not function
+	when running the FreeRTOS Posix port. */
+	vAssertCalled( __LINE__, __FILE__ );
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationTickHook( void )
+{
+	/* This function will be called by each tick interrupt if
+	configUSE_TICK_HOOK is set to 1 in FreeRTOSConfig.h.  User code can be
+	added here, but the tick hook is called from an interrupt context, so
+	code must not attempt to block, and only the interrupt safe FreeRTOS API
+	functions can be used (those that end in FromISR()). */
+	#if( mainCREATE_BENCHMARK_ONLY == 0 )
+	{
+		vFullDemoTickHookFunction();
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+void vAssertCalled( unsigned long ulLine, const char * const pcFileName )
+{
+	/* Called if an assertion passed to configASSERT() fails.  See
+	http://www.freertos.org/a00110.html#configASSERT for more information.
+	Stop the whole process so the failure is reported to whatever started the
+	demo, and so a core file can be inspected. */
+	taskDISABLE_INTERRUPTS();
+	fprintf( stderr, "ASSERT! Line %lu, file %s\r\n", ulLine, pcFileName );
+	abort();
+}
+/*-----------------------------------------------------------*/
+
+/* configUSE_STATIC_ALLOCATION is set to 1, so the application must provide an
+implementation of vApplicationGetIdleTaskMemory() to provide the memory that is
+used by the Idle task. */
+void vApplicationGetIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint32_t *pulIdleTaskStackSize )
+{
+/* If the buffers to be provided to the Idle task are declared inside this
+function then they must be declared static - otherwise they will be allocated on
+the stack and so not exists after this function exits. */
+static StaticTask_t xIdleTaskTCB;
+static StackType_t uxIdleTaskStack[ configMINIMAL_STACK_SIZE ];
+
+	/* Pass out a pointer to the StaticTask_t structure in which the Idle task's
+	state will be stored. */
+	*ppxIdleTaskTCBBuffer = &xIdleTaskTCB;
+
+	/* Pass out the array that will be used as the Idle task's stack. */
+	*ppxIdleTaskStackBuffer = uxIdleTaskStack;
+
+	/* Pass out the size of the array pointed to by *ppxIdleTaskStackBuffer.
+	Note that, as the array is necessarily of type StackType_t,
+	configMINIMAL_STACK_SIZE is specified in words, not bytes. */
+	*pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+/*-----------------------------------------------------------*/
+
+/* configUSE_STATIC_ALLOCATION and configUSE_TIMERS are both set to 1, so the
+application must provide an implementation of vApplicationGetTimerTaskMemory()
+to provide the memory that is used by the Timer service task. */
+void vApplicationGetTimerTaskMemory( StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint32_t *pulTimerTaskStackSize )
+{
+/* If the buffers to be provided to the Timer task are declared inside this
+function then they must be declared static - otherwise they will be allocated on
+the stack and so not exists after this function exits. */
+static StaticTask_t xTimerTaskTCB;
+
+	/* Pass out a pointer to the StaticTask_t structure in which the Timer
+	task's state will be stored. */
+	*ppxTimerTaskTCBBuffer = &xTimerTaskTCB;
+
+	/* Pass out the array that will be used as the Timer task's stack. */
+	*ppxTimerTaskStackBuffer = uxTimerTaskStack;
+
+	/* Pass out the size of the array pointed to by *ppxTimerTaskStackBuffer.
+	Note that, as the array is necessarily of type StackType_t,
+	configMINIMAL_STACK_SIZE is specified in words, not bytes. */
+	*pulTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
+}
+/*-----------------------------------------------------------*/
+
+#if( mainDEFINE_HEAP_REGIONS == 1 )
+
+	static void prvInitialiseHeap( void )
+	{
+	/* The heap memory is split into two regions, so the handling of multiple
+	regions is exercised.  The regions are defined in address order, as required
+	by heap_5.c. */
+	static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+	const size_t xFirstRegionSize = configTOTAL_HEAP_SIZE / 4;
+	const HeapRegion_t xHeapRegions[] =
+	{
+		{ ucHeap, xFirstRegionSize },
+		{ ucHeap + xFirstRegionSize, configTOTAL_HEAP_SIZE - xFirstRegionSize },
+		{ NULL, 0 }
+	};
+
+		vPortDefineHeapRegions( xHeapRegions );
+	}
+
+#endif /* mainDEFINE_HEAP_REGIONS */
+/*-----------------------------------------------------------*/
+
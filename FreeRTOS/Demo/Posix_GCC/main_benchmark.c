@@ -0,0 +1,119 @@
+/*
+ * FreeRTOS Kernel V10.1.1
+ * Copyright (C) 2018 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+
+/*
+ *******************************************************************************
+ * NOTE: The Posix port is a simulation only, so the timings measured here are
+ * those of the host, including the cost of switching between the host threads
+ * that run the tasks.  They are useful for comparing one build of the kernel
+ * with another on the same host, not for predicting timings on a target.
+ *******************************************************************************
+ *
+ * main_benchmark() is used when mainCREATE_BENCHMARK_ONLY is set to 1.  It
+ * creates the kernel benchmark task implemented in
+ * Demo/Common/Minimal/KernelBenchmark.c, and a task that ends the scheduler
+ * once the benchmark has output its results.  The results are printed to
+ * stdout in nanoseconds.  main_benchmark() returns a non-zero value if the
+ * benchmark reported a failure.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* Kernel includes. */
+#include <FreeRTOS.h>
+#include <task.h>
+
+/* Standard demo includes. */
+#include "KernelBenchmark.h"
+
+/* Priorities at which the tasks are created.  The benchmark task must have a
+priority below that of the timer service task.  The monitor task uses the idle
+priority so it does not disturb the measurements. */
+#define mainBENCHMARK_TASK_PRIORITY		( tskIDLE_PRIORITY + 1 )
+#define mainMONITOR_TASK_PRIORITY		( tskIDLE_PRIORITY )
+
+/* How often the monitor task checks whether the benchmark has completed. */
+#define mainMONITOR_TASK_PERIOD			pdMS_TO_TICKS( 100UL )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Ends the scheduler once the benchmark has completed.
+ */
+static void prvMonitorTask( void *pvParameters );
+
+/*-----------------------------------------------------------*/
+
+int main_benchmark( void )
+{
+	vStartKernelBenchmarkTask( mainBENCHMARK_TASK_PRIORITY );
+	xTaskCreate( prvMonitorTask, "Monitor", configMINIMAL_STACK_SIZE, NULL, mainMONITOR_TASK_PRIORITY, NULL );
+
+	/* Start the scheduler itself.  This only returns if the monitor task ends
+	the scheduler, or if there was not enough heap space to create the idle
+	and other system tasks. */
+	vTaskStartScheduler();
+
+	return ( ( xIsKernelBenchmarkComplete() != pdFALSE ) && ( xGetKernelBenchmarkStatus() == pdPASS ) ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvMonitorTask( void *pvParameters )
+{
+	/* Just to remove compiler warning. */
+	( void ) pvParameters;
+
+	while( xIsKernelBenchmarkComplete() == pdFALSE )
+	{
+		vTaskDelay( mainMONITOR_TASK_PERIOD );
+	}
+
+	vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
+
+unsigned long ulGetBenchmarkTimestamp( void )
+{
+struct timespec xNow;
+
+	/* Only differences between timestamps are used, so it does not matter that
+	the value wraps. */
+	clock_gettime( CLOCK_MONOTONIC, &xNow );
+	return ( unsigned long ) ( uint32_t ) ( ( ( uint64_t ) xNow.tv_sec * 1000000000ULL ) + ( uint64_t ) xNow.tv_nsec );
+}
+/*-----------------------------------------------------------*/
+
+void vBenchmarkPrintString( const char *pcString )
+{
+	fputs( pcString, stdout );
+}
+/*-----------------------------------------------------------*/
+
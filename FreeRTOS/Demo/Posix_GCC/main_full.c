@@ -0,0 +1,657 @@
+/*
+ * FreeRTOS Kernel V10.1.1
+ * Copyright (C) 2018 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ *******************************************************************************
+ * NOTE 1: The Posix port is a simulation only!  Do not expect to get real time
+ * behaviour from the Posix port or this demo application.  It is provided as a
+ * convenient development, test and measurement bed only.
+ *
+ * NOTE 2:  This file only contains the source code that is specific to the
+ * full demo.  Generic functions, such FreeRTOS hook functions, are defined in
+ * main.c.
+ *******************************************************************************
+ *
+ * main_full() creates all the demo application tasks, then starts the
+ * scheduler.  The web documentation provides more details of the standard demo
+ * application tasks, which provide no particular functionality but do provide a
+ * good example of how to use the FreeRTOS API.
+ *
+ * In addition to the standard demo tasks, the following tasks and tests are
+ * defined and/or created within this file:
+ *
+ * "Check" task - This only executes every two and a half seconds but has a
+ * high priority to ensure it gets processor time.  Its main function is to
+ * check that all the standard demo tasks are still operational.  While no
+ * errors have been discovered the check task will print out "No errors" and
+ * the current simulated tick time.  If an error is discovered in the execution
+ * of a task then the check task will print out an appropriate error message.
+ * If the demo was given a maximum run time then the check task also ends the
+ * scheduler once that time has elapsed, after which main_full() returns.
+ *
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Kernel includes. */
+#include <FreeRTOS.h>
+#include <task.h>
+#include <queue.h>
+#include <timers.h>
+#include <semphr.h>
+
+/* Standard demo includes. */
+#include "BlockQ.h"
+#include "integer.h"
+#include "semtest.h"
+#include "PollQ.h"
+#include "GenQTest.h"
+#include "QPeek.h"
+#include "recmutex.h"
+#include "flop.h"
+#include "TimerDemo.h"
+#include "countsem.h"
+#include "death.h"
+#include "dynamic.h"
+#include "QueueSet.h"
+#include "QueueOverwrite.h"
+#include "QueueBatch.h"
+#include "RWLockDemo.h"
+#include "EventGroupsDemo.h"
+#include "IntSemTest.h"
+#include "TaskNotify.h"
+#include "TaskNotifyArray.h"
+#include "QueueSetPolling.h"
+#include "StaticAllocation.h"
+#include "blocktim.h"
+#include "AbortDelay.h"
+#include "MessageBufferDemo.h"
+#include "StreamBufferDemo.h"
+#include "StreamBufferInterrupt.h"
+
+/* Priorities at which the tasks are created. */
+#define mainCHECK_TASK_PRIORITY			( configMAX_PRIORITIES - 2 )
+#define mainQUEUE_POLL_PRIORITY			( tskIDLE_PRIORITY + 1 )
+#define mainSEM_TEST_PRIORITY			( tskIDLE_PRIORITY + 1 )
+#define mainBLOCK_Q_PRIORITY			( tskIDLE_PRIORITY + 2 )
+#define mainCREATOR_TASK_PRIORITY		( tskIDLE_PRIORITY + 3 )
+#define mainINTEGER_TASK_PRIORITY		( tskIDLE_PRIORITY )
+#define mainGEN_QUEUE_TASK_PRIORITY		( tskIDLE_PRIORITY )
+#define mainFLOP_TASK_PRIORITY			( tskIDLE_PRIORITY )
+#define mainQUEUE_OVERWRITE_PRIORITY	( tskIDLE_PRIORITY )
+#define mainQUEUE_BATCH_PRIORITY		( tskIDLE_PRIORITY )
+#define mainRWLOCK_PRIORITY				( tskIDLE_PRIORITY + 1 )
+
+#define mainTIMER_TEST_PERIOD			( 50 )
+
+/* The frequency at which the check task executes. */
+#define mainCHECK_TASK_PERIOD			pdMS_TO_TICKS( 2500UL )
+
+/*-----------------------------------------------------------*/
+
+/* Task function prototypes. */
+static void prvCheckTask( void *pvParameters );
+
+/*
+ * Called from the idle task hook function to demonstrate a few utility
+ * functions that are not demonstrated by any of the standard demo tasks.
+ */
+static void prvDemonstrateTaskStateAndHandleGetFunctions( void );
+
+/*
+ * Called from the idle task hook function to demonstrate the use of
+ * xTimerPendFunctionCall() as xTimerPendFunctionCall() is not demonstrated by
+ * any of the standard demo tasks.
+ */
+static void prvDemonstratePendingFunctionCall( void );
+
+/*
+ * The function that is pended by prvDemonstratePendingFunctionCall().
+ */
+static void prvPendedFunction( void *pvParameter1, uint32_t ulParameter2 );
+
+/*
+ * Tasks that ensure indefinite delays are truly indefinite.
+ */
+static void prvPermanentlyBlockingSemaphoreTask( void *pvParameters );
+static void prvPermanentlyBlockingNotificationTask( void *pvParameters );
+
+/*-----------------------------------------------------------*/
+
+/* The variable into which error messages are latched. */
+static const char *pcStatusMessage = "No errors";
+
+/* Set to pdTRUE if the check task ever latches an error. */
+static volatile BaseType_t xErrorDetected = pdFALSE;
+
+/* The handle of the task created from prvPermanentlyBlockingSemaphoreTask().
+That task never runs again once it has blocked, so the check task expects its
+load to be zero. */
+static TaskHandle_t xPermanentlyBlockedTask = NULL;
+
+/*-----------------------------------------------------------*/
+
+int main_full( TickType_t xMaxRunTime )
+{
+	/* Start the check task as described at the top of this file.  The maximum
+	run time is passed in as the task's parameter. */
+	xTaskCreate( prvCheckTask, "Check", configMINIMAL_STACK_SIZE, ( void * ) ( size_t ) xMaxRunTime, mainCHECK_TASK_PRIORITY, NULL );
+
+	/* Create the standard demo tasks. */
+	vStartTaskNotifyTask();
+	vStartTaskNotifyArrayTask();
+	vStartBlockingQueueTasks( mainBLOCK_Q_PRIORITY );
+	vStartSemaphoreTasks( mainSEM_TEST_PRIORITY );
+	vStartPolledQueueTasks( mainQUEUE_POLL_PRIORITY );
+	vStartIntegerMathTasks( mainINTEGER_TASK_PRIORITY );
+	vStartGenericQueueTasks( mainGEN_QUEUE_TASK_PRIORITY );
+	vStartQueuePeekTasks();
+	vStartMathTasks( mainFLOP_TASK_PRIORITY );
+	vStartRecursiveMutexTasks();
+	vStartCountingSemaphoreTasks();
+	vStartDynamicPriorityTasks();
+	vStartQueueSetTasks();
+	vStartQueueOverwriteTask( mainQUEUE_OVERWRITE_PRIORITY );
+	vStartQueueBatchTasks( mainQUEUE_BATCH_PRIORITY );
+	vStartRWLockTasks( mainRWLOCK_PRIORITY );
+	vStartEventGroupTasks();
+	vStartInterruptSemaphoreTasks();
+	vStartQueueSetPollingTask();
+	vCreateBlockTimeTasks();
+	vCreateAbortDelayTasks();
+	xTaskCreate( prvPermanentlyBlockingSemaphoreTask, "BlockSem", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY, &xPermanentlyBlockedTask );
+	xTaskCreate( prvPermanentlyBlockingNotificationTask, "BlockNoti", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY, NULL );
+
+	vStartMessageBufferTasks( configMINIMAL_STACK_SIZE );
+	vStartStreamBufferTasks();
+	vStartStreamBufferInterruptDemo();
+
+	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	{
+		vStartStaticallyAllocatedTasks();
+	}
+	#endif
+
+	#if( configUSE_PREEMPTION != 0  )
+	{
+		/* Don't expect these tasks to pass when preemption is not used. */
+		vStartTimerDemoTask( mainTIMER_TEST_PERIOD );
+	}
+	#endif
+
+	/* The suicide tasks must be created last as they need to know how many
+	tasks were running prior to their creation.  This then allows them to
+	ascertain whether or not the correct/expected number of tasks are running at
+	any given time. */
+	vCreateSuicidalTasks( mainCREATOR_TASK_PRIORITY );
+
+	/* Start the scheduler itself.  This only returns if the check task ends
+	the scheduler, or if there was not enough heap space to create the idle
+	and other system tasks. */
+	vTaskStartScheduler();
+
+	return ( xErrorDetected == pdFALSE ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckTask( void *pvParameters )
+{
+TickType_t xNextWakeTime;
+const TickType_t xMaxRunTime = ( TickType_t ) ( size_t ) pvParameters;
+const TickType_t xStartTime = xTaskGetTickCount();
+TaskLoadWindow_t xBlockedTaskLoadWindow = { 0 };
+BaseType_t xFirstLoadWindow = pdTRUE;
+UBaseType_t uxBlockedTaskLoad;
+
+	/* Initialise xNextWakeTime - this only needs to be done once. */
+	xNextWakeTime = xStartTime;
+
+	for( ;; )
+	{
+		/* Place this task in the blocked state until it is time to run again. */
+		vTaskDelayUntil( &xNextWakeTime, mainCHECK_TASK_PERIOD );
+
+		/* Check the standard demo tasks are running without error. */
+		#if( configUSE_PREEMPTION != 0 )
+		{
+			/* These tasks are only created when preemption is used. */
+			if( xAreTimerDemoTasksStillRunning( mainCHECK_TASK_PERIOD ) != pdTRUE )
+			{
+				pcStatusMessage = "Error: TimerDemo";
+			}
+		}
+		#endif
+
+		if( xAreStreamBufferTasksStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error:  StreamBuffer";
+		}
+		else if( xAreMessageBufferTasksStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error:  MessageBuffer";
+		}
+		else if( xAreTaskNotificationTasksStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error:  Notification";
+		}
+		else if( xAreTaskNotificationArrayTasksStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error:  Notification array";
+		}
+		else if( xAreInterruptSemaphoreTasksStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: IntSem";
+		}
+		else if( xAreEventGroupTasksStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: EventGroup";
+		}
+		else if( xAreIntegerMathsTaskStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: IntMath";
+		}
+		else if( xAreGenericQueueTasksStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: GenQueue";
+		}
+		else if( xAreQueuePeekTasksStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: QueuePeek";
+		}
+		else if( xAreBlockingQueuesStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: BlockQueue";
+		}
+		else if( xAreSemaphoreTasksStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: SemTest";
+		}
+		else if( xArePollingQueuesStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: PollQueue";
+		}
+		else if( xAreMathsTaskStillRunning() != pdPASS )
+		{
+			pcStatusMessage = "Error: Flop";
+		}
+		else if( xAreRecursiveMutexTasksStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: RecMutex";
+		}
+		else if( xAreCountingSemaphoreTasksStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: CountSem";
+		}
+		else if( xIsCreateTaskStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: Death";
+		}
+		else if( xAreDynamicPriorityTasksStillRunning() != pdPASS )
+		{
+			pcStatusMessage = "Error: Dynamic";
+		}
+		else if( xAreQueueSetTasksStillRunning() != pdPASS )
+		{
+			pcStatusMessage = "Error: Queue set";
+		}
+		else if( xIsQueueOverwriteTaskStillRunning() != pdPASS )
+		{
+			pcStatusMessage = "Error: Queue overwrite";
+		}
+		else if( xAreQueueBatchTasksStillRunning() != pdPASS )
+		{
+			pcStatusMessage = "Error: Queue batch";
+		}
+		else if( xAreRWLockTasksStillRunning() != pdPASS )
+		{
+			pcStatusMessage = "Error: RW lock";
+		}
+		else if( xAreQueueSetPollTasksStillRunning() != pdPASS )
+		{
+			pcStatusMessage = "Error: Queue set polling";
+		}
+		else if( xAreBlockTimeTestTasksStillRunning() != pdPASS )
+		{
+			pcStatusMessage = "Error: Block time";
+		}
+		else if( xAreAbortDelayTestTasksStillRunning() != pdPASS )
+		{
+			pcStatusMessage = "Error: Abort delay";
+		}
+		else if( xIsInterruptStreamBufferDemoStillRunning() != pdPASS )
+		{
+			pcStatusMessage = "Error: Stream buffer interrupt";
+		}
+
+		#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+			else if( xAreStaticAllocationTasksStillRunning() != pdPASS )
+			{
+				pcStatusMessage = "Error: Static allocation";
+			}
+		#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+		/* The permanently blocked task has not run since the previous check,
+		so its load over the window since then must be exactly zero, however
+		busy the host is.  The first window includes the time the task ran
+		before it blocked, so is not checked. */
+		uxBlockedTaskLoad = uxTaskGetLoadOverWindow( xPermanentlyBlockedTask, &xBlockedTaskLoadWindow );
+
+		if( ( xFirstLoadWindow == pdFALSE ) && ( uxBlockedTaskLoad != ( UBaseType_t ) 0 ) )
+		{
+			pcStatusMessage = "Error: Task load";
+		}
+
+		xFirstLoadWindow = pdFALSE;
+
+		if( strcmp( pcStatusMessage, "No errors" ) != 0 )
+		{
+			xErrorDetected = pdTRUE;
+		}
+
+		/* This is the only task that uses stdout so its ok to call printf()
+		directly. */
+		printf( "%s - tick count %u - free heap %u - min free heap %u\r\n", pcStatusMessage,
+																			   ( unsigned ) xTaskGetTickCount(),
+																			   ( unsigned ) xPortGetFreeHeapSize(),
+																			   ( unsigned ) xPortGetMinimumEverFreeHeapSize() );
+		fflush( stdout );
+
+		if( ( xMaxRunTime != 0 ) && ( ( xTaskGetTickCount() - xStartTime ) >= xMaxRunTime ) )
+		{
+			/* Return to main_full(). */
+			vTaskEndScheduler();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* Called from vApplicationIdleHook(), which is defined in main.c. */
+void vFullDemoIdleFunction( void )
+{
+const useconds_t xUSToSleep = 1000;
+
+	/* Sleep to reduce CPU load.  The sleep is cut short by the next tick
+	interrupt anyway. */
+	usleep( xUSToSleep );
+
+	/* Demonstrate a few utility functions that are not demonstrated by any of
+	the standard demo tasks. */
+	prvDemonstrateTaskStateAndHandleGetFunctions();
+
+	/* Demonstrate the use of xTimerPendFunctionCall(), which is not
+	demonstrated by any of the standard demo tasks. */
+	prvDemonstratePendingFunctionCall();
+}
+/*-----------------------------------------------------------*/
+
+/* Called by vApplicationTickHook(), which is defined in main.c. */
+void vFullDemoTickHookFunction( void )
+{
+	/* Call the periodic timer test, which tests the timer API functions that
+	can be called from an ISR. */
+	#if( configUSE_PREEMPTION != 0 )
+	{
+		/* Only created when preemption is used. */
+		vTimerPeriodicISRTests();
+	}
+	#endif
+
+	/* Call the periodic queue overwrite from ISR demo. */
+	vQueueOverwritePeriodicISRDemo();
+
+	/* Call the periodic queue batch send and receive from ISR demo. */
+	vQueueBatchPeriodicISRDemo();
+
+	/* Call the periodic reader-writer lock from ISR demo. */
+	vRWLockPeriodicISRDemo();
+
+	/* Write to a queue that is in use as part of the queue set demo to
+	demonstrate using queue sets from an ISR. */
+	vQueueSetAccessQueueSetFromISR();
+	vQueueSetPollingInterruptAccess();
+
+	/* Exercise event groups from interrupts. */
+	vPeriodicEventGroupsProcessing();
+
+	/* Exercise giving mutexes from an interrupt. */
+	vInterruptSemaphorePeriodicTest();
+
+	/* Exercise using task notifications from an interrupt. */
+	xNotifyTaskFromISR();
+
+	/* Writes to stream buffer byte by byte to test the stream buffer trigger
+	level functionality. */
+	vPeriodicStreamBufferProcessing();
+
+	/* Writes a string to a string buffer four bytes at a time to demonstrate
+	a stream being sent from an interrupt to a task. */
+	vBasicStreamBufferSendFromISR();
+}
+/*-----------------------------------------------------------*/
+
+static void prvPendedFunction( void *pvParameter1, uint32_t ulParameter2 )
+{
+static uint32_t ulLastParameter1 = 1000UL, ulLastParameter2 = 0UL;
+uint32_t ulParameter1;
+
+	ulParameter1 = ( uint32_t ) ( size_t ) pvParameter1;
+
+	/* Ensure the parameters are as expected. */
+	configASSERT( ulParameter1 == ( ulLastParameter1 + 1 ) );
+	configASSERT( ulParameter2 == ( ulLastParameter2 + 1 ) );
+
+	/* Remember the parameters for the next time the function is called. */
+	ulLastParameter1 = ulParameter1;
+	ulLastParameter2 = ulParameter2;
+}
+/*-----------------------------------------------------------*/
+
+static void prvDemonstratePendingFunctionCall( void )
+{
+static uint32_t ulParameter1 = 1000UL, ulParameter2 = 0UL;
+const TickType_t xDontBlock = 0; /* This is called from the idle task so must *not* attempt to block. */
+
+	/* prvPendedFunction() just expects the parameters to be incremented by one
+	each time it is called.  The parameters are only incremented if the call is
+	pended successfully, as the timer queue might be full. */
+	if( xTimerPendFunctionCall( prvPendedFunction, ( void * ) ( size_t ) ( ulParameter1 + 1 ), ulParameter2 + 1, xDontBlock ) == pdPASS )
+	{
+		ulParameter1++;
+		ulParameter2++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvDemonstrateTaskStateAndHandleGetFunctions( void )
+{
+TaskHandle_t xIdleTaskHandle, xTimerTaskHandle;
+TaskStatus_t xTaskInfo;
+TaskStatusIterator_t xIterator;
+UBaseType_t uxIdleTaskReports = 0, uxTimerTaskReports = 0;
+configRUN_TIME_COUNTER_TYPE ulIdleRunTime;
+static configRUN_TIME_COUNTER_TYPE ulLastIdleRunTime = 0;
+extern StackType_t uxTimerTaskStack[];
+
+	/* Demonstrate the use of the xTimerGetTimerDaemonTaskHandle() and
+	xTaskGetIdleTaskHandle() functions. */
+	xIdleTaskHandle = xTaskGetIdleTaskHandle();
+	xTimerTaskHandle = xTimerGetTimerDaemonTaskHandle();
+
+	/* This is the idle hook, so the current task handle should equal the
+	returned idle task handle. */
+	if( xTaskGetCurrentTaskHandle() != xIdleTaskHandle )
+	{
+		pcStatusMessage = "Error:  Returned idle task handle was incorrect";
+	}
+
+	/* Check the same handle is obtained using the idle task's name.  First try
+	with the wrong name, then the right name. */
+	if( xTaskGetHandle( "Idle" ) == xIdleTaskHandle )
+	{
+		pcStatusMessage = "Error:  Returned handle for name Idle was incorrect";
+	}
+
+	if( xTaskGetHandle( "IDLE" ) != xIdleTaskHandle )
+	{
+		pcStatusMessage = "Error:  Returned handle for name Idle was incorrect";
+	}
+
+	/* Check the timer task handle was returned correctly. */
+	if( strcmp( pcTaskGetName( xTimerTaskHandle ), "Tmr Svc" ) != 0 )
+	{
+		pcStatusMessage = "Error:  Returned timer task handle was incorrect";
+	}
+
+	if( xTaskGetHandle( "Tmr Svc" ) != xTimerTaskHandle )
+	{
+		pcStatusMessage = "Error:  Returned handle for name Tmr Svc was incorrect";
+	}
+
+	/* This task is running, make sure it's state is returned as running. */
+	if( eTaskGetState( xIdleTaskHandle ) != eRunning )
+	{
+		pcStatusMessage = "Error:  Returned idle task state was incorrect";
+	}
+
+	/* Also with the vTaskGetInfo() function. */
+	vTaskGetInfo( xTimerTaskHandle, /* The task being queried. */
+				  &xTaskInfo,		/* The structure into which information on the task will be written. */
+				  pdFALSE,			/* Don't scan the stack for its high water mark, which is checked separately below. */
+				  eInvalid );		/* Include the task state in the structure. */
+
+	/* Check the information returned by vTaskGetInfo() is as expected. */
+	if( ( strcmp( xTaskInfo.pcTaskName, "Tmr Svc" ) != 0 )			 ||
+		( xTaskInfo.uxCurrentPriority != configTIMER_TASK_PRIORITY ) ||
+		( xTaskInfo.pxStackBase != uxTimerTaskStack )				 ||
+		( xTaskInfo.xHandle != xTimerTaskHandle ) )
+	{
+		pcStatusMessage = "Error:  vTaskGetInfo() returned incorrect information about the timer task";
+	}
+
+	#if( configUSE_STACK_WATERMARK == 1 )
+	{
+		/* The estimated stack high water mark can be higher than the value
+		found by scanning the whole stack, but never lower. */
+		if( ( uxTaskGetStackWatermark( xTimerTaskHandle ) < uxTaskGetStackHighWaterMark2( xTimerTaskHandle ) ) ||
+			( uxTaskGetStackWatermark( xTimerTaskHandle ) == ( configSTACK_DEPTH_TYPE ) 0 ) )
+		{
+			pcStatusMessage = "Error:  uxTaskGetStackWatermark() returned an incorrect value for the timer task";
+		}
+	}
+	#endif /* configUSE_STACK_WATERMARK */
+
+	/* Report each task in turn with the task status iterator.  The idle and
+	timer tasks are never deleted so must each be reported exactly once, and
+	as this is the idle hook the idle task must be reported as running. */
+	vTaskStatusIteratorInitialise( &xIterator );
+
+	while( xTaskStatusIteratorNext( &xIterator, &xTaskInfo ) != pdFALSE )
+	{
+		if( xTaskInfo.xHandle == xIdleTaskHandle )
+		{
+			uxIdleTaskReports++;
+
+			if( xTaskInfo.eCurrentState != eRunning )
+			{
+				pcStatusMessage = "Error:  Task status iterator returned an incorrect idle task state";
+			}
+		}
+		else if( xTaskInfo.xHandle == xTimerTaskHandle )
+		{
+			uxTimerTaskReports++;
+
+			#if( configUSE_STACK_WATERMARK == 1 )
+			{
+				/* The watermark can only fall after it has been reported. */
+				if( xTaskInfo.usStackHighWaterMark < uxTaskGetStackWatermark( xTimerTaskHandle ) )
+				{
+					pcStatusMessage = "Error:  Task status iterator returned an incorrect timer task stack watermark";
+				}
+			}
+			#endif /* configUSE_STACK_WATERMARK */
+		}
+	}
+
+	if( ( uxIdleTaskReports != 1 ) || ( uxTimerTaskReports != 1 ) )
+	{
+		pcStatusMessage = "Error:  Task status iterator did not report each task once";
+	}
+
+	/* The run time of the idle task includes the time since it was switched
+	in, as it is the running task, so must have increased since the last time
+	this function was called. */
+	ulIdleRunTime = ulTaskGetRunTimeCounter( xIdleTaskHandle );
+
+	if( ulIdleRunTime <= ulLastIdleRunTime )
+	{
+		pcStatusMessage = "Error:  Idle task run time counter did not increase";
+	}
+
+	ulLastIdleRunTime = ulIdleRunTime;
+}
+/*-----------------------------------------------------------*/
+
+static void prvPermanentlyBlockingSemaphoreTask( void *pvParameters )
+{
+SemaphoreHandle_t xSemaphore;
+
+	/* Prevent compiler warning about unused parameter in the case that
+	configASSERT() is not defined. */
+	( void ) pvParameters;
+
+	/* This task should block on a semaphore, and never return. */
+	xSemaphore = xSemaphoreCreateBinary();
+	configASSERT( xSemaphore );
+
+	xSemaphoreTake( xSemaphore, portMAX_DELAY );
+
+	/* The above xSemaphoreTake() call should never return, force an assert if
+	it does. */
+	configASSERT( pvParameters != NULL );
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvPermanentlyBlockingNotificationTask( void *pvParameters )
+{
+	/* Prevent compiler warning about unused parameter in the case that
+	configASSERT() is not defined. */
+	( void ) pvParameters;
+
+	/* This task should block on a task notification, and never return. */
+	ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+	/* The above ulTaskNotifyTake() call should never return, force an assert
+	if it does. */
+	configASSERT( pvParameters != NULL );
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
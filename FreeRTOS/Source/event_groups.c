@@ -38,6 +38,7 @@ task.h is included from an application file. */
 #include "task.h"
 #include "timers.h"
 #include "event_groups.h"
+#include "object_pool.h"
 
 /* Lint e961, e750 and e9021 are suppressed as a MISRA exception justified
 because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
@@ -60,10 +61,20 @@ taskEVENT_LIST_ITEM_VALUE_IN_USE definition. */
 	#define eventEVENT_BITS_CONTROL_BYTES	0xff000000UL
 #endif
 
+/* The number of bits in an event group that are available to the application,
+and therefore the number of lists in the waiter index when
+configUSE_EVENT_GROUP_WAITER_INDEX is 1. */
+#define eventNUM_BIT_LISTS	( ( sizeof( EventBits_t ) * ( size_t ) 8 ) - ( size_t ) 8 )
+
 typedef struct EventGroupDef_t
 {
 	EventBits_t uxEventBits;
-	List_t xTasksWaitingForBits;		/*< List of tasks waiting for a bit to be set. */
+	List_t xTasksWaitingForBits;		/*< List of tasks waiting for a bit to be set.  When configUSE_EVENT_GROUP_WAITER_INDEX is 1 only tasks waiting for any one of several bits are held here. */
+
+	#if( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+		List_t xTasksWaitingForBit[ eventNUM_BIT_LISTS ]; /*< All other waiting tasks, indexed by a bit they are waiting for that was not set when they were placed in the list. */
+		EventBits_t uxBitsWaitedForByAny;	/*< The bits waited for by the tasks in xTasksWaitingForBits.  Can include bits no task is still waiting for. */
+	#endif
 
 	#if( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t uxEventGroupNumber;
@@ -74,6 +85,17 @@ typedef struct EventGroupDef_t
 	#endif
 } EventGroup_t;
 
+/* Event groups that are created dynamically are taken from a pool, rather than
+the heap, when configEVENT_GROUP_POOL_SIZE is not 0. */
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configEVENT_GROUP_POOL_SIZE > 0 ) )
+	objectpoolDEFINE_POOL( xEventGroupPool, ucEventGroupPoolStorage, sizeof( EventGroup_t ), configEVENT_GROUP_POOL_SIZE );
+	#define eventMALLOC( xSize )	pvObjectPoolMalloc( &xEventGroupPool, ( xSize ) )
+	#define eventFREE( pv )			vObjectPoolFree( &xEventGroupPool, ( pv ) )
+#else
+	#define eventMALLOC( xSize )	pvPortMalloc( xSize )
+	#define eventFREE( pv )			vPortFree( pv )
+#endif /* configEVENT_GROUP_POOL_SIZE */
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -86,6 +108,34 @@ typedef struct EventGroupDef_t
  */
 static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, const EventBits_t uxBitsToWaitFor, const BaseType_t xWaitForAllBits ) PRIVILEGED_FUNCTION;
 
+/*
+ * Return the list a task waiting for uxBitsToWaitFor is placed in when it
+ * blocks on the event group.
+ */
+static List_t *prvGetWaitingList( EventGroup_t *pxEventBits, const EventBits_t uxBitsToWaitFor, const BaseType_t xWaitForAllBits ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblock the tasks in pxList whose wait condition is met by the current value
+ * of the event group.  Returns the bits that must be cleared because a task it
+ * unblocked specified eventCLEAR_EVENTS_ON_EXIT_BIT.  *puxTasksScanned is
+ * incremented for each task examined.
+ */
+static EventBits_t prvUnblockWaitingTasks( EventGroup_t *pxEventBits, List_t *pxList, UBaseType_t *puxTasksScanned ) PRIVILEGED_FUNCTION;
+
+#if( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+
+	/*
+	 * Initialise the lists of the waiter index.
+	 */
+	static void prvInitialiseWaiterIndex( EventGroup_t *pxEventBits ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Return the number of the lowest bit set in uxBits, which must not be 0.
+	 */
+	static UBaseType_t prvLowestBitNumber( EventBits_t uxBits ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_EVENT_GROUP_WAITER_INDEX */
+
 /*-----------------------------------------------------------*/
 
 #if( configSUPPORT_STATIC_ALLOCATION == 1 )
@@ -115,6 +165,12 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, co
 			pxEventBits->uxEventBits = 0;
 			vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
 
+			#if( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+			{
+				prvInitialiseWaiterIndex( pxEventBits );
+			}
+			#endif /* configUSE_EVENT_GROUP_WAITER_INDEX */
+
 			#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
 			{
 				/* Both static and dynamic allocation can be used, so note that
@@ -159,13 +215,19 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, co
 		sizeof( TickType_t ), the TickType_t variables will be accessed in two
 		or more reads operations, and the alignment requirements is only that
 		of each individual read. */
-		pxEventBits = ( EventGroup_t * ) pvPortMalloc( sizeof( EventGroup_t ) ); /*lint !e9087 !e9079 see comment above. */
+		pxEventBits = ( EventGroup_t * ) eventMALLOC( sizeof( EventGroup_t ) ); /*lint !e9087 !e9079 see comment above. */
 
 		if( pxEventBits != NULL )
 		{
 			pxEventBits->uxEventBits = 0;
 			vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
 
+			#if( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+			{
+				prvInitialiseWaiterIndex( pxEventBits );
+			}
+			#endif /* configUSE_EVENT_GROUP_WAITER_INDEX */
+
 			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 			{
 				/* Both static and dynamic allocation can be used, so note this
@@ -229,7 +291,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 				/* Store the bits that the calling task is waiting for in the
 				task's event list item so the kernel knows when a match is
 				found.  Then enter the blocked state. */
-				vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
+				vTaskPlaceOnUnorderedEventList( prvGetWaitingList( pxEventBits, uxBitsToWaitFor, pdTRUE ), ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
 
 				/* This assignment is obsolete as uxReturn will get set after
 				the task unblocks, but some compilers mistakenly generate a
@@ -384,7 +446,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 			/* Store the bits that the calling task is waiting for in the
 			task's event list item so the kernel knows when a match is
 			found.  Then enter the blocked state. */
-			vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
+			vTaskPlaceOnUnorderedEventList( prvGetWaitingList( pxEventBits, uxBitsToWaitFor, xWaitForAllBits ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
 
 			/* This is obsolete as it will get set after the task unblocks, but
 			some compilers mistakenly generate a warning about the variable
@@ -518,87 +580,66 @@ EventBits_t uxReturn;
 
 EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet )
 {
-ListItem_t *pxListItem, *pxNext;
-ListItem_t const *pxListEnd;
-List_t const * pxList;
-EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits;
+EventBits_t uxBitsToClear = 0;
 EventGroup_t *pxEventBits = xEventGroup;
-BaseType_t xMatchFound = pdFALSE;
+UBaseType_t uxTasksScanned = 0;
+#if( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+	EventBits_t uxBitsToCheck;
+	UBaseType_t uxBitNumber;
+#endif
 
 	/* Check the user is not attempting to set the bits used by the kernel
 	itself. */
 	configASSERT( xEventGroup );
 	configASSERT( ( uxBitsToSet & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
 
-	pxList = &( pxEventBits->xTasksWaitingForBits );
-	pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
 	vTaskSuspendAll();
 	{
 		traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet );
 
-		pxListItem = listGET_HEAD_ENTRY( pxList );
-
 		/* Set the bits. */
 		pxEventBits->uxEventBits |= uxBitsToSet;
 
 		/* See if the new bit value should unblock any tasks. */
-		while( pxListItem != pxListEnd )
+		#if( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
 		{
-			pxNext = listGET_NEXT( pxListItem );
-			uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
-			xMatchFound = pdFALSE;
-
-			/* Split the bits waited for from the control bits. */
-			uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
-			uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
-
-			if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
+			/* A task in the index is indexed by a bit that was not set, and
+			cannot unblock until that bit is set, so only the lists of the bits
+			being set need to be checked. */
+			uxBitsToCheck = uxBitsToSet;
+			for( uxBitNumber = 0; uxBitsToCheck != ( EventBits_t ) 0; uxBitNumber++ )
 			{
-				/* Just looking for single bit being set. */
-				if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) != ( EventBits_t ) 0 )
+				if( ( ( uxBitsToCheck & ( EventBits_t ) 1 ) != ( EventBits_t ) 0 ) && ( listLIST_IS_EMPTY( &( pxEventBits->xTasksWaitingForBit[ uxBitNumber ] ) ) == pdFALSE ) )
 				{
-					xMatchFound = pdTRUE;
+					uxBitsToClear |= prvUnblockWaitingTasks( pxEventBits, &( pxEventBits->xTasksWaitingForBit[ uxBitNumber ] ), &uxTasksScanned );
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
+
+				uxBitsToCheck >>= 1;
 			}
-			else if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) == uxBitsWaitedFor )
+
+			/* None of the bits waited for by tasks waiting for any one of
+			several bits are set, so those tasks only need to be checked if one
+			of their bits is being set. */
+			if( ( uxBitsToSet & pxEventBits->uxBitsWaitedForByAny ) != ( EventBits_t ) 0 )
 			{
-				/* All bits are set. */
-				xMatchFound = pdTRUE;
+				uxBitsToClear |= prvUnblockWaitingTasks( pxEventBits, &( pxEventBits->xTasksWaitingForBits ), &uxTasksScanned );
 			}
 			else
 			{
-				/* Need all bits to be set, but not all the bits were set. */
-			}
-
-			if( xMatchFound != pdFALSE )
-			{
-				/* The bits match.  Should the bits be cleared on exit? */
-				if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
-				{
-					uxBitsToClear |= uxBitsWaitedFor;
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
-
-				/* Store the actual event flag value in the task's event list
-				item before removing the task from the event list.  The
-				eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
-				that is was unblocked due to its required bits matching, rather
-				than because it timed out. */
-				vTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+				mtCOVERAGE_TEST_MARKER();
 			}
-
-			/* Move onto the next list item.  Note pxListItem->pxNext is not
-			used here as the list item may have been removed from the event list
-			and inserted into the ready/pending reading list. */
-			pxListItem = pxNext;
 		}
+		#else
+		{
+			uxBitsToClear = prvUnblockWaitingTasks( pxEventBits, &( pxEventBits->xTasksWaitingForBits ), &uxTasksScanned );
+		}
+		#endif /* configUSE_EVENT_GROUP_WAITER_INDEX */
+
+		traceEVENT_GROUP_SET_BITS_TASKS_SCANNED( xEventGroup, uxTasksScanned );
 
 		/* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
 		bit was set in the control word. */
@@ -614,6 +655,9 @@ void vEventGroupDelete( EventGroupHandle_t xEventGroup )
 {
 EventGroup_t *pxEventBits = xEventGroup;
 const List_t *pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBits );
+#if( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+	UBaseType_t uxBitNumber;
+#endif
 
 	vTaskSuspendAll();
 	{
@@ -627,11 +671,26 @@ const List_t *pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBits );
 			vTaskRemoveFromUnorderedEventList( pxTasksWaitingForBits->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
 		}
 
+		#if( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+		{
+			/* Likewise unblock the tasks held in the waiter index. */
+			for( uxBitNumber = 0; uxBitNumber < ( UBaseType_t ) eventNUM_BIT_LISTS; uxBitNumber++ )
+			{
+				pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBit[ uxBitNumber ] );
+
+				while( listCURRENT_LIST_LENGTH( pxTasksWaitingForBits ) > ( UBaseType_t ) 0 )
+				{
+					vTaskRemoveFromUnorderedEventList( pxTasksWaitingForBits->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
+				}
+			}
+		}
+		#endif /* configUSE_EVENT_GROUP_WAITER_INDEX */
+
 		#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
 		{
 			/* The event group can only have been allocated dynamically - free
 			it again. */
-			vPortFree( pxEventBits );
+			eventFREE( pxEventBits );
 		}
 		#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
 		{
@@ -639,7 +698,7 @@ const List_t *pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBits );
 			dynamically, so check before attempting to free the memory. */
 			if( pxEventBits->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
 			{
-				vPortFree( pxEventBits );
+				eventFREE( pxEventBits );
 			}
 			else
 			{
@@ -703,6 +762,202 @@ BaseType_t xWaitConditionMet = pdFALSE;
 }
 /*-----------------------------------------------------------*/
 
+static EventBits_t prvUnblockWaitingTasks( EventGroup_t *pxEventBits, List_t *pxList, UBaseType_t *puxTasksScanned )
+{
+ListItem_t *pxListItem, *pxNext;
+ListItem_t const *pxListEnd;
+EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits;
+BaseType_t xMatchFound;
+#if( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+	EventBits_t uxBitsStillWaitedFor = 0;
+#endif
+
+	pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+	pxListItem = listGET_HEAD_ENTRY( pxList );
+
+	while( pxListItem != pxListEnd )
+	{
+		pxNext = listGET_NEXT( pxListItem );
+		uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
+		xMatchFound = pdFALSE;
+		( *puxTasksScanned )++;
+
+		/* Split the bits waited for from the control bits. */
+		uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
+		uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+
+		if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
+		{
+			/* Just looking for single bit being set. */
+			if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) != ( EventBits_t ) 0 )
+			{
+				xMatchFound = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) == uxBitsWaitedFor )
+		{
+			/* All bits are set. */
+			xMatchFound = pdTRUE;
+		}
+		else
+		{
+			/* Need all bits to be set, but not all the bits were set. */
+		}
+
+		if( xMatchFound != pdFALSE )
+		{
+			/* The bits match.  Should the bits be cleared on exit? */
+			if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
+			{
+				uxBitsToClear |= uxBitsWaitedFor;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Store the actual event flag value in the task's event list
+			item before removing the task from the event list.  The
+			eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
+			that is was unblocked due to its required bits matching, rather
+			than because it timed out. */
+			vTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+		}
+		else
+		{
+			#if( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+			{
+				if( pxList == &( pxEventBits->xTasksWaitingForBits ) )
+				{
+					uxBitsStillWaitedFor |= uxBitsWaitedFor;
+				}
+				else
+				{
+					/* The task is waiting for all of several bits, and the bit
+					it was indexed by is now set.  Move it to the list of a bit
+					it is waiting for that is not set.  That bit is not being
+					set, so the task is not examined again until it is. */
+					( void ) uxListRemove( pxListItem );
+					vListInsertEnd( &( pxEventBits->xTasksWaitingForBit[ prvLowestBitNumber( uxBitsWaitedFor & ~( pxEventBits->uxEventBits ) ) ] ), pxListItem );
+				}
+			}
+			#endif /* configUSE_EVENT_GROUP_WAITER_INDEX */
+		}
+
+		/* Move onto the next list item.  Note pxListItem->pxNext is not
+		used here as the list item may have been removed from the event list
+		and inserted into the ready/pending reading list. */
+		pxListItem = pxNext;
+	}
+
+	#if( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+	{
+		/* Forget the bits that were only waited for by the tasks that were
+		unblocked. */
+		if( pxList == &( pxEventBits->xTasksWaitingForBits ) )
+		{
+			pxEventBits->uxBitsWaitedForByAny = uxBitsStillWaitedFor;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configUSE_EVENT_GROUP_WAITER_INDEX */
+
+	return uxBitsToClear;
+}
+/*-----------------------------------------------------------*/
+
+static List_t *prvGetWaitingList( EventGroup_t *pxEventBits, const EventBits_t uxBitsToWaitFor, const BaseType_t xWaitForAllBits )
+{
+List_t *pxList;
+
+	#if( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+	{
+	EventBits_t uxBitsNotSet;
+
+		if( ( xWaitForAllBits == pdFALSE ) && ( ( uxBitsToWaitFor & ( uxBitsToWaitFor - ( EventBits_t ) 1 ) ) != ( EventBits_t ) 0 ) )
+		{
+			/* Waiting for any one of several bits, any of which can unblock
+			the task. */
+			pxEventBits->uxBitsWaitedForByAny |= uxBitsToWaitFor;
+			pxList = &( pxEventBits->xTasksWaitingForBits );
+		}
+		else
+		{
+			/* Waiting for all of the bits, or for a single bit, so the task
+			cannot unblock until every bit it is waiting for is set.  Index it
+			by one that is not set yet. */
+			uxBitsNotSet = uxBitsToWaitFor & ~( pxEventBits->uxEventBits );
+
+			if( uxBitsNotSet == ( EventBits_t ) 0 )
+			{
+				/* Only possible if the bits were set by the task that is
+				about to block, in which case any of the bits will do. */
+				uxBitsNotSet = uxBitsToWaitFor;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxList = &( pxEventBits->xTasksWaitingForBit[ prvLowestBitNumber( uxBitsNotSet ) ] );
+		}
+	}
+	#else
+	{
+		( void ) uxBitsToWaitFor;
+		( void ) xWaitForAllBits;
+		pxList = &( pxEventBits->xTasksWaitingForBits );
+	}
+	#endif /* configUSE_EVENT_GROUP_WAITER_INDEX */
+
+	return pxList;
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+
+	static void prvInitialiseWaiterIndex( EventGroup_t *pxEventBits )
+	{
+	UBaseType_t uxBitNumber;
+
+		for( uxBitNumber = 0; uxBitNumber < ( UBaseType_t ) eventNUM_BIT_LISTS; uxBitNumber++ )
+		{
+			vListInitialise( &( pxEventBits->xTasksWaitingForBit[ uxBitNumber ] ) );
+		}
+
+		pxEventBits->uxBitsWaitedForByAny = 0;
+	}
+
+#endif /* configUSE_EVENT_GROUP_WAITER_INDEX */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+
+	static UBaseType_t prvLowestBitNumber( EventBits_t uxBits )
+	{
+	UBaseType_t uxBitNumber = 0;
+
+		configASSERT( uxBits != ( EventBits_t ) 0 );
+
+		while( ( uxBits & ( EventBits_t ) 1 ) == ( EventBits_t ) 0 )
+		{
+			uxBits >>= 1;
+			uxBitNumber++;
+		}
+
+		return uxBitNumber;
+	}
+
+#endif /* configUSE_EVENT_GROUP_WAITER_INDEX */
+/*-----------------------------------------------------------*/
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
 
 	BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet, BaseType_t *pxHigherPriorityTaskWoken )
@@ -55,6 +55,12 @@ extern "C" {
 /* Application specific configuration options. */
 #include "FreeRTOSConfig.h"
 
+/* Must be defaulted before portable.h is included as ports that provide a run
+time counter implementation use it. */
+#ifndef configRUN_TIME_COUNTER_TYPE
+	#define configRUN_TIME_COUNTER_TYPE uint32_t
+#endif
+
 /* Basic FreeRTOS definitions. */
 #include "projdefs.h"
 
@@ -234,6 +240,22 @@ extern "C" {
 	#error configMAX_TASK_NAME_LEN must be set to a minimum of 1 in FreeRTOSConfig.h
 #endif
 
+#ifndef configUSE_TASK_NAME_REGISTRY
+	#define configUSE_TASK_NAME_REGISTRY 0
+#endif
+
+#ifndef configTASK_NAME_REGISTRY_SIZE
+	#define configTASK_NAME_REGISTRY_SIZE 16
+#endif
+
+#if( ( configUSE_TASK_NAME_REGISTRY == 1 ) && ( INCLUDE_xTaskGetHandle != 1 ) )
+	#error The task name registry is only used by xTaskGetHandle(), so INCLUDE_xTaskGetHandle must be set to 1 in FreeRTOSConfig.h when configUSE_TASK_NAME_REGISTRY is 1
+#endif
+
+#if( ( configTASK_NAME_REGISTRY_SIZE < 1 ) || ( ( configTASK_NAME_REGISTRY_SIZE & ( configTASK_NAME_REGISTRY_SIZE - 1 ) ) != 0 ) )
+	#error configTASK_NAME_REGISTRY_SIZE must be a power of 2
+#endif
+
 #ifndef configASSERT
 	#define configASSERT( x )
 	#define configASSERT_DEFINED 0
@@ -382,6 +404,17 @@ extern "C" {
 	#define configRECORD_STACK_HIGH_ADDRESS 0
 #endif
 
+#ifndef configUSE_STACK_WATERMARK
+	#define configUSE_STACK_WATERMARK 0
+#endif
+
+#ifndef configSTACK_WATERMARK_SCAN_BYTES
+	/* The number of stack bytes the idle task examines on each iteration when
+	configUSE_STACK_WATERMARK is 1.  Set to 0 to only record the deepest stack
+	pointer seen at each context switch. */
+	#define configSTACK_WATERMARK_SCAN_BYTES 16
+#endif
+
 #ifndef configINCLUDE_FREERTOS_TASK_C_ADDITIONS_H
 	#define configINCLUDE_FREERTOS_TASK_C_ADDITIONS_H 0
 #endif
@@ -528,6 +561,13 @@ extern "C" {
 	#define traceTASK_INCREMENT_TICK( xTickCount )
 #endif
 
+#ifndef traceTASK_CATCH_UP_PENDED_TICKS
+	/* Called once by xTaskResumeAll() when the ticks that occurred while the
+	scheduler was suspended are processed, in place of a
+	traceTASK_INCREMENT_TICK() call per tick. */
+	#define traceTASK_CATCH_UP_PENDED_TICKS( xTicksToCatchUp )
+#endif
+
 #ifndef traceTIMER_CREATE
 	#define traceTIMER_CREATE( pxNewTimer )
 #endif
@@ -592,6 +632,10 @@ extern "C" {
 	#define traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet )
 #endif
 
+#ifndef traceEVENT_GROUP_SET_BITS_TASKS_SCANNED
+	#define traceEVENT_GROUP_SET_BITS_TASKS_SCANNED( xEventGroup, uxTasksScanned )
+#endif
+
 #ifndef traceEVENT_GROUP_SET_BITS_FROM_ISR
 	#define traceEVENT_GROUP_SET_BITS_FROM_ISR( xEventGroup, uxBitsToSet )
 #endif
@@ -770,6 +814,22 @@ extern "C" {
 	#define configUSE_TIME_SLICING 1
 #endif
 
+#ifndef configUSE_DELAYED_TASK_WHEEL
+	#define configUSE_DELAYED_TASK_WHEEL 0
+#endif
+
+#ifndef configDELAYED_TASK_WHEEL_SIZE
+	#define configDELAYED_TASK_WHEEL_SIZE 32
+#endif
+
+#ifndef configUSE_TIMER_WHEEL
+	#define configUSE_TIMER_WHEEL 0
+#endif
+
+#ifndef configTIMER_WHEEL_SIZE
+	#define configTIMER_WHEEL_SIZE 32
+#endif
+
 #ifndef configINCLUDE_APPLICATION_DEFINED_PRIVILEGED_FUNCTIONS
 	#define configINCLUDE_APPLICATION_DEFINED_PRIVILEGED_FUNCTIONS 0
 #endif
@@ -810,6 +870,14 @@ extern "C" {
 	#define configUSE_TASK_NOTIFICATIONS 1
 #endif
 
+#ifndef configTASK_NOTIFICATION_ARRAY_ENTRIES
+	#define configTASK_NOTIFICATION_ARRAY_ENTRIES 1
+#endif
+
+#if configTASK_NOTIFICATION_ARRAY_ENTRIES < 1
+	#error configTASK_NOTIFICATION_ARRAY_ENTRIES must be at least 1
+#endif
+
 #ifndef configUSE_POSIX_ERRNO
 	#define configUSE_POSIX_ERRNO 0
 #endif
@@ -841,6 +909,98 @@ extern "C" {
 	#define configMESSAGE_BUFFER_LENGTH_TYPE size_t
 #endif
 
+#ifndef configUSE_LOCK_FREE_STREAM_BUFFERS
+	/* When set to 1 stream and message buffers only enter a critical section,
+	or suspend the scheduler, when a task has to block or a blocked task has to
+	be notified.  Requires the port to define portMEMORY_BARRIER(). */
+	#define configUSE_LOCK_FREE_STREAM_BUFFERS 0
+#endif
+
+/* The sizes of the pools from which dynamically created kernel objects are
+allocated before the heap is used.  0 means no pool.  See object_pool.h. */
+#ifndef configTASK_POOL_SIZE
+	#define configTASK_POOL_SIZE 0
+#endif
+
+#ifndef configTASK_STACK_POOL_SIZE
+	#define configTASK_STACK_POOL_SIZE 0
+#endif
+
+#ifndef configTASK_STACK_POOL_DEPTH
+	#define configTASK_STACK_POOL_DEPTH 0
+#endif
+
+#ifndef configQUEUE_POOL_SIZE
+	#define configQUEUE_POOL_SIZE 0
+#endif
+
+#ifndef configQUEUE_POOL_STORAGE_BYTES
+	#define configQUEUE_POOL_STORAGE_BYTES 0
+#endif
+
+#ifndef configTIMER_POOL_SIZE
+	#define configTIMER_POOL_SIZE 0
+#endif
+
+#ifndef configEVENT_GROUP_POOL_SIZE
+	#define configEVENT_GROUP_POOL_SIZE 0
+#endif
+
+#ifndef configUSE_EVENT_GROUP_WAITER_INDEX
+	#define configUSE_EVENT_GROUP_WAITER_INDEX 0
+#endif
+
+#ifndef configUSE_PRIORITY_EVENT_LISTS
+	#define configUSE_PRIORITY_EVENT_LISTS 0
+#endif
+
+#ifndef configUSE_TRANSITIVE_PRIORITY_INHERITANCE
+	#define configUSE_TRANSITIVE_PRIORITY_INHERITANCE 0
+#endif
+
+#ifndef configUSE_RWLOCK_STATS
+	/* Set to 1 to count how often reader-writer locks are taken and how often
+	a task has to wait for one.  See rwlock.h. */
+	#define configUSE_RWLOCK_STATS 0
+#endif
+
+#ifndef configRWLOCK_NOTIFICATION_INDEX
+	/* The index within the task notification array that a writer uses to wait
+	for the readers of a reader-writer lock to release it.  The index must not
+	be used for anything else by a task that takes a reader-writer lock for
+	writing.  See rwlock.h. */
+	#define configRWLOCK_NOTIFICATION_INDEX 1
+#endif
+
+#ifndef configKERNEL_STATE_PLACEMENT
+	/* Placed in front of the definitions of the kernel variables that are
+	accessed on every tick and every context switch, so they can be located in
+	the fastest memory using a section attribute.  Each group of variables can
+	instead be placed individually using the definitions below.  Not for use
+	with an MPU port, which places the kernel variables itself. */
+	#define configKERNEL_STATE_PLACEMENT
+#endif
+
+#ifndef configCURRENT_TCB_PLACEMENT
+	/* pxCurrentTCB. */
+	#define configCURRENT_TCB_PLACEMENT configKERNEL_STATE_PLACEMENT
+#endif
+
+#ifndef configREADY_LISTS_PLACEMENT
+	/* The ready lists and the highest ready priority. */
+	#define configREADY_LISTS_PLACEMENT configKERNEL_STATE_PLACEMENT
+#endif
+
+#ifndef configDELAYED_LISTS_PLACEMENT
+	/* The delayed task lists and the time the next task will unblock. */
+	#define configDELAYED_LISTS_PLACEMENT configKERNEL_STATE_PLACEMENT
+#endif
+
+#ifndef configTICK_COUNT_PLACEMENT
+	/* The tick count. */
+	#define configTICK_COUNT_PLACEMENT configKERNEL_STATE_PLACEMENT
+#endif
+
 /* Sanity check the configuration. */
 #if( configUSE_TICKLESS_IDLE != 0 )
 	#if( INCLUDE_vTaskSuspend != 1 )
@@ -848,10 +1008,32 @@ extern "C" {
 	#endif /* INCLUDE_vTaskSuspend */
 #endif /* configUSE_TICKLESS_IDLE */
 
+#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+	#if( ( configDELAYED_TASK_WHEEL_SIZE & ( configDELAYED_TASK_WHEEL_SIZE - 1 ) ) != 0 )
+		#error configDELAYED_TASK_WHEEL_SIZE must be a power of 2
+	#endif
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+
+#if( configUSE_TIMER_WHEEL == 1 )
+	#if( ( configTIMER_WHEEL_SIZE < 2 ) || ( ( configTIMER_WHEEL_SIZE & ( configTIMER_WHEEL_SIZE - 1 ) ) != 0 ) )
+		#error configTIMER_WHEEL_SIZE must be a power of 2, and at least 2
+	#endif
+#endif /* configUSE_TIMER_WHEEL */
+
 #if( ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 0 ) )
 	#error configSUPPORT_STATIC_ALLOCATION and configSUPPORT_DYNAMIC_ALLOCATION cannot both be 0, but can both be 1.
 #endif
 
+#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+	#if( configUSE_CO_ROUTINES != 0 )
+		#error configUSE_PRIORITY_EVENT_LISTS cannot be used with co-routines as co-routines block on the queue event lists directly.
+	#endif
+#endif /* configUSE_PRIORITY_EVENT_LISTS */
+
+#if( ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) && ( configUSE_MUTEXES != 1 ) )
+	#error configUSE_MUTEXES must be set to 1 to use transitive priority inheritance
+#endif
+
 #if( ( configUSE_RECURSIVE_MUTEXES == 1 ) && ( configUSE_MUTEXES != 1 ) )
 	#error configUSE_MUTEXES must be set to 1 to use recursive mutexes
 #endif
@@ -987,6 +1169,17 @@ typedef struct xSTATIC_LIST
 	StaticMiniListItem_t xDummy3;
 } StaticList_t;
 
+/* See the comments above the struct xSTATIC_LIST_ITEM definition. */
+#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+	typedef struct xSTATIC_EVENT_LIST
+	{
+		StaticList_t xDummy1[ configMAX_PRIORITIES ];
+		UBaseType_t uxDummy2;
+	} StaticEventList_t;
+#else
+	typedef StaticList_t StaticEventList_t;
+#endif
+
 /*
  * In line with software engineering best practice, especially when supplying a
  * library that is likely to change in future versions, FreeRTOS implements a
@@ -1021,6 +1214,9 @@ typedef struct xSTATIC_TCB
 	#endif
 	#if ( configUSE_MUTEXES == 1 )
 		UBaseType_t		uxDummy12[ 2 ];
+		#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+			void		*pvDummy13[ 2 ];
+		#endif
 	#endif
 	#if ( configUSE_APPLICATION_TASK_TAG == 1 )
 		void			*pxDummy14;
@@ -1029,14 +1225,14 @@ typedef struct xSTATIC_TCB
 		void			*pvDummy15[ configNUM_THREAD_LOCAL_STORAGE_POINTERS ];
 	#endif
 	#if ( configGENERATE_RUN_TIME_STATS == 1 )
-		uint32_t		ulDummy16;
+		configRUN_TIME_COUNTER_TYPE	ulDummy16;
 	#endif
 	#if ( configUSE_NEWLIB_REENTRANT == 1 )
 		struct	_reent	xDummy17;
 	#endif
 	#if ( configUSE_TASK_NOTIFICATIONS == 1 )
-		uint32_t 		ulDummy18;
-		uint8_t 		ucDummy19;
+		uint32_t 		ulDummy18[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+		uint8_t 		ucDummy19[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
 	#endif
 	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 		uint8_t			uxDummy20;
@@ -1048,6 +1244,18 @@ typedef struct xSTATIC_TCB
 	#if ( configUSE_POSIX_ERRNO == 1 )
 		int				iDummy22;
 	#endif
+	#if ( configUSE_STACK_WATERMARK == 1 )
+		void			*pxDummy23;
+		configSTACK_DEPTH_TYPE uxDummy24;
+	#endif
+	#if ( configUSE_TASK_NAME_REGISTRY == 1 )
+		void			*pxDummy25;
+		uint32_t		ulDummy26;
+	#endif
+	#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( ( configUSE_STACK_WATERMARK == 1 ) && ( configSTACK_WATERMARK_SCAN_BYTES > 0 ) ) )
+		StaticListItem_t	xDummy27;
+		uint32_t		ulDummy28;
+	#endif
 } StaticTask_t;
 
 /*
@@ -1074,7 +1282,11 @@ typedef struct xSTATIC_QUEUE
 		UBaseType_t uxDummy2;
 	} u;
 
-	StaticList_t xDummy3[ 2 ];
+	#if( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+		void *pvDummy10[ 2 ];
+	#endif
+
+	StaticEventList_t xDummy3[ 2 ];
 	UBaseType_t uxDummy4[ 3 ];
 	uint8_t ucDummy5[ 2 ];
 
@@ -1113,6 +1325,11 @@ typedef struct xSTATIC_EVENT_GROUP
 	TickType_t xDummy1;
 	StaticList_t xDummy2;
 
+	#if( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+		StaticList_t xDummy5[ ( sizeof( TickType_t ) * ( size_t ) 8 ) - ( size_t ) 8 ];
+		TickType_t xDummy6;
+	#endif
+
 	#if( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t uxDummy3;
 	#endif
@@ -1178,6 +1395,31 @@ typedef struct xSTATIC_STREAM_BUFFER
 /* Message buffers are built on stream buffers. */
 typedef StaticStreamBuffer_t StaticMessageBuffer_t;
 
+/*
+ * In line with software engineering best practice, FreeRTOS implements a strict
+ * data hiding policy, so the real reader-writer lock structure is not
+ * accessible to the application.  The StaticRWLock_t structure below is
+ * provided so the application writer can statically allocate the memory
+ * required to create a reader-writer lock.  Its size and alignment
+ * requirements are guaranteed to match those of the genuine structure, no
+ * matter which architecture is being used, and no matter how the values in
+ * FreeRTOSConfig.h are set.
+ */
+typedef struct xSTATIC_RWLOCK
+{
+	UBaseType_t uxDummy1[ 2 ];
+	void *pvDummy2[ 2 ];
+	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+		StaticSemaphore_t xDummy3;
+	#endif
+	#if( configUSE_RWLOCK_STATS == 1 )
+		uint32_t ulDummy4[ 5 ];
+	#endif
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t ucDummy5;
+	#endif
+} StaticRWLock_t;
+
 #ifdef __cplusplus
 }
 #endif
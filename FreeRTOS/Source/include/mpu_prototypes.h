@@ -62,6 +62,7 @@ char * MPU_pcTaskGetName( TaskHandle_t xTaskToQuery );
 TaskHandle_t MPU_xTaskGetHandle( const char *pcNameToQuery );
 UBaseType_t MPU_uxTaskGetStackHighWaterMark( TaskHandle_t xTask );
 configSTACK_DEPTH_TYPE MPU_uxTaskGetStackHighWaterMark2( TaskHandle_t xTask );
+configSTACK_DEPTH_TYPE MPU_uxTaskGetStackWatermark( TaskHandle_t xTask );
 void MPU_vTaskSetApplicationTaskTag( TaskHandle_t xTask, TaskHookFunction_t pxHookFunction );
 TaskHookFunction_t MPU_xTaskGetApplicationTaskTag( TaskHandle_t xTask );
 TaskHookFunction_t MPU_xTaskGetApplicationTaskTagFromISR( TaskHandle_t xTask );
@@ -69,13 +70,17 @@ void MPU_vTaskSetThreadLocalStoragePointer( TaskHandle_t xTaskToSet, BaseType_t
 void * MPU_pvTaskGetThreadLocalStoragePointer( TaskHandle_t xTaskToQuery, BaseType_t xIndex );
 BaseType_t MPU_xTaskCallApplicationTaskHook( TaskHandle_t xTask, void *pvParameter );
 TaskHandle_t MPU_xTaskGetIdleTaskHandle( void );
-UBaseType_t MPU_uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, uint32_t * const pulTotalRunTime );
+UBaseType_t MPU_uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime );
+void MPU_vTaskStatusIteratorInitialise( TaskStatusIterator_t * const pxIterator );
+BaseType_t MPU_xTaskStatusIteratorNext( TaskStatusIterator_t * const pxIterator, TaskStatus_t * const pxTaskStatus );
 void MPU_vTaskList( char * pcWriteBuffer );
 void MPU_vTaskGetRunTimeStats( char *pcWriteBuffer );
-BaseType_t MPU_xTaskGenericNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue );
-BaseType_t MPU_xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait );
-uint32_t MPU_ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait );
-BaseType_t MPU_xTaskNotifyStateClear( TaskHandle_t xTask );
+configRUN_TIME_COUNTER_TYPE MPU_ulTaskGetRunTimeCounter( const TaskHandle_t xTask );
+UBaseType_t MPU_uxTaskGetLoadOverWindow( const TaskHandle_t xTask, TaskLoadWindow_t * const pxWindow );
+BaseType_t MPU_xTaskGenericNotify( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue );
+BaseType_t MPU_xTaskGenericNotifyWait( UBaseType_t uxIndexToWaitOn, uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait );
+uint32_t MPU_ulTaskGenericNotifyTake( UBaseType_t uxIndexToWaitOn, BaseType_t xClearCountOnExit, TickType_t xTicksToWait );
+BaseType_t MPU_xTaskGenericNotifyStateClear( TaskHandle_t xTask, UBaseType_t uxIndexToClear );
 BaseType_t MPU_xTaskIncrementTick( void );
 TaskHandle_t MPU_xTaskGetCurrentTaskHandle( void );
 void MPU_vTaskSetTimeOutState( TimeOut_t * const pxTimeOut );
@@ -86,6 +91,8 @@ BaseType_t MPU_xTaskGetSchedulerState( void );
 /* MPU versions of queue.h API functions. */
 BaseType_t MPU_xQueueGenericSend( QueueHandle_t xQueue, const void * const pvItemToQueue, TickType_t xTicksToWait, const BaseType_t xCopyPosition );
 BaseType_t MPU_xQueueReceive( QueueHandle_t xQueue, void * const pvBuffer, TickType_t xTicksToWait );
+size_t MPU_xQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItemsToQueue, size_t xItemCount, TickType_t xTicksToWait );
+size_t MPU_xQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, size_t xMaxItemCount, TickType_t xTicksToWait );
 BaseType_t MPU_xQueuePeek( QueueHandle_t xQueue, void * const pvBuffer, TickType_t xTicksToWait );
 BaseType_t MPU_xQueueSemaphoreTake( QueueHandle_t xQueue, TickType_t xTicksToWait );
 UBaseType_t MPU_uxQueueMessagesWaiting( const QueueHandle_t xQueue );
@@ -142,6 +149,10 @@ size_t MPU_xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer, const v
 size_t MPU_xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, TickType_t xTicksToWait );
 size_t MPU_xStreamBufferNextMessageLengthBytes( StreamBufferHandle_t xStreamBuffer );
 size_t MPU_xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken );
+size_t MPU_xStreamBufferSendAcquire( StreamBufferHandle_t xStreamBuffer, void **ppvWriteRegion, TickType_t xTicksToWait );
+void MPU_vStreamBufferSendCommit( StreamBufferHandle_t xStreamBuffer, size_t xBytesWritten );
+size_t MPU_xStreamBufferReceiveAcquire( StreamBufferHandle_t xStreamBuffer, void **ppvReadRegion, TickType_t xTicksToWait );
+void MPU_vStreamBufferReceiveCommit( StreamBufferHandle_t xStreamBuffer, size_t xBytesRead );
 void MPU_vStreamBufferDelete( StreamBufferHandle_t xStreamBuffer );
 BaseType_t MPU_xStreamBufferIsFull( StreamBufferHandle_t xStreamBuffer );
 BaseType_t MPU_xStreamBufferIsEmpty( StreamBufferHandle_t xStreamBuffer );
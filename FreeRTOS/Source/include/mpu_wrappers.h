@@ -68,6 +68,7 @@ only for ports that are using the MPU. */
 		#define xTaskGetHandle							MPU_xTaskGetHandle
 		#define uxTaskGetStackHighWaterMark				MPU_uxTaskGetStackHighWaterMark
 		#define uxTaskGetStackHighWaterMark2			MPU_uxTaskGetStackHighWaterMark2
+		#define uxTaskGetStackWatermark					MPU_uxTaskGetStackWatermark
 		#define vTaskSetApplicationTaskTag				MPU_vTaskSetApplicationTaskTag
 		#define xTaskGetApplicationTaskTag				MPU_xTaskGetApplicationTaskTag
 		#define xTaskGetApplicationTaskTagFromISR		MPU_xTaskGetApplicationTaskTagFromISR
@@ -76,12 +77,16 @@ only for ports that are using the MPU. */
 		#define xTaskCallApplicationTaskHook			MPU_xTaskCallApplicationTaskHook
 		#define xTaskGetIdleTaskHandle					MPU_xTaskGetIdleTaskHandle
 		#define uxTaskGetSystemState					MPU_uxTaskGetSystemState
+		#define vTaskStatusIteratorInitialise			MPU_vTaskStatusIteratorInitialise
+		#define xTaskStatusIteratorNext					MPU_xTaskStatusIteratorNext
 		#define vTaskList								MPU_vTaskList
 		#define vTaskGetRunTimeStats					MPU_vTaskGetRunTimeStats
+		#define ulTaskGetRunTimeCounter					MPU_ulTaskGetRunTimeCounter
+		#define uxTaskGetLoadOverWindow					MPU_uxTaskGetLoadOverWindow
 		#define xTaskGenericNotify						MPU_xTaskGenericNotify
-		#define xTaskNotifyWait							MPU_xTaskNotifyWait
-		#define ulTaskNotifyTake						MPU_ulTaskNotifyTake
-		#define xTaskNotifyStateClear					MPU_xTaskNotifyStateClear
+		#define xTaskGenericNotifyWait					MPU_xTaskGenericNotifyWait
+		#define ulTaskGenericNotifyTake					MPU_ulTaskGenericNotifyTake
+		#define xTaskGenericNotifyStateClear			MPU_xTaskGenericNotifyStateClear
 
 		#define xTaskGetCurrentTaskHandle				MPU_xTaskGetCurrentTaskHandle
 		#define vTaskSetTimeOutState					MPU_vTaskSetTimeOutState
@@ -91,6 +96,8 @@ only for ports that are using the MPU. */
 		/* Map standard queue.h API functions to the MPU equivalents. */
 		#define xQueueGenericSend						MPU_xQueueGenericSend
 		#define xQueueReceive							MPU_xQueueReceive
+		#define xQueueSendMultiple						MPU_xQueueSendMultiple
+		#define xQueueReceiveMultiple					MPU_xQueueReceiveMultiple
 		#define xQueuePeek								MPU_xQueuePeek
 		#define xQueueSemaphoreTake						MPU_xQueueSemaphoreTake
 		#define uxQueueMessagesWaiting					MPU_uxQueueMessagesWaiting
@@ -146,6 +153,10 @@ only for ports that are using the MPU. */
 		#define xStreamBufferReceive					MPU_xStreamBufferReceive
 		#define xStreamBufferNextMessageLengthBytes		MPU_xStreamBufferNextMessageLengthBytes
 		#define xStreamBufferReceiveFromISR				MPU_xStreamBufferReceiveFromISR
+		#define xStreamBufferSendAcquire				MPU_xStreamBufferSendAcquire
+		#define vStreamBufferSendCommit					MPU_vStreamBufferSendCommit
+		#define xStreamBufferReceiveAcquire				MPU_xStreamBufferReceiveAcquire
+		#define vStreamBufferReceiveCommit				MPU_vStreamBufferReceiveCommit
 		#define vStreamBufferDelete						MPU_vStreamBufferDelete
 		#define xStreamBufferIsFull						MPU_xStreamBufferIsFull
 		#define xStreamBufferIsEmpty					MPU_xStreamBufferIsEmpty
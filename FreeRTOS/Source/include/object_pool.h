@@ -0,0 +1,127 @@
+/*
+ * FreeRTOS Kernel V10.1.1
+ * Copyright (C) 2018 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Object pools hold a fixed number of objects of a fixed size in statically
+ * allocated memory.  The kernel uses them, when configured to do so, to
+ * allocate the task control blocks, task stacks, queues, software timers and
+ * event groups of objects that are created dynamically.  Taking an object from,
+ * and returning an object to, a pool takes a constant time and does not
+ * fragment the heap, which makes pools well suited to objects that are created
+ * and deleted frequently.
+ *
+ * pvObjectPoolMalloc() falls back to pvPortMalloc() when the pool is empty or
+ * the object is larger than the objects held in the pool, and vObjectPoolFree()
+ * falls back to vPortFree() when the object did not come from the pool, so the
+ * pool sizes only need to cover the number of objects that are expected to
+ * exist at any one time.
+ *
+ * The following can be defined in FreeRTOSConfig.h to create the pools used by
+ * the kernel.  All default to 0, which means no pool is used.
+ *
+ * configTASK_POOL_SIZE - the number of task control blocks in the pool used by
+ * xTaskCreate().
+ *
+ * configTASK_STACK_POOL_SIZE and configTASK_STACK_POOL_DEPTH - the number of
+ * stacks in the pool used by xTaskCreate(), and the depth of each, in words.
+ * Tasks created with a larger stack depth use the heap for their stack.
+ *
+ * configQUEUE_POOL_SIZE and configQUEUE_POOL_STORAGE_BYTES - the number of
+ * queues in the pool used by xQueueGenericCreate(), and the number of bytes of
+ * storage area held with each.  Semaphores and mutexes have no storage area, so
+ * a pool with configQUEUE_POOL_STORAGE_BYTES set to 0 is used by semaphores and
+ * mutexes only.
+ *
+ * configTIMER_POOL_SIZE - the number of timers in the pool used by
+ * xTimerCreate().
+ *
+ * configEVENT_GROUP_POOL_SIZE - the number of event groups in the pool used by
+ * xEventGroupCreate().
+ *
+ * object_pool.c must be included in the build if any pool size is not 0.
+ */
+
+#ifndef OBJECT_POOL_H
+#define OBJECT_POOL_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h must appear in source files before include object_pool.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The size of each object in a pool is rounded up so every object has the
+alignment that pvPortMalloc() would provide. */
+#define objectpoolOBJECT_SIZE( xSize ) ( ( ( size_t ) ( xSize ) + ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/*
+ * Defines a pool, called xPoolName, that holds uxObjectCount objects of
+ * xObjectSize bytes in a statically allocated array called ucStorageName.  The
+ * array has space for the padding needed to align the first object.  Objects
+ * are not placed on the free list until they are freed for the first time, so
+ * a pool does not need to be initialised before it is used.
+ */
+#define objectpoolDEFINE_POOL( xPoolName, ucStorageName, xObjectSize, uxObjectCount )											\
+	PRIVILEGED_DATA static uint8_t ucStorageName[ ( objectpoolOBJECT_SIZE( xObjectSize ) * ( uxObjectCount ) ) + portBYTE_ALIGNMENT ];	\
+	PRIVILEGED_DATA static ObjectPool_t xPoolName = { ucStorageName, objectpoolOBJECT_SIZE( xObjectSize ), ( uxObjectCount ), 0, NULL }
+
+/*
+ * Used internally only.  Pools should be defined using objectpoolDEFINE_POOL()
+ * rather than by accessing the members directly.
+ */
+typedef struct xOBJECT_POOL
+{
+	uint8_t *pucStorage;			/*< The memory the objects are held in, before it is aligned. */
+	size_t xObjectSize;				/*< The size of each object, which is a multiple of portBYTE_ALIGNMENT. */
+	UBaseType_t uxObjectCount;		/*< The number of objects the pool holds. */
+	UBaseType_t uxObjectsUsed;		/*< The objects below this index have been allocated at least once. */
+	void *pvFreeList;				/*< Objects that have been freed, linked through their first bytes. */
+} ObjectPool_t;
+
+/*
+ * Returns an object of at least xWantedSize bytes.  The object is taken from
+ * pxPool if it fits in the objects held in the pool and the pool is not empty,
+ * otherwise it is allocated using pvPortMalloc().  Returns NULL if the object
+ * could not be allocated.
+ */
+void *pvObjectPoolMalloc( ObjectPool_t *pxPool, size_t xWantedSize ) PRIVILEGED_FUNCTION;
+
+/*
+ * Frees an object that was allocated by pvObjectPoolMalloc() using the same
+ * pool.  The object is returned to pxPool if it was taken from pxPool,
+ * otherwise it is freed using vPortFree().
+ */
+void vObjectPoolFree( ObjectPool_t *pxPool, void *pv ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OBJECT_POOL_H */
+
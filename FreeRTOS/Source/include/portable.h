@@ -102,7 +102,7 @@ extern "C" {
 	StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters ) PRIVILEGED_FUNCTION;
 #endif
 
-/* Used by heap_5.c. */
+/* Used by heap_5.c and heap_6.c. */
 typedef struct HeapRegion
 {
 	uint8_t *pucStartAddress;
@@ -110,18 +110,37 @@ typedef struct HeapRegion
 } HeapRegion_t;
 
 /*
- * Used to define multiple heap regions for use by heap_5.c.  This function
- * must be called before any calls to pvPortMalloc() - not creating a task,
- * queue, semaphore, mutex, software timer, event group, etc. will result in
- * pvPortMalloc being called.
+ * Used to define multiple heap regions for use by heap_5.c and heap_6.c.  This
+ * function must be called before any calls to pvPortMalloc() - not creating a
+ * task, queue, semaphore, mutex, software timer, event group, etc. will result
+ * in pvPortMalloc being called.
  *
  * pxHeapRegions passes in an array of HeapRegion_t structures - each of which
  * defines a region of memory that can be used as the heap.  The array is
- * terminated by a HeapRegions_t structure that has a size of 0.  The region
- * with the lowest start address must appear first in the array.
+ * terminated by a HeapRegions_t structure that has a size of 0.  When heap_5.c
+ * is used the region with the lowest start address must appear first in the
+ * array.
  */
 void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) PRIVILEGED_FUNCTION;
 
+/* Used to pass information about the heap out of vPortGetHeapStats(). */
+typedef struct xHeapStats
+{
+	size_t xAvailableHeapSpaceInBytes;		/* The total heap size currently available - this is the sum of all the free blocks, not the largest block that can be allocated. */
+	size_t xSizeOfLargestFreeBlockInBytes; 	/* The maximum size, in bytes, of all the free blocks within the heap at the time vPortGetHeapStats() is called. */
+	size_t xSizeOfSmallestFreeBlockInBytes; /* The minimum size, in bytes, of all the free blocks within the heap at the time vPortGetHeapStats() is called. */
+	size_t xNumberOfFreeBlocks;				/* The number of free memory blocks within the heap at the time vPortGetHeapStats() is called. */
+	size_t xMinimumEverFreeBytesRemaining;	/* The minimum amount of total free memory (sum of all free blocks) there has been in the heap since the system booted. */
+	size_t xNumberOfSuccessfulAllocations;	/* The number of calls to pvPortMalloc() that have returned a valid memory block. */
+	size_t xNumberOfSuccessfulFrees;		/* The number of calls to vPortFree() that has successfully freed a block of memory. */
+} HeapStats_t;
+
+/*
+ * Fills pxHeapStats with information on the state of the heap.  Only
+ * implemented by heap_6.c.
+ */
+void vPortGetHeapStats( HeapStats_t *pxHeapStats ) PRIVILEGED_FUNCTION;
+
 
 /*
  * Map to the memory management routines required for the port.
@@ -867,6 +867,115 @@ BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue, void * const pvBuffer ) PRIV
  */
 BaseType_t xQueueReceive( QueueHandle_t xQueue, void * const pvBuffer, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue. h
+ * <pre>
+ size_t xQueueSendMultiple(
+							  QueueHandle_t xQueue,
+							  const void *pvItemsToQueue,
+							  size_t xItemCount,
+							  TickType_t xTicksToWait
+						  );
+ * </pre>
+ *
+ * Post xItemCount items to the back of a queue.  The items are copied into
+ * the queue using at most two calls to memcpy() within each critical section,
+ * and the task yields at most once each time items are copied, so sending many
+ * small items this way is much faster than calling xQueueSend() once per item.
+ * Tasks blocked on the queue are unblocked exactly as if the items had been
+ * sent individually.
+ *
+ * If the queue does not have space for all the items then as many as will fit
+ * are sent, and the calling task blocks (for at most xTicksToWait ticks in
+ * total) waiting for space to send the rest.
+ *
+ * This function must not be called from an interrupt service routine, and
+ * cannot be used with semaphores or mutexes.  See
+ * xQueueSendMultipleFromISR() for an alternative which may be used in an ISR.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItemsToQueue A pointer to an array of xItemCount items.  Each item
+ * is the size the queue was created to hold.
+ *
+ * @param xItemCount The number of items to post.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block waiting
+ * for space to become available on the queue.  If xTicksToWait is 0 the
+ * function sends as many items as there is space for and returns immediately.
+ *
+ * @return The number of items posted to the queue, which will be less than
+ * xItemCount if the block time expired before all the items were sent.
+ *
+ * Example usage:
+   <pre>
+ #define SAMPLES_PER_BLOCK 16
+
+ void vAFunction( QueueHandle_t xSampleQueue )
+ {
+ uint16_t usSamples[ SAMPLES_PER_BLOCK ];
+ size_t xSent;
+
+	// ... Fill usSamples[] with SAMPLES_PER_BLOCK readings.
+
+	// Post all the samples, blocking for up to 10 ticks if the queue fills.
+	xSent = xQueueSendMultiple( xSampleQueue, usSamples, SAMPLES_PER_BLOCK, ( TickType_t ) 10 );
+
+	if( xSent != SAMPLES_PER_BLOCK )
+	{
+		// The queue was full for 10 ticks, so not all the samples were posted.
+	}
+ }
+ </pre>
+ * \defgroup xQueueSendMultiple xQueueSendMultiple
+ * \ingroup QueueManagement
+ */
+size_t xQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItemsToQueue, size_t xItemCount, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ size_t xQueueReceiveMultiple(
+								 QueueHandle_t xQueue,
+								 void *pvBuffer,
+								 size_t xMaxItemCount,
+								 TickType_t xTicksToWait
+							 );</pre>
+ *
+ * Receive up to xMaxItemCount items from a queue.  If the queue is empty the
+ * calling task blocks (for at most xTicksToWait ticks) until at least one item
+ * is available, then receives as many of the available items as will fit in
+ * the buffer.  The items are copied out of the queue using at most two calls
+ * to memcpy(), and the task yields at most once.  Tasks blocked waiting to
+ * send to the queue are unblocked exactly as if the items had been received
+ * individually.
+ *
+ * This function must not be called from an interrupt service routine, and
+ * cannot be used with semaphores or mutexes.  See
+ * xQueueReceiveMultipleFromISR() for an alternative which may be used in an
+ * ISR.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to the buffer into which the received items will be
+ * copied.  The buffer must be large enough to hold xMaxItemCount items.
+ *
+ * @param xMaxItemCount The maximum number of items to receive.  Must not be 0.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block waiting
+ * for an item to receive should the queue be empty at the time of the call.
+ * xQueueReceiveMultiple() will return immediately if xTicksToWait is zero and
+ * the queue is empty.
+ *
+ * @return The number of items received, or 0 if the block time expired before
+ * any items were available.
+ *
+ * \defgroup xQueueReceiveMultiple xQueueReceiveMultiple
+ * \ingroup QueueManagement
+ */
+size_t xQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, size_t xMaxItemCount, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
 /**
  * queue. h
  * <pre>UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue );</pre>
@@ -1384,6 +1493,75 @@ BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue, BaseType_t * const pxHigherP
  */
 BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue, void * const pvBuffer, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue. h
+ * <pre>
+ size_t xQueueSendMultipleFromISR(
+									 QueueHandle_t xQueue,
+									 const void *pvItemsToQueue,
+									 size_t xItemCount,
+									 BaseType_t *pxHigherPriorityTaskWoken
+								 );
+ </pre>
+ *
+ * A version of xQueueSendMultiple() that can be used from an interrupt service
+ * routine (ISR).  As many of the xItemCount items as there is space for are
+ * posted to the back of the queue.  The function never blocks.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItemsToQueue A pointer to an array of xItemCount items.
+ *
+ * @param xItemCount The number of items to post.
+ *
+ * @param pxHigherPriorityTaskWoken xQueueSendMultipleFromISR() will set
+ * *pxHigherPriorityTaskWoken to pdTRUE if sending the items caused a task to
+ * unblock, and the unblocked task has a priority higher than the currently
+ * running task.  If xQueueSendMultipleFromISR() sets this value to pdTRUE then
+ * a context switch should be requested before the interrupt is exited.
+ *
+ * @return The number of items posted to the queue.
+ *
+ * \defgroup xQueueSendMultipleFromISR xQueueSendMultipleFromISR
+ * \ingroup QueueManagement
+ */
+size_t xQueueSendMultipleFromISR( QueueHandle_t xQueue, const void * const pvItemsToQueue, size_t xItemCount, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ size_t xQueueReceiveMultipleFromISR(
+										QueueHandle_t xQueue,
+										void *pvBuffer,
+										size_t xMaxItemCount,
+										BaseType_t *pxHigherPriorityTaskWoken
+									);
+ </pre>
+ *
+ * A version of xQueueReceiveMultiple() that can be used from an interrupt
+ * service routine (ISR).  Up to xMaxItemCount of the items already in the
+ * queue are received.  The function never blocks.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to the buffer into which the received items will be
+ * copied.  The buffer must be large enough to hold xMaxItemCount items.
+ *
+ * @param xMaxItemCount The maximum number of items to receive.
+ *
+ * @param pxHigherPriorityTaskWoken Tasks can be blocked waiting for space to
+ * become available on the queue.  If receiving the items causes such a task
+ * to unblock *pxHigherPriorityTaskWoken will get set to pdTRUE if the
+ * unblocked task has a priority higher than the currently running task.
+ *
+ * @return The number of items received, which is 0 if the queue was empty.
+ *
+ * \defgroup xQueueReceiveMultipleFromISR xQueueReceiveMultipleFromISR
+ * \ingroup QueueManagement
+ */
+size_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue, void * const pvBuffer, size_t xMaxItemCount, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /*
  * Utilities to query queues that are safe to use from an ISR.  These utilities
  * should be used only from witin an ISR, or within a critical section.
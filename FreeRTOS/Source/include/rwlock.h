@@ -0,0 +1,318 @@
+/*
+ * FreeRTOS Kernel V10.1.1
+ * Copyright (C) 2018 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef RWLOCK_H
+#define RWLOCK_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include rwlock.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A reader-writer lock protects data that is read often and written rarely.
+ * Any number of tasks can hold the lock for reading at the same time, but a
+ * task that holds the lock for writing has exclusive access.
+ *
+ * The lock prefers writers.  Once a task has asked for the lock for writing no
+ * further readers are admitted, so a stream of readers cannot starve a writer.
+ * The writer then waits for the readers that already hold the lock to release
+ * it.
+ *
+ * Writers are serialised by a mutex, so a task that holds the lock for writing
+ * inherits the priority of the highest priority task waiting for the lock,
+ * whether that task wants to read or to write.  Readers do not inherit
+ * priority, as there can be many of them and the lock does not record which
+ * tasks they are.  A high priority writer that waits for low priority readers
+ * to release the lock is therefore subject to unbounded priority inversion:
+ * tasks of intermediate priority can prevent the readers running for as long
+ * as they remain Ready.  Where that matters, give the readers a priority no
+ * lower than any task that could otherwise delay them while they hold the lock,
+ * or have the writer take the lock with a finite block time.
+ *
+ * Taking the lock for reading when no writer has asked for it only needs a
+ * short critical section, and can also be done from an interrupt.  A reader
+ * that has to wait passes through the writers' mutex, so readers that queue
+ * behind a writer are admitted in priority order.
+ *
+ * The lock is not recursive.  A task that already holds the lock must not ask
+ * for it again, as it would wait for itself if a writer were pending.
+ *
+ * A task that waits for readers to release the lock does so using the task
+ * notification at index configRWLOCK_NOTIFICATION_INDEX (1 by default), so the
+ * index must not be used for anything else by a task that takes the lock for
+ * writing.  configTASK_NOTIFICATION_ARRAY_ENTRIES must be greater than
+ * configRWLOCK_NOTIFICATION_INDEX.
+ *
+ * rwlock.c must be included in the build to use reader-writer locks, and
+ * configUSE_MUTEXES and configUSE_TASK_NOTIFICATIONS must both be set to 1.
+ *
+ * \defgroup RWLock
+ */
+
+/**
+ * rwlock.h
+ *
+ * Type by which reader-writer locks are referenced.  For example, a call to
+ * xRWLockCreate() returns an RWLockHandle_t variable that can then be used as a
+ * parameter to other reader-writer lock functions.
+ *
+ * \defgroup RWLockHandle_t RWLockHandle_t
+ * \ingroup RWLock
+ */
+struct RWLockDef_t;
+typedef struct RWLockDef_t * RWLockHandle_t;
+
+/**
+ * rwlock.h
+ *
+ * The contention statistics of a reader-writer lock, as returned by
+ * vRWLockGetStats().  Only available when configUSE_RWLOCK_STATS is set to 1
+ * in FreeRTOSConfig.h.
+ *
+ * \defgroup RWLockStats_t RWLockStats_t
+ * \ingroup RWLock
+ */
+typedef struct xRWLOCK_STATS
+{
+	uint32_t ulReadLocks;			/*< The number of times the lock was taken for reading. */
+	uint32_t ulReadContentions;		/*< The number of times a reader had to wait because a writer held, or had asked for, the lock. */
+	uint32_t ulWriteLocks;			/*< The number of times the lock was taken for writing. */
+	uint32_t ulWriteContentions;	/*< The number of times a writer had to wait for another writer or for readers. */
+	uint32_t ulTimeouts;			/*< The number of times a reader or writer gave up waiting for the lock. */
+} RWLockStats_t;
+
+/**
+ * rwlock.h
+ *<pre>
+ RWLockHandle_t xRWLockCreate( void );
+ </pre>
+ *
+ * Create a reader-writer lock, allocating the memory it needs from the FreeRTOS
+ * heap.
+ *
+ * @return A handle to the lock if it was created, otherwise NULL.
+ *
+ * \defgroup xRWLockCreate xRWLockCreate
+ * \ingroup RWLock
+ */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	RWLockHandle_t xRWLockCreate( void );
+#endif
+
+/**
+ * rwlock.h
+ *<pre>
+ RWLockHandle_t xRWLockCreateStatic( StaticRWLock_t *pxRWLockBuffer );
+ </pre>
+ *
+ * Create a reader-writer lock in memory provided by the application.
+ *
+ * @param pxRWLockBuffer Must point to a variable of type StaticRWLock_t, which
+ * is then used to hold the lock's data structures.
+ *
+ * @return A handle to the lock if it was created, otherwise NULL.
+ *
+ * \defgroup xRWLockCreateStatic xRWLockCreateStatic
+ * \ingroup RWLock
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	RWLockHandle_t xRWLockCreateStatic( StaticRWLock_t *pxRWLockBuffer );
+#endif
+
+/**
+ * rwlock.h
+ *<pre>
+ void vRWLockDelete( RWLockHandle_t xRWLock );
+ </pre>
+ *
+ * Delete a reader-writer lock.  The lock must not be held, and no task may be
+ * waiting for it.
+ *
+ * \defgroup vRWLockDelete vRWLockDelete
+ * \ingroup RWLock
+ */
+void vRWLockDelete( RWLockHandle_t xRWLock );
+
+/**
+ * rwlock.h
+ *<pre>
+ BaseType_t xRWLockReadLock( RWLockHandle_t xRWLock, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Take a reader-writer lock for reading, waiting if a task holds the lock for
+ * writing or has asked to do so.  The lock must be released by calling
+ * xRWLockReadUnlock().
+ *
+ * @param xRWLock The lock to take.
+ *
+ * @param xTicksToWait The maximum number of ticks to wait for the lock.
+ *
+ * @return pdPASS if the lock was taken, or pdFAIL if xTicksToWait expired
+ * first.
+ *
+ * Example usage:
+   <pre>
+	if( xRWLockReadLock( xConfigLock, portMAX_DELAY ) == pdPASS )
+	{
+		// Any number of tasks can read the configuration at this point, but
+		// none can change it.
+		vReadConfiguration();
+		xRWLockReadUnlock( xConfigLock );
+	}
+   </pre>
+ * \defgroup xRWLockReadLock xRWLockReadLock
+ * \ingroup RWLock
+ */
+BaseType_t xRWLockReadLock( RWLockHandle_t xRWLock, TickType_t xTicksToWait );
+
+/**
+ * rwlock.h
+ *<pre>
+ BaseType_t xRWLockReadUnlock( RWLockHandle_t xRWLock );
+ </pre>
+ *
+ * Release a reader-writer lock that was taken for reading.  If the calling task
+ * was the last reader, and a writer is waiting for the readers to finish, then
+ * the writer is unblocked.
+ *
+ * @return pdPASS if the lock was released, or pdFAIL if it was not held for
+ * reading.
+ *
+ * \defgroup xRWLockReadUnlock xRWLockReadUnlock
+ * \ingroup RWLock
+ */
+BaseType_t xRWLockReadUnlock( RWLockHandle_t xRWLock );
+
+/**
+ * rwlock.h
+ *<pre>
+ BaseType_t xRWLockTryReadLockFromISR( RWLockHandle_t xRWLock );
+ </pre>
+ *
+ * A version of xRWLockReadLock() that can be called from an interrupt service
+ * routine.  It never waits, so fails if a task holds the lock for writing or
+ * has asked to do so.  The lock must be released by calling
+ * xRWLockReadUnlockFromISR().
+ *
+ * @return pdPASS if the lock was taken, otherwise pdFAIL.
+ *
+ * \defgroup xRWLockTryReadLockFromISR xRWLockTryReadLockFromISR
+ * \ingroup RWLock
+ */
+BaseType_t xRWLockTryReadLockFromISR( RWLockHandle_t xRWLock );
+
+/**
+ * rwlock.h
+ *<pre>
+ BaseType_t xRWLockReadUnlockFromISR( RWLockHandle_t xRWLock, BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * A version of xRWLockReadUnlock() that can be called from an interrupt service
+ * routine.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if releasing the lock
+ * unblocked a writer that has a priority above that of the interrupted task,
+ * in which case a context switch should be requested before the interrupt is
+ * exited.  Can be NULL.
+ *
+ * @return pdPASS if the lock was released, or pdFAIL if it was not held for
+ * reading.
+ *
+ * \defgroup xRWLockReadUnlockFromISR xRWLockReadUnlockFromISR
+ * \ingroup RWLock
+ */
+BaseType_t xRWLockReadUnlockFromISR( RWLockHandle_t xRWLock, BaseType_t *pxHigherPriorityTaskWoken );
+
+/**
+ * rwlock.h
+ *<pre>
+ BaseType_t xRWLockWriteLock( RWLockHandle_t xRWLock, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Take a reader-writer lock for writing.  The calling task first waits for any
+ * other writer, then stops further readers being admitted and waits for the
+ * readers that hold the lock to release it.  The lock must be released by
+ * calling xRWLockWriteUnlock().
+ *
+ * @param xRWLock The lock to take.
+ *
+ * @param xTicksToWait The maximum number of ticks to wait, in total, for the
+ * lock.
+ *
+ * @return pdPASS if the lock was taken, or pdFAIL if xTicksToWait expired
+ * first.
+ *
+ * \defgroup xRWLockWriteLock xRWLockWriteLock
+ * \ingroup RWLock
+ */
+BaseType_t xRWLockWriteLock( RWLockHandle_t xRWLock, TickType_t xTicksToWait );
+
+/**
+ * rwlock.h
+ *<pre>
+ BaseType_t xRWLockWriteUnlock( RWLockHandle_t xRWLock );
+ </pre>
+ *
+ * Release a reader-writer lock that the calling task took for writing.  Any
+ * priority the task inherited while it held the lock is disinherited, as it
+ * would be when giving a mutex.
+ *
+ * @return pdPASS if the lock was released, or pdFAIL if the calling task did
+ * not hold the lock for writing.
+ *
+ * \defgroup xRWLockWriteUnlock xRWLockWriteUnlock
+ * \ingroup RWLock
+ */
+BaseType_t xRWLockWriteUnlock( RWLockHandle_t xRWLock );
+
+/**
+ * rwlock.h
+ *<pre>
+ void vRWLockGetStats( RWLockHandle_t xRWLock, RWLockStats_t *pxStats );
+ void vRWLockResetStats( RWLockHandle_t xRWLock );
+ </pre>
+ *
+ * Read, or reset to zero, the contention statistics of a reader-writer lock.
+ * Only available when configUSE_RWLOCK_STATS is set to 1 in FreeRTOSConfig.h.
+ *
+ * \defgroup vRWLockGetStats vRWLockGetStats
+ * \ingroup RWLock
+ */
+#if( configUSE_RWLOCK_STATS == 1 )
+	void vRWLockGetStats( RWLockHandle_t xRWLock, RWLockStats_t *pxStats );
+	void vRWLockResetStats( RWLockHandle_t xRWLock );
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RWLOCK_H */
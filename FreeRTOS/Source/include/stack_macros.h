@@ -40,6 +40,12 @@
  * to which the bytes were set when the task was created have not been
  * overwritten.  Note this second test does not guarantee that an overflowed
  * stack will always be recognised.
+ *
+ * Setting configUSE_STACK_WATERMARK to 1 will cause the deepest stack pointer
+ * saved by each task to be recorded when the task is swapped out, which only
+ * requires one comparison.  Combined with setting configCHECK_FOR_STACK_OVERFLOW
+ * to 1 this gives stack usage information cheaply enough to leave enabled in
+ * production code.
  */
 
 /*-----------------------------------------------------------*/
@@ -122,6 +128,40 @@
 #ifndef taskCHECK_FOR_STACK_OVERFLOW
 	#define taskCHECK_FOR_STACK_OVERFLOW()
 #endif
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_STACK_WATERMARK == 1 ) && ( portSTACK_GROWTH < 0 ) )
+
+	#define taskRECORD_STACK_WATERMARK()																\
+	{																									\
+		/* Is the currently saved stack pointer the deepest seen? */									\
+		if( pxCurrentTCB->pxTopOfStack < pxCurrentTCB->pxStackWatermark )								\
+		{																								\
+			pxCurrentTCB->pxStackWatermark = ( StackType_t * ) pxCurrentTCB->pxTopOfStack;				\
+		}																								\
+	}
+
+#endif /* configUSE_STACK_WATERMARK == 1 */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_STACK_WATERMARK == 1 ) && ( portSTACK_GROWTH > 0 ) )
+
+	#define taskRECORD_STACK_WATERMARK()																\
+	{																									\
+		/* Is the currently saved stack pointer the deepest seen? */									\
+		if( pxCurrentTCB->pxTopOfStack > pxCurrentTCB->pxStackWatermark )								\
+		{																								\
+			pxCurrentTCB->pxStackWatermark = ( StackType_t * ) pxCurrentTCB->pxTopOfStack;				\
+		}																								\
+	}
+
+#endif /* configUSE_STACK_WATERMARK == 1 */
+/*-----------------------------------------------------------*/
+
+/* Remove stack watermark macro if not being used. */
+#ifndef taskRECORD_STACK_WATERMARK
+	#define taskRECORD_STACK_WATERMARK()
+#endif
 
 
 
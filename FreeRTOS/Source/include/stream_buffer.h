@@ -586,6 +586,220 @@ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
 									size_t xBufferLengthBytes,
 									BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferSendAcquire( StreamBufferHandle_t xStreamBuffer,
+                                 void **ppvWriteRegion,
+                                 TickType_t xTicksToWait );
+
+size_t xStreamBufferSendAcquireFromISR( StreamBufferHandle_t xStreamBuffer,
+                                        void **ppvWriteRegion );
+</pre>
+ *
+ * The first half of a zero copy write.  Obtains a pointer to the free space
+ * within the stream buffer's own storage area so the data can be written
+ * directly into the stream buffer (for example by a DMA controller) instead of
+ * being copied in from another buffer by xStreamBufferSend().  The data does
+ * not become available to the reader until vStreamBufferSendCommit() (or
+ * vStreamBufferSendCommitFromISR()) is called.
+ *
+ * The free space is returned as a single contiguous region, so if the free
+ * space wraps around the end of the storage area only the part up to the end
+ * of the storage area is returned.  Commit that part, then acquire again to
+ * obtain the rest.
+ *
+ * Stream buffers assume there is only one writer, so the writer must not call
+ * any other send function between acquiring and committing a region.  Zero copy
+ * writes cannot be used with message buffers, which store the length of each
+ * message in front of the message.  When an MPU port is used the stream
+ * buffer's storage area must be accessible to the task that writes to it.
+ *
+ * Use xStreamBufferSendAcquire() from a task, and
+ * xStreamBufferSendAcquireFromISR() from an interrupt service routine (ISR).
+ *
+ * @param xStreamBuffer The handle of the stream buffer to write to.
+ *
+ * @param ppvWriteRegion Set to point to the start of the free region.  Only
+ * valid if the return value is greater than zero.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for space to become available if the stream buffer is
+ * full.  The task does not block if xTicksToWait is zero.
+ *
+ * @return The number of bytes that can be written to *ppvWriteRegion, which
+ * is zero if the stream buffer was full.
+ *
+ * Example use:
+<pre>
+void vAFunction( StreamBufferHandle_t xStreamBuffer )
+{
+uint8_t *pucRegion;
+size_t xRegionLength;
+
+    // Wait up to 100ms for space in the stream buffer.
+    xRegionLength = xStreamBufferSendAcquire( xStreamBuffer,
+                                              ( void ** ) &pucRegion,
+                                              pdMS_TO_TICKS( 100 ) );
+
+    if( xRegionLength > 0 )
+    {
+        // Write up to xRegionLength bytes to pucRegion, for example using a
+        // DMA transfer, then make them available to the reader.
+        vStreamBufferSendCommit( xStreamBuffer, xRegionLength );
+    }
+}
+</pre>
+ * \defgroup xStreamBufferSendAcquire xStreamBufferSendAcquire
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendAcquire( StreamBufferHandle_t xStreamBuffer,
+								 void **ppvWriteRegion,
+								 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+size_t xStreamBufferSendAcquireFromISR( StreamBufferHandle_t xStreamBuffer,
+										void **ppvWriteRegion ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+void vStreamBufferSendCommit( StreamBufferHandle_t xStreamBuffer,
+                              size_t xBytesWritten );
+
+void vStreamBufferSendCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+                                     size_t xBytesWritten,
+                                     BaseType_t *pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * The second half of a zero copy write.  Makes the first xBytesWritten bytes
+ * of the region obtained by the preceding call to xStreamBufferSendAcquire()
+ * (or xStreamBufferSendAcquireFromISR()) available to the reader, and unblocks
+ * the reader if it is waiting for data and the trigger level has been reached.
+ *
+ * Use vStreamBufferSendCommit() from a task, and
+ * vStreamBufferSendCommitFromISR() from an interrupt service routine (ISR).
+ *
+ * @param xStreamBuffer The handle of the stream buffer that was written to.
+ *
+ * @param xBytesWritten The number of bytes written to the acquired region.
+ * Must not be greater than the length returned when the region was acquired,
+ * and can be zero to release the region without sending anything.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if committing the data
+ * unblocked a task that has a priority above the currently executing task, in
+ * which case a context switch should be performed before the interrupt is
+ * exited.  *pxHigherPriorityTaskWoken should be set to pdFALSE before it is
+ * passed into the function.
+ *
+ * \defgroup vStreamBufferSendCommit vStreamBufferSendCommit
+ * \ingroup StreamBufferManagement
+ */
+void vStreamBufferSendCommit( StreamBufferHandle_t xStreamBuffer,
+							  size_t xBytesWritten ) PRIVILEGED_FUNCTION;
+
+void vStreamBufferSendCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+									 size_t xBytesWritten,
+									 BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferReceiveAcquire( StreamBufferHandle_t xStreamBuffer,
+                                    void **ppvReadRegion,
+                                    TickType_t xTicksToWait );
+
+size_t xStreamBufferReceiveAcquireFromISR( StreamBufferHandle_t xStreamBuffer,
+                                           void **ppvReadRegion );
+</pre>
+ *
+ * The first half of a zero copy read.  Obtains a pointer to the data held in
+ * the stream buffer's own storage area so the data can be processed in place
+ * (for example by a parser or a DMA controller) instead of being copied out by
+ * xStreamBufferReceive().  The data is not removed from the stream buffer, so
+ * the space it occupies does not become available to the writer, until
+ * vStreamBufferReceiveCommit() (or vStreamBufferReceiveCommitFromISR()) is
+ * called.
+ *
+ * The data is returned as a single contiguous region, so if the data wraps
+ * around the end of the storage area only the part up to the end of the
+ * storage area is returned.  Commit that part, then acquire again to obtain
+ * the rest.
+ *
+ * Stream buffers assume there is only one reader, so the reader must not call
+ * any other receive function between acquiring and committing a region.  Zero
+ * copy reads cannot be used with message buffers.
+ *
+ * Use xStreamBufferReceiveAcquire() from a task, and
+ * xStreamBufferReceiveAcquireFromISR() from an interrupt service routine (ISR).
+ *
+ * @param xStreamBuffer The handle of the stream buffer to read from.
+ *
+ * @param ppvReadRegion Set to point to the start of the data.  Only valid if
+ * the return value is greater than zero.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for data if the stream buffer is empty.  As with
+ * xStreamBufferReceive(), the task leaves the Blocked state when the trigger
+ * level is reached.  The task does not block if xTicksToWait is zero.
+ *
+ * @return The number of bytes that can be read from *ppvReadRegion, which is
+ * zero if the stream buffer was empty.
+ *
+ * \defgroup xStreamBufferReceiveAcquire xStreamBufferReceiveAcquire
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceiveAcquire( StreamBufferHandle_t xStreamBuffer,
+									void **ppvReadRegion,
+									TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+size_t xStreamBufferReceiveAcquireFromISR( StreamBufferHandle_t xStreamBuffer,
+										   void **ppvReadRegion ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+void vStreamBufferReceiveCommit( StreamBufferHandle_t xStreamBuffer,
+                                 size_t xBytesRead );
+
+void vStreamBufferReceiveCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+                                        size_t xBytesRead,
+                                        BaseType_t *pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * The second half of a zero copy read.  Removes the first xBytesRead bytes of
+ * the region obtained by the preceding call to xStreamBufferReceiveAcquire()
+ * (or xStreamBufferReceiveAcquireFromISR()) from the stream buffer, and
+ * unblocks the writer if it is waiting for space.
+ *
+ * Use vStreamBufferReceiveCommit() from a task, and
+ * vStreamBufferReceiveCommitFromISR() from an interrupt service routine (ISR).
+ *
+ * @param xStreamBuffer The handle of the stream buffer that was read from.
+ *
+ * @param xBytesRead The number of bytes consumed from the acquired region.
+ * Must not be greater than the length returned when the region was acquired,
+ * and can be zero to leave all the data in the stream buffer.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if removing the data
+ * unblocked a task that has a priority above the currently executing task, in
+ * which case a context switch should be performed before the interrupt is
+ * exited.  *pxHigherPriorityTaskWoken should be set to pdFALSE before it is
+ * passed into the function.
+ *
+ * \defgroup vStreamBufferReceiveCommit vStreamBufferReceiveCommit
+ * \ingroup StreamBufferManagement
+ */
+void vStreamBufferReceiveCommit( StreamBufferHandle_t xStreamBuffer,
+								 size_t xBytesRead ) PRIVILEGED_FUNCTION;
+
+void vStreamBufferReceiveCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+										size_t xBytesRead,
+										BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /**
  * stream_buffer.h
  *
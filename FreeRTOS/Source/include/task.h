@@ -48,6 +48,10 @@ extern "C" {
 #define tskKERNEL_VERSION_MINOR 1
 #define tskKERNEL_VERSION_BUILD 1
 
+/* The index within a task's array of notifications used by the task
+notification API functions and macros that do not take an index parameter. */
+#define tskDEFAULT_INDEX_TO_NOTIFY	( 0 )
+
 /**
  * task. h
  *
@@ -97,6 +101,41 @@ typedef struct xTIME_OUT
 	TickType_t xTimeOnEntering;
 } TimeOut_t;
 
+/*
+ * Used internally only.  Holds the tasks blocked on a queue, semaphore or
+ * mutex in task priority order.  When configUSE_PRIORITY_EVENT_LISTS is 1 the
+ * tasks are held in one FIFO list per priority, with uxWaitingPriorities
+ * recording which lists might not be empty in the same way uxTopReadyPriority
+ * does for the ready lists, so tasks can be added and removed without
+ * searching the list.
+ */
+#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+	typedef struct xEVENT_LIST
+	{
+		List_t xWaitingTasks[ configMAX_PRIORITIES ];
+		UBaseType_t uxWaitingPriorities;
+	} EventList_t;
+#else
+	typedef List_t EventList_t;
+#endif
+
+/*
+ * Used internally only.  Each mutex records the task that holds it.  When
+ * configUSE_TRANSITIVE_PRIORITY_INHERITANCE is 1 each mutex also records the
+ * tasks waiting for it, and the next mutex held by the same task.  This allows
+ * a priority to be inherited along a chain of tasks that are each blocked on a
+ * mutex held by the next, and a task's priority to be recalculated from all
+ * the mutexes it still holds when it gives one back.
+ */
+typedef struct xMUTEX_LINK
+{
+	TaskHandle_t xHolder;
+	#if( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+		struct xMUTEX_LINK *pxNextHeldMutex;
+		EventList_t *pxTasksWaiting;
+	#endif
+} MutexLink_t;
+
 /*
  * Defines the memory ranges allocated to the task when an MPU is used.
  */
@@ -134,11 +173,29 @@ typedef struct xTASK_STATUS
 	eTaskState eCurrentState;		/* The state in which the task existed when the structure was populated. */
 	UBaseType_t uxCurrentPriority;	/* The priority at which the task was running (may be inherited) when the structure was populated. */
 	UBaseType_t uxBasePriority;		/* The priority to which the task will return if the task's current priority has been inherited to avoid unbounded priority inversion when obtaining a mutex.  Only valid if configUSE_MUTEXES is defined as 1 in FreeRTOSConfig.h. */
-	uint32_t ulRunTimeCounter;		/* The total run time allocated to the task so far, as defined by the run time stats clock.  See http://www.freertos.org/rtos-run-time-stats.html.  Only valid when configGENERATE_RUN_TIME_STATS is defined as 1 in FreeRTOSConfig.h. */
+	configRUN_TIME_COUNTER_TYPE ulRunTimeCounter;	/* The total run time allocated to the task so far, as defined by the run time stats clock.  See http://www.freertos.org/rtos-run-time-stats.html.  Only valid when configGENERATE_RUN_TIME_STATS is defined as 1 in FreeRTOSConfig.h. */
 	StackType_t *pxStackBase;		/* Points to the lowest address of the task's stack area. */
 	configSTACK_DEPTH_TYPE usStackHighWaterMark;	/* The minimum amount of stack space that has remained for the task since the task was created.  The closer this value is to zero the closer the task has come to overflowing its stack. */
 } TaskStatus_t;
 
+/* Used with vTaskStatusIteratorInitialise() and xTaskStatusIteratorNext() to
+report the state of one task at a time. */
+typedef struct xTASK_STATUS_ITERATOR
+{
+	void *pvLastTask;				/* Private to the kernel - the task reported by the last call to xTaskStatusIteratorNext(), or NULL if no task has been reported yet. */
+	uint32_t ulLastTaskSequence;	/* Private to the kernel - the sequence number of the task reported last, used to find the next task if the task reported last has been deleted. */
+	UBaseType_t uxDeletedTasks;		/* Private to the kernel - used to detect whether any task has been deleted since the last call to xTaskStatusIteratorNext(). */
+	configRUN_TIME_COUNTER_TYPE ulTotalRunTime;	/* The total run time when the iterator was initialised, as defined by the run time stats clock.  Only valid when configGENERATE_RUN_TIME_STATS is defined as 1 in FreeRTOSConfig.h. */
+} TaskStatusIterator_t;
+
+/* Used with uxTaskGetLoadOverWindow() to hold the run time counter values at
+the start of the next measurement window. */
+typedef struct xTASK_LOAD_WINDOW
+{
+	configRUN_TIME_COUNTER_TYPE ulTaskRunTime;	/* The run time of the task when the window started. */
+	configRUN_TIME_COUNTER_TYPE ulTotalRunTime;	/* The total run time when the window started. */
+} TaskLoadWindow_t;
+
 /* Possible return values for eTaskConfirmSleepModeStatus(). */
 typedef enum
 {
@@ -154,6 +211,15 @@ typedef enum
  */
 #define tskIDLE_PRIORITY			( ( UBaseType_t ) 0U )
 
+/**
+ * The value returned by uxTaskGetLoadOverWindow() for a task that used all the
+ * processor time in the window.  The load is returned in hundredths of a
+ * percent.
+ *
+ * \ingroup TaskUtils
+ */
+#define tskLOAD_FULL_SCALE			( ( UBaseType_t ) 10000U )
+
 /**
  * task. h
  *
@@ -1390,7 +1456,12 @@ char *pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION; /*lint !e9
  * <PRE>TaskHandle_t xTaskGetHandle( const char *pcNameToQuery );</PRE>
  *
  * NOTE:  This function takes a relatively long time to complete and should be
- * used sparingly.
+ * used sparingly, unless configUSE_TASK_NAME_REGISTRY is set to 1 in
+ * FreeRTOSConfig.h.  The kernel then keeps a hash table of the task names,
+ * updated as tasks are created and deleted, so only the few tasks whose names
+ * hash to the same configTASK_NAME_REGISTRY_SIZE bucket are examined.  Tasks
+ * that have been deleted are then never found, even if the idle task has not
+ * yet freed their memory.
  *
  * @return The handle of the task that has the human readable name pcNameToQuery.
  * NULL is returned if no matching name is found.  INCLUDE_xTaskGetHandle
@@ -1455,6 +1526,32 @@ UBaseType_t uxTaskGetStackHighWaterMark( TaskHandle_t xTask ) PRIVILEGED_FUNCTIO
  */
 configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
 
+/**
+ * task.h
+ * <PRE>configSTACK_DEPTH_TYPE uxTaskGetStackWatermark( TaskHandle_t xTask );</PRE>
+ *
+ * configUSE_STACK_WATERMARK must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Returns an estimate of the high water mark of the stack associated with
+ * xTask, without scanning the stack, so it takes the same short time however
+ * large the stack is.  The value is the lower of the free stack space below
+ * the deepest stack pointer the task has saved at a context switch, and the
+ * free stack space found by the last complete scan of the stack.  The idle
+ * task scans the stacks of all the tasks in turn, examining
+ * configSTACK_WATERMARK_SCAN_BYTES bytes each time it runs, so the value may
+ * be higher than that returned by uxTaskGetStackHighWaterMark() until the
+ * stack has been scanned again.
+ *
+ * @param xTask Handle of the task associated with the stack to be checked.
+ * Set xTask to NULL to check the stack of the calling task.
+ *
+ * @return The estimated smallest amount of free stack space there has been (in
+ * words, so actual spaces on the stack rather than bytes) since the task
+ * referenced by xTask was created.
+ */
+configSTACK_DEPTH_TYPE uxTaskGetStackWatermark( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
 /* When using trace macros it is sometimes necessary to include task.h before
 FreeRTOS.h.  When this is done TaskHookFunction_t will not yet have been defined,
 so the following two prototypes will cause a compilation error.  This can be
@@ -1571,7 +1668,7 @@ TaskHandle_t xTaskGetIdleTaskHandle( void ) PRIVILEGED_FUNCTION;
 	{
 	TaskStatus_t *pxTaskStatusArray;
 	volatile UBaseType_t uxArraySize, x;
-	uint32_t ulTotalRunTime, ulStatsAsPercentage;
+	configRUN_TIME_COUNTER_TYPE ulTotalRunTime, ulStatsAsPercentage;
 
 		// Make sure the write buffer does not contain a string.
 		*pcWriteBuffer = 0x00;
@@ -1625,7 +1722,69 @@ TaskHandle_t xTaskGetIdleTaskHandle( void ) PRIVILEGED_FUNCTION;
 	}
 	</pre>
  */
-UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, uint32_t * const pulTotalRunTime ) PRIVILEGED_FUNCTION;
+UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime ) PRIVILEGED_FUNCTION;
+
+/**
+ * task.h
+ * <pre>void vTaskStatusIteratorInitialise( TaskStatusIterator_t * const pxIterator );</pre>
+ * <pre>BaseType_t xTaskStatusIteratorNext( TaskStatusIterator_t * const pxIterator, TaskStatus_t * const pxTaskStatus );</pre>
+ *
+ * configUSE_TRACE_FACILITY must be defined as 1 in FreeRTOSConfig.h for these
+ * functions to be available.
+ *
+ * An alternative to uxTaskGetSystemState() that populates a TaskStatus_t
+ * structure for one task per call, so the scheduler is only suspended for the
+ * time taken to locate and report a single task, and no array has to be sized
+ * for the number of tasks in the system.  This makes it suitable for
+ * periodically sending binary run time statistics to a host.
+ *
+ * vTaskStatusIteratorInitialise() resets the iterator and records the total
+ * run time in its ulTotalRunTime member.  Each subsequent call to
+ * xTaskStatusIteratorNext() fills *pxTaskStatus with the information for the
+ * next task.  Tasks are reported in the order in which they were created, so
+ * each task that exists for the whole of the iteration is reported exactly
+ * once.  A task created or deleted during the iteration may or may not be
+ * reported.  Each call takes a constant time, unless a task has been deleted
+ * since the previous call, in which case the time taken is proportional to the
+ * number of tasks.
+ *
+ * The usStackHighWaterMark member is set to the value returned by
+ * uxTaskGetStackWatermark() if configUSE_STACK_WATERMARK is set to 1 in
+ * FreeRTOSConfig.h, and to 0 otherwise, as scanning the stack would keep the
+ * scheduler suspended for a time proportional to the stack size.
+ *
+ * @param pxIterator The iterator, which must be initialised by
+ * vTaskStatusIteratorInitialise() before it is passed to
+ * xTaskStatusIteratorNext().
+ *
+ * @param pxTaskStatus The structure to fill with the information for the next
+ * task.
+ *
+ * @return pdTRUE if *pxTaskStatus was filled in, or pdFALSE if every task has
+ * already been reported.
+ *
+ * Example usage:
+   <pre>
+	void vSendRunTimeStats( void )
+	{
+	TaskStatusIterator_t xIterator;
+	TaskStatus_t xStatus;
+
+		vTaskStatusIteratorInitialise( &xIterator );
+		vSendTotalRunTime( xIterator.ulTotalRunTime );
+
+		while( xTaskStatusIteratorNext( &xIterator, &xStatus ) != pdFALSE )
+		{
+			// Other tasks can run between each call.
+			vSendTaskStatus( &xStatus );
+		}
+	}
+   </pre>
+ * \defgroup xTaskStatusIteratorNext xTaskStatusIteratorNext
+ * \ingroup TaskUtils
+ */
+void vTaskStatusIteratorInitialise( TaskStatusIterator_t * const pxIterator ) PRIVILEGED_FUNCTION;
+BaseType_t xTaskStatusIteratorNext( TaskStatusIterator_t * const pxIterator, TaskStatus_t * const pxTaskStatus ) PRIVILEGED_FUNCTION;
 
 /**
  * task. h
@@ -1728,15 +1887,99 @@ void vTaskList( char * pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unquali
  */
 void vTaskGetRunTimeStats( char *pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 
+/**
+ * task. h
+ * <PRE>configRUN_TIME_COUNTER_TYPE ulTaskGetRunTimeCounter( const TaskHandle_t xTask );</PRE>
+ *
+ * configGENERATE_RUN_TIME_STATS must be defined as 1 for this function to be
+ * available.
+ *
+ * Returns the total time the task has spent in the Running state, as defined
+ * by the run time stats clock, including the time since it was last switched
+ * in if it is the calling task.
+ *
+ * The counter is of type configRUN_TIME_COUNTER_TYPE, which defaults to
+ * uint32_t.  A fast run time stats clock can overflow a 32-bit counter within
+ * minutes, so configRUN_TIME_COUNTER_TYPE can be defined as uint64_t in
+ * FreeRTOSConfig.h, in which case portGET_RUN_TIME_COUNTER_VALUE() must also
+ * return a 64-bit value.
+ *
+ * @param xTask The task being queried.  Passing NULL queries the calling
+ * task.
+ *
+ * @return The run time counter value of xTask.
+ *
+ * \defgroup ulTaskGetRunTimeCounter ulTaskGetRunTimeCounter
+ * \ingroup TaskUtils
+ */
+configRUN_TIME_COUNTER_TYPE ulTaskGetRunTimeCounter( const TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>UBaseType_t uxTaskGetLoadOverWindow( const TaskHandle_t xTask, TaskLoadWindow_t * const pxWindow );</PRE>
+ *
+ * configGENERATE_RUN_TIME_STATS must be defined as 1 for this function to be
+ * available.
+ *
+ * Returns the proportion of the processor time used by a task since the
+ * previous call that used the same window structure, then starts a new
+ * window.  Calling the function periodically therefore gives the recent load
+ * of the task, rather than the average since the system started as reported
+ * by vTaskGetRunTimeStats().  A window structure initialised to all zeros
+ * measures the load since the run time counter was zero.
+ *
+ * The result is correct even if the run time counters wrap once during a
+ * window, so a 32-bit configRUN_TIME_COUNTER_TYPE can be used provided the
+ * function is called more often than the run time stats clock overflows.
+ *
+ * @param xTask The task being queried.  Passing NULL queries the calling
+ * task.
+ *
+ * @param pxWindow Holds the counter values at the start of the window, and is
+ * updated to start the next window.  Use a separate window structure for each
+ * task being monitored.
+ *
+ * @return The load of the task over the window, in hundredths of a percent,
+ * so tskLOAD_FULL_SCALE indicates the task used all the processor time.
+ *
+ * Example usage:
+   <pre>
+	void vMonitorTask( void *pvParameters )
+	{
+	TaskLoadWindow_t xIdleWindow = { 0 };
+	UBaseType_t uxIdleLoad;
+
+		for( ;; )
+		{
+			vTaskDelay( pdMS_TO_TICKS( 1000 ) );
+
+			// The processor load over the last second is the time not spent
+			// in the idle task.
+			uxIdleLoad = uxTaskGetLoadOverWindow( xTaskGetIdleTaskHandle(), &xIdleWindow );
+			vReportLoad( tskLOAD_FULL_SCALE - uxIdleLoad );
+		}
+	}
+   </pre>
+ * \defgroup uxTaskGetLoadOverWindow uxTaskGetLoadOverWindow
+ * \ingroup TaskUtils
+ */
+UBaseType_t uxTaskGetLoadOverWindow( const TaskHandle_t xTask, TaskLoadWindow_t * const pxWindow ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * <PRE>BaseType_t xTaskNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction );</PRE>
+ * <PRE>BaseType_t xTaskNotifyIndexed( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction );</PRE>
  *
  * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this
  * function to be available.
  *
  * When configUSE_TASK_NOTIFICATIONS is set to one each task has its own private
- * "notification value", which is a 32-bit unsigned integer (uint32_t).
+ * array of configTASK_NOTIFICATION_ARRAY_ENTRIES notifications.  Each
+ * notification has a state, pending or not pending, and a "notification value",
+ * which is a 32-bit unsigned integer (uint32_t).  The notifications in the
+ * array are independent of each other.  The API functions and macros whose
+ * names end in "Indexed" take the index of the notification to use, the others
+ * always use the notification at index 0 (tskDEFAULT_INDEX_TO_NOTIFY).
  *
  * Events can be sent to a task using an intermediary object.  Examples of such
  * objects are queues, semaphores, mutexes and event groups.  Task notifications
@@ -1766,6 +2009,11 @@ void vTaskGetRunTimeStats( char *pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e9
  * task, and the handle of the currently running task can be obtained by calling
  * xTaskGetCurrentTaskHandle().
  *
+ * @param uxIndexToNotify The index within the notified task's array of
+ * notifications to which the notification is sent.  Must be less than
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES.  xTaskNotify() does not have this
+ * parameter and always sends the notification to index 0.
+ *
  * @param ulValue Data that can be sent with the notification.  How the data is
  * used depends on the value of the eAction parameter.
  *
@@ -1807,19 +2055,27 @@ void vTaskGetRunTimeStats( char *pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e9
  * \defgroup xTaskNotify xTaskNotify
  * \ingroup TaskNotifications
  */
-BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue ) PRIVILEGED_FUNCTION;
-#define xTaskNotify( xTaskToNotify, ulValue, eAction ) xTaskGenericNotify( ( xTaskToNotify ), ( ulValue ), ( eAction ), NULL )
-#define xTaskNotifyAndQuery( xTaskToNotify, ulValue, eAction, pulPreviousNotifyValue ) xTaskGenericNotify( ( xTaskToNotify ), ( ulValue ), ( eAction ), ( pulPreviousNotifyValue ) )
+BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue ) PRIVILEGED_FUNCTION;
+#define xTaskNotify( xTaskToNotify, ulValue, eAction ) xTaskGenericNotify( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulValue ), ( eAction ), NULL )
+#define xTaskNotifyIndexed( xTaskToNotify, uxIndexToNotify, ulValue, eAction ) xTaskGenericNotify( ( xTaskToNotify ), ( uxIndexToNotify ), ( ulValue ), ( eAction ), NULL )
+#define xTaskNotifyAndQuery( xTaskToNotify, ulValue, eAction, pulPreviousNotifyValue ) xTaskGenericNotify( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulValue ), ( eAction ), ( pulPreviousNotifyValue ) )
+#define xTaskNotifyAndQueryIndexed( xTaskToNotify, uxIndexToNotify, ulValue, eAction, pulPreviousNotifyValue ) xTaskGenericNotify( ( xTaskToNotify ), ( uxIndexToNotify ), ( ulValue ), ( eAction ), ( pulPreviousNotifyValue ) )
 
 /**
  * task. h
  * <PRE>BaseType_t xTaskNotifyFromISR( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, BaseType_t *pxHigherPriorityTaskWoken );</PRE>
+ * <PRE>BaseType_t xTaskNotifyIndexedFromISR( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction, BaseType_t *pxHigherPriorityTaskWoken );</PRE>
  *
  * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this
  * function to be available.
  *
  * When configUSE_TASK_NOTIFICATIONS is set to one each task has its own private
- * "notification value", which is a 32-bit unsigned integer (uint32_t).
+ * array of configTASK_NOTIFICATION_ARRAY_ENTRIES notifications.  Each
+ * notification has a state, pending or not pending, and a "notification value",
+ * which is a 32-bit unsigned integer (uint32_t).  The notifications in the
+ * array are independent of each other.  The API functions and macros whose
+ * names end in "Indexed" take the index of the notification to use, the others
+ * always use the notification at index 0 (tskDEFAULT_INDEX_TO_NOTIFY).
  *
  * A version of xTaskNotify() that can be used from an interrupt service routine
  * (ISR).
@@ -1852,6 +2108,11 @@ BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNo
  * task, and the handle of the currently running task can be obtained by calling
  * xTaskGetCurrentTaskHandle().
  *
+ * @param uxIndexToNotify The index within the notified task's array of
+ * notifications to which the notification is sent.  Must be less than
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES.  xTaskNotifyFromISR() does not have
+ * this parameter and always sends the notification to index 0.
+ *
  * @param ulValue Data that can be sent with the notification.  How the data is
  * used depends on the value of the eAction parameter.
  *
@@ -1898,19 +2159,27 @@ BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNo
  * \defgroup xTaskNotify xTaskNotify
  * \ingroup TaskNotifications
  */
-BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
-#define xTaskNotifyFromISR( xTaskToNotify, ulValue, eAction, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( ulValue ), ( eAction ), NULL, ( pxHigherPriorityTaskWoken ) )
-#define xTaskNotifyAndQueryFromISR( xTaskToNotify, ulValue, eAction, pulPreviousNotificationValue, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( ulValue ), ( eAction ), ( pulPreviousNotificationValue ), ( pxHigherPriorityTaskWoken ) )
+BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#define xTaskNotifyFromISR( xTaskToNotify, ulValue, eAction, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulValue ), ( eAction ), NULL, ( pxHigherPriorityTaskWoken ) )
+#define xTaskNotifyIndexedFromISR( xTaskToNotify, uxIndexToNotify, ulValue, eAction, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( uxIndexToNotify ), ( ulValue ), ( eAction ), NULL, ( pxHigherPriorityTaskWoken ) )
+#define xTaskNotifyAndQueryFromISR( xTaskToNotify, ulValue, eAction, pulPreviousNotificationValue, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulValue ), ( eAction ), ( pulPreviousNotificationValue ), ( pxHigherPriorityTaskWoken ) )
+#define xTaskNotifyAndQueryIndexedFromISR( xTaskToNotify, uxIndexToNotify, ulValue, eAction, pulPreviousNotificationValue, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( uxIndexToNotify ), ( ulValue ), ( eAction ), ( pulPreviousNotificationValue ), ( pxHigherPriorityTaskWoken ) )
 
 /**
  * task. h
  * <PRE>BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait );</pre>
+ * <PRE>BaseType_t xTaskNotifyWaitIndexed( UBaseType_t uxIndexToWaitOn, uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait );</pre>
  *
  * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this
  * function to be available.
  *
  * When configUSE_TASK_NOTIFICATIONS is set to one each task has its own private
- * "notification value", which is a 32-bit unsigned integer (uint32_t).
+ * array of configTASK_NOTIFICATION_ARRAY_ENTRIES notifications.  Each
+ * notification has a state, pending or not pending, and a "notification value",
+ * which is a 32-bit unsigned integer (uint32_t).  The notifications in the
+ * array are independent of each other.  The API functions and macros whose
+ * names end in "Indexed" take the index of the notification to use, the others
+ * always use the notification at index 0 (tskDEFAULT_INDEX_TO_NOTIFY).
  *
  * Events can be sent to a task using an intermediary object.  Examples of such
  * objects are queues, semaphores, mutexes and event groups.  Task notifications
@@ -1935,6 +2204,11 @@ BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, uint32_t ulVal
  *
  * See http://www.FreeRTOS.org/RTOS-task-notifications.html for details.
  *
+ * @param uxIndexToWaitOn The index within the calling task's array of
+ * notifications on which the calling task waits.  Must be less than
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES.  xTaskNotifyWait() does not have this
+ * parameter and always waits on index 0.
+ *
  * @param ulBitsToClearOnEntry Bits that are set in ulBitsToClearOnEntry value
  * will be cleared in the calling task's notification value before the task
  * checks to see if any notifications are pending, and optionally blocks if no
@@ -1975,17 +2249,25 @@ BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, uint32_t ulVal
  * \defgroup xTaskNotifyWait xTaskNotifyWait
  * \ingroup TaskNotifications
  */
-BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+BaseType_t xTaskGenericNotifyWait( UBaseType_t uxIndexToWaitOn, uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#define xTaskNotifyWait( ulBitsToClearOnEntry, ulBitsToClearOnExit, pulNotificationValue, xTicksToWait ) xTaskGenericNotifyWait( ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulBitsToClearOnEntry ), ( ulBitsToClearOnExit ), ( pulNotificationValue ), ( xTicksToWait ) )
+#define xTaskNotifyWaitIndexed( uxIndexToWaitOn, ulBitsToClearOnEntry, ulBitsToClearOnExit, pulNotificationValue, xTicksToWait ) xTaskGenericNotifyWait( ( uxIndexToWaitOn ), ( ulBitsToClearOnEntry ), ( ulBitsToClearOnExit ), ( pulNotificationValue ), ( xTicksToWait ) )
 
 /**
  * task. h
  * <PRE>BaseType_t xTaskNotifyGive( TaskHandle_t xTaskToNotify );</PRE>
+ * <PRE>BaseType_t xTaskNotifyGiveIndexed( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify );</PRE>
  *
  * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this macro
  * to be available.
  *
  * When configUSE_TASK_NOTIFICATIONS is set to one each task has its own private
- * "notification value", which is a 32-bit unsigned integer (uint32_t).
+ * array of configTASK_NOTIFICATION_ARRAY_ENTRIES notifications.  Each
+ * notification has a state, pending or not pending, and a "notification value",
+ * which is a 32-bit unsigned integer (uint32_t).  The notifications in the
+ * array are independent of each other.  The API functions and macros whose
+ * names end in "Indexed" take the index of the notification to use, the others
+ * always use the notification at index 0 (tskDEFAULT_INDEX_TO_NOTIFY).
  *
  * Events can be sent to a task using an intermediary object.  Examples of such
  * objects are queues, semaphores, mutexes and event groups.  Task notifications
@@ -2015,23 +2297,35 @@ BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClea
  * task, and the handle of the currently running task can be obtained by calling
  * xTaskGetCurrentTaskHandle().
  *
+ * @param uxIndexToNotify The index within the notified task's array of
+ * notifications to which the notification is sent.  Must be less than
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES.  xTaskNotifyGive() does not have this
+ * parameter and always sends the notification to index 0.
+ *
  * @return xTaskNotifyGive() is a macro that calls xTaskNotify() with the
  * eAction parameter set to eIncrement - so pdPASS is always returned.
  *
  * \defgroup xTaskNotifyGive xTaskNotifyGive
  * \ingroup TaskNotifications
  */
-#define xTaskNotifyGive( xTaskToNotify ) xTaskGenericNotify( ( xTaskToNotify ), ( 0 ), eIncrement, NULL )
+#define xTaskNotifyGive( xTaskToNotify ) xTaskGenericNotify( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( 0 ), eIncrement, NULL )
+#define xTaskNotifyGiveIndexed( xTaskToNotify, uxIndexToNotify ) xTaskGenericNotify( ( xTaskToNotify ), ( uxIndexToNotify ), ( 0 ), eIncrement, NULL )
 
 /**
  * task. h
- * <PRE>void vTaskNotifyGiveFromISR( TaskHandle_t xTaskHandle, BaseType_t *pxHigherPriorityTaskWoken );
+ * <PRE>void vTaskNotifyGiveFromISR( TaskHandle_t xTaskHandle, BaseType_t *pxHigherPriorityTaskWoken );</PRE>
+ * <PRE>void vTaskNotifyGiveIndexedFromISR( TaskHandle_t xTaskHandle, UBaseType_t uxIndexToNotify, BaseType_t *pxHigherPriorityTaskWoken );</PRE>
  *
  * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this macro
  * to be available.
  *
  * When configUSE_TASK_NOTIFICATIONS is set to one each task has its own private
- * "notification value", which is a 32-bit unsigned integer (uint32_t).
+ * array of configTASK_NOTIFICATION_ARRAY_ENTRIES notifications.  Each
+ * notification has a state, pending or not pending, and a "notification value",
+ * which is a 32-bit unsigned integer (uint32_t).  The notifications in the
+ * array are independent of each other.  The API functions and macros whose
+ * names end in "Indexed" take the index of the notification to use, the others
+ * always use the notification at index 0 (tskDEFAULT_INDEX_TO_NOTIFY).
  *
  * A version of xTaskNotifyGive() that can be called from an interrupt service
  * routine (ISR).
@@ -2064,6 +2358,11 @@ BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClea
  * task, and the handle of the currently running task can be obtained by calling
  * xTaskGetCurrentTaskHandle().
  *
+ * @param uxIndexToNotify The index within the notified task's array of
+ * notifications to which the notification is sent.  Must be less than
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES.  vTaskNotifyGiveFromISR() does not
+ * have this parameter and always sends the notification to index 0.
+ *
  * @param pxHigherPriorityTaskWoken  vTaskNotifyGiveFromISR() will set
  * *pxHigherPriorityTaskWoken to pdTRUE if sending the notification caused the
  * task to which the notification was sent to leave the Blocked state, and the
@@ -2076,17 +2375,25 @@ BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClea
  * \defgroup xTaskNotifyWait xTaskNotifyWait
  * \ingroup TaskNotifications
  */
-void vTaskNotifyGiveFromISR( TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+void vTaskGenericNotifyGiveFromISR( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#define vTaskNotifyGiveFromISR( xTaskToNotify, pxHigherPriorityTaskWoken ) vTaskGenericNotifyGiveFromISR( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( pxHigherPriorityTaskWoken ) )
+#define vTaskNotifyGiveIndexedFromISR( xTaskToNotify, uxIndexToNotify, pxHigherPriorityTaskWoken ) vTaskGenericNotifyGiveFromISR( ( xTaskToNotify ), ( uxIndexToNotify ), ( pxHigherPriorityTaskWoken ) )
 
 /**
  * task. h
  * <PRE>uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait );</pre>
+ * <PRE>uint32_t ulTaskNotifyTakeIndexed( UBaseType_t uxIndexToWaitOn, BaseType_t xClearCountOnExit, TickType_t xTicksToWait );</pre>
  *
  * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this
  * function to be available.
  *
  * When configUSE_TASK_NOTIFICATIONS is set to one each task has its own private
- * "notification value", which is a 32-bit unsigned integer (uint32_t).
+ * array of configTASK_NOTIFICATION_ARRAY_ENTRIES notifications.  Each
+ * notification has a state, pending or not pending, and a "notification value",
+ * which is a 32-bit unsigned integer (uint32_t).  The notifications in the
+ * array are independent of each other.  The API functions and macros whose
+ * names end in "Indexed" take the index of the notification to use, the others
+ * always use the notification at index 0 (tskDEFAULT_INDEX_TO_NOTIFY).
  *
  * Events can be sent to a task using an intermediary object.  Examples of such
  * objects are queues, semaphores, mutexes and event groups.  Task notifications
@@ -2124,6 +2431,11 @@ void vTaskNotifyGiveFromISR( TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPri
  *
  * See http://www.FreeRTOS.org/RTOS-task-notifications.html for details.
  *
+ * @param uxIndexToWaitOn The index within the calling task's array of
+ * notifications on which the calling task waits.  Must be less than
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES.  ulTaskNotifyTake() does not have this
+ * parameter and always waits on index 0.
+ *
  * @param xClearCountOnExit if xClearCountOnExit is pdFALSE then the task's
  * notification value is decremented when the function exits.  In this way the
  * notification value acts like a counting semaphore.  If xClearCountOnExit is
@@ -2145,23 +2457,33 @@ void vTaskNotifyGiveFromISR( TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPri
  * \defgroup ulTaskNotifyTake ulTaskNotifyTake
  * \ingroup TaskNotifications
  */
-uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+uint32_t ulTaskGenericNotifyTake( UBaseType_t uxIndexToWaitOn, BaseType_t xClearCountOnExit, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#define ulTaskNotifyTake( xClearCountOnExit, xTicksToWait ) ulTaskGenericNotifyTake( ( tskDEFAULT_INDEX_TO_NOTIFY ), ( xClearCountOnExit ), ( xTicksToWait ) )
+#define ulTaskNotifyTakeIndexed( uxIndexToWaitOn, xClearCountOnExit, xTicksToWait ) ulTaskGenericNotifyTake( ( uxIndexToWaitOn ), ( xClearCountOnExit ), ( xTicksToWait ) )
 
 /**
  * task. h
  * <PRE>BaseType_t xTaskNotifyStateClear( TaskHandle_t xTask );</pre>
+ * <PRE>BaseType_t xTaskNotifyStateClearIndexed( TaskHandle_t xTask, UBaseType_t uxIndexToClear );</pre>
  *
  * If the notification state of the task referenced by the handle xTask is
  * eNotified, then set the task's notification state to eNotWaitingNotification.
  * The task's notification value is not altered.  Set xTask to NULL to clear the
  * notification state of the calling task.
  *
+ * @param uxIndexToClear The index within the task's array of notifications of
+ * the notification to clear.  Must be less than
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES.  xTaskNotifyStateClear() does not have
+ * this parameter and always clears the notification at index 0.
+ *
  * @return pdTRUE if the task's notification state was set to
  * eNotWaitingNotification, otherwise pdFALSE.
  * \defgroup xTaskNotifyStateClear xTaskNotifyStateClear
  * \ingroup TaskNotifications
  */
-BaseType_t xTaskNotifyStateClear( TaskHandle_t xTask );
+BaseType_t xTaskGenericNotifyStateClear( TaskHandle_t xTask, UBaseType_t uxIndexToClear ) PRIVILEGED_FUNCTION;
+#define xTaskNotifyStateClear( xTask ) xTaskGenericNotifyStateClear( ( xTask ), ( tskDEFAULT_INDEX_TO_NOTIFY ) )
+#define xTaskNotifyStateClearIndexed( xTask, uxIndexToClear ) xTaskGenericNotifyStateClear( ( xTask ), ( uxIndexToClear ) )
 
 /*-----------------------------------------------------------
  * SCHEDULER INTERNALS AVAILABLE FOR PORTING PURPOSES
@@ -2202,7 +2524,9 @@ BaseType_t xTaskIncrementTick( void ) PRIVILEGED_FUNCTION;
  *
  * The 'ordered' version uses the existing event list item value (which is the
  * owning tasks priority) to insert the list item into the event list is task
- * priority order.
+ * priority order.  When configUSE_PRIORITY_EVENT_LISTS is 1 the list item is
+ * instead appended to the event list's FIFO list for the task's priority, so
+ * the time taken does not depend on the number of tasks already waiting.
  *
  * @param pxEventList The list containing tasks that are blocked waiting
  * for the event to occur.
@@ -2215,7 +2539,7 @@ BaseType_t xTaskIncrementTick( void ) PRIVILEGED_FUNCTION;
  * portTICK_PERIOD_MS can be used to convert kernel ticks into a real time
  * period.
  */
-void vTaskPlaceOnEventList( List_t * const pxEventList, const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+void vTaskPlaceOnEventList( EventList_t * const pxEventList, const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 void vTaskPlaceOnUnorderedEventList( List_t * pxEventList, const TickType_t xItemValue, const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
 /*
@@ -2229,7 +2553,7 @@ void vTaskPlaceOnUnorderedEventList( List_t * pxEventList, const TickType_t xIte
  * indefinitely, whereas vTaskPlaceOnEventList() does.
  *
  */
-void vTaskPlaceOnEventListRestricted( List_t * const pxEventList, TickType_t xTicksToWait, const BaseType_t xWaitIndefinitely ) PRIVILEGED_FUNCTION;
+void vTaskPlaceOnEventListRestricted( EventList_t * const pxEventList, TickType_t xTicksToWait, const BaseType_t xWaitIndefinitely ) PRIVILEGED_FUNCTION;
 
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
@@ -2255,9 +2579,36 @@ void vTaskPlaceOnEventListRestricted( List_t * const pxEventList, TickType_t xTi
  * @return pdTRUE if the task being removed has a higher priority than the task
  * making the call, otherwise pdFALSE.
  */
-BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList ) PRIVILEGED_FUNCTION;
+BaseType_t xTaskRemoveFromEventList( EventList_t * const pxEventList ) PRIVILEGED_FUNCTION;
 void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem, const TickType_t xItemValue ) PRIVILEGED_FUNCTION;
 
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * THEY MUST BE CALLED WITH INTERRUPTS DISABLED.
+ *
+ * vTaskEventListInitialise() initialises an event list so it contains no
+ * tasks.  xTaskEventListIsEmpty() returns pdTRUE if no tasks are waiting on
+ * an event list, otherwise pdFALSE.  When configUSE_PRIORITY_EVENT_LISTS is 0
+ * an event list is a List_t, so these map directly onto the list macros.
+ *
+ * uxTaskEventListGetHighestPriority() returns the priority of the highest
+ * priority task waiting on an event list, or tskIDLE_PRIORITY if no tasks are
+ * waiting.  It is used by the mutex implementation.
+ */
+#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+	void vTaskEventListInitialise( EventList_t * const pxEventList ) PRIVILEGED_FUNCTION;
+	BaseType_t xTaskEventListIsEmpty( EventList_t * const pxEventList ) PRIVILEGED_FUNCTION;
+#else
+	#define vTaskEventListInitialise( pxEventList ) vListInitialise( ( pxEventList ) )
+	#define xTaskEventListIsEmpty( pxEventList ) listLIST_IS_EMPTY( ( pxEventList ) )
+#endif
+
+#if( configUSE_MUTEXES == 1 )
+	UBaseType_t uxTaskEventListGetHighestPriority( EventList_t * const pxEventList ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS ONLY
  * INTENDED FOR USE WHEN IMPLEMENTING A PORT OF THE SCHEDULER AND IS
@@ -2324,6 +2675,42 @@ BaseType_t xTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder ) PRIVILEGE
  */
 void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder, UBaseType_t uxHighestPriorityWaitingTask ) PRIVILEGED_FUNCTION;
 
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE MUTEX IMPLEMENTATION.
+ *
+ * Used in place of pvTaskIncrementMutexHeldCount(), xTaskPriorityInherit(),
+ * xTaskPriorityDisinherit() and vTaskPriorityDisinheritAfterTimeout() when
+ * configUSE_TRANSITIVE_PRIORITY_INHERITANCE is 1.
+ *
+ * vTaskMutexTaken() records the calling task as the holder of pxMutex.
+ *
+ * xTaskPriorityInheritThroughMutex() is called before the calling task blocks
+ * on pxMutex.  The holder of pxMutex inherits the calling task's priority, and
+ * if the holder is itself blocked on a mutex then the holder of that mutex
+ * inherits it too, and so on along the chain.  Returns pdTRUE if the holder of
+ * pxMutex has a priority above its base priority as a result.
+ *
+ * xTaskPriorityDisinheritMutex() is called when the holder gives pxMutex back.
+ * The holder's priority is set to the higher of its base priority and the
+ * priority of the highest priority task waiting for any mutex it still holds.
+ * Returns pdTRUE if the holder's priority changed.
+ *
+ * vTaskPriorityDisinheritMutexAfterTimeout() is called when the calling task
+ * stops waiting for pxMutex without obtaining it.  The priority of the holder,
+ * and of each task along the chain, is recalculated in the same way.
+ *
+ * vTaskMutexDeleted() is called when pxMutex is deleted, in case it is still
+ * held.
+ */
+#if( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+	void vTaskMutexTaken( MutexLink_t * const pxMutex ) PRIVILEGED_FUNCTION;
+	BaseType_t xTaskPriorityInheritThroughMutex( MutexLink_t * const pxMutex ) PRIVILEGED_FUNCTION;
+	BaseType_t xTaskPriorityDisinheritMutex( MutexLink_t * const pxMutex ) PRIVILEGED_FUNCTION;
+	void vTaskPriorityDisinheritMutexAfterTimeout( MutexLink_t * const pxMutex ) PRIVILEGED_FUNCTION;
+	void vTaskMutexDeleted( MutexLink_t * const pxMutex ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Get the uxTCBNumber assigned to the task referenced by the xTask parameter.
  */
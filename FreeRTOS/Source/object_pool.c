@@ -0,0 +1,136 @@
+/*
+ * FreeRTOS Kernel V10.1.1
+ * Copyright (C) 2018 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "object_pool.h"
+
+/* Lint e961, e9021 and e750 are suppressed as a MISRA exception justified
+because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+for the header files above, but not in this file, in order to generate the
+correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021. */
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+	#error object_pool.c must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+/* The first object in the pool, which is the start of the pool's storage
+rounded up to the alignment of pvPortMalloc(). */
+#define objectpoolFIRST_OBJECT( pxPool ) ( ( uint8_t * ) ( ( ( portPOINTER_SIZE_TYPE ) ( pxPool )->pucStorage + ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) & ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) )
+
+/*-----------------------------------------------------------*/
+
+void *pvObjectPoolMalloc( ObjectPool_t *pxPool, size_t xWantedSize )
+{
+void *pvReturn = NULL;
+
+	configASSERT( pxPool );
+
+	/* A freed object holds a pointer to the next free object. */
+	configASSERT( pxPool->xObjectSize >= sizeof( void * ) );
+
+	if( xWantedSize <= pxPool->xObjectSize )
+	{
+		taskENTER_CRITICAL();
+		{
+			if( pxPool->pvFreeList != NULL )
+			{
+				/* Reuse the object that was freed most recently. */
+				pvReturn = pxPool->pvFreeList;
+				pxPool->pvFreeList = *( ( void ** ) pvReturn );
+			}
+			else if( pxPool->uxObjectsUsed < pxPool->uxObjectCount )
+			{
+				/* Use the next object that has never been allocated. */
+				pvReturn = ( void * ) ( objectpoolFIRST_OBJECT( pxPool ) + ( pxPool->xObjectSize * ( size_t ) pxPool->uxObjectsUsed ) );
+				( pxPool->uxObjectsUsed )++;
+			}
+			else
+			{
+				/* The pool is empty. */
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( pvReturn == NULL )
+	{
+		pvReturn = pvPortMalloc( xWantedSize );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vObjectPoolFree( ObjectPool_t *pxPool, void *pv )
+{
+uint8_t * const pucObject = ( uint8_t * ) pv;
+uint8_t * const pucFirstObject = objectpoolFIRST_OBJECT( pxPool );
+
+	configASSERT( pxPool );
+
+	if( ( pucObject >= pucFirstObject ) && ( pucObject < ( pucFirstObject + ( pxPool->xObjectSize * ( size_t ) pxPool->uxObjectCount ) ) ) )
+	{
+		/* The object must be the start of an object that has been
+		allocated. */
+		configASSERT( ( ( size_t ) ( pucObject - pucFirstObject ) % pxPool->xObjectSize ) == ( size_t ) 0 );
+
+		taskENTER_CRITICAL();
+		{
+			*( ( void ** ) pv ) = pxPool->pvFreeList;
+			pxPool->pvFreeList = pv;
+		}
+		taskEXIT_CRITICAL();
+	}
+	else
+	{
+		/* The object was allocated from the heap because the pool was empty
+		or the object was too large. */
+		vPortFree( pv );
+	}
+}
+/*-----------------------------------------------------------*/
+
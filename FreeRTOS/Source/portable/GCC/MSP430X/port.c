@@ -39,6 +39,40 @@ not the MCLK. */
 #define portINITIAL_CRITICAL_NESTING	( ( uint16_t ) 10 )
 #define portFLAGS_INT_ENABLED			( ( StackType_t ) 0x08 )
 
+/* When configUSE_TICKLESS_IDLE is 1 the port must be able to reprogram the
+timer that generates the tick.  It is assumed vApplicationSetupTimerInterrupt()
+configures a Timer_A to count in up mode from the ACLK, with capture/compare
+register 0 generating the tick interrupt.  Timer A0 is used unless the
+following are defined in FreeRTOSConfig.h. */
+#ifndef configTICK_TIMER_CTL
+	#define configTICK_TIMER_CTL		TA0CTL
+	#define configTICK_TIMER_R			TA0R
+	#define configTICK_TIMER_CCR0		TA0CCR0
+	#define configTICK_TIMER_CCTL0		TA0CCTL0
+#endif
+
+/* When configRUN_TIME_TIMER_VECTOR is defined the port provides the run time
+stats counter from a 16-bit timer running in continuous mode, with the timer
+overflow interrupt extending the count to the width of
+configRUN_TIME_COUNTER_TYPE.  Timer A1 clocked from SMCLK is used unless the
+following are defined in FreeRTOSConfig.h.  A Timer_B can be used by defining
+them to the equivalent Timer_B registers, as the control bits are at the same
+positions.  The overflow interrupt shares its vector with the timer's
+capture/compare registers 1 and above, so the application must not use those
+interrupts. */
+#if( ( configGENERATE_RUN_TIME_STATS == 1 ) && defined( configRUN_TIME_TIMER_VECTOR ) )
+	#ifndef configRUN_TIME_TIMER_CTL
+		#define configRUN_TIME_TIMER_CTL	TA1CTL
+		#define configRUN_TIME_TIMER_R		TA1R
+	#endif
+
+	#ifndef configRUN_TIME_TIMER_CLOCK
+		#define configRUN_TIME_TIMER_CLOCK	( TASSEL_2 | ID__1 )
+	#endif
+
+	#define portRUN_TIME_TIMER_PERIOD		( ( configRUN_TIME_COUNTER_TYPE ) 0x10000UL )
+#endif
+
 /* We require the address of the pxCurrentTCB variable, but don't want to know
 any details of its type. */
 typedef void TCB_t;
@@ -53,6 +87,29 @@ usCriticalNesting will get set to zero when the scheduler starts, but must
 not be initialised to zero as this will cause problems during the startup
 sequence. */
 volatile uint16_t usCriticalNesting = portINITIAL_CRITICAL_NESTING;
+
+#if( configUSE_TICKLESS_IDLE == 1 )
+
+	/* The number of timer counts that make up one tick period, and the
+	maximum number of tick periods that can be suppressed before the 16-bit
+	compare value would overflow.  Both are calculated from the period chosen
+	by vApplicationSetupTimerInterrupt(). */
+	static uint16_t usTimerCountsForOneTick = 0;
+	static TickType_t xMaximumPossibleSuppressedTicks = 0;
+
+	/* Set by the tick interrupt so vPortSuppressTicksAndSleep() can tell
+	whether it was the tick interrupt that ended a low power period. */
+	static volatile BaseType_t xTickInterruptOccurred = pdFALSE;
+
+#endif /* configUSE_TICKLESS_IDLE */
+
+#if( ( configGENERATE_RUN_TIME_STATS == 1 ) && defined( configRUN_TIME_TIMER_VECTOR ) )
+
+	/* The part of the run time counter above the 16 bits held in the timer.
+	Incremented by one timer period each time the timer overflows. */
+	static volatile configRUN_TIME_COUNTER_TYPE ulRunTimeCounterOverflows = 0;
+
+#endif
 /*-----------------------------------------------------------*/
 
 
@@ -166,17 +223,30 @@ void vPortEndScheduler( void )
 void vPortSetupTimerInterrupt( void )
 {
 	vApplicationSetupTimerInterrupt();
+
+	#if( configUSE_TICKLESS_IDLE == 1 )
+	{
+		/* In up mode the timer period is one more than the compare value. */
+		usTimerCountsForOneTick = ( uint16_t ) ( configTICK_TIMER_CCR0 + 1U );
+		xMaximumPossibleSuppressedTicks = ( TickType_t ) ( 0xffffU / usTimerCountsForOneTick );
+	}
+	#endif
 }
 /*-----------------------------------------------------------*/
 
-#if 0
-
-#pragma vector=configTICK_VECTOR
-interrupt void vTickISREntry( void )
+/* configTICK_VECTOR must be set in FreeRTOSConfig.h to the vector of the
+timer configured by vApplicationSetupTimerInterrupt(). */
+__attribute__((interrupt(configTICK_VECTOR)))
+void vTickISREntry( void )
 {
-extern void vPortTickISR( void );
-
 	__bic_SR_register_on_exit( SCG1 + SCG0 + OSCOFF + CPUOFF );
+
+	#if( configUSE_TICKLESS_IDLE == 1 )
+	{
+		xTickInterruptOccurred = pdTRUE;
+	}
+	#endif
+
 	#if configUSE_PREEMPTION == 1
 		extern void vPortPreemptiveTickISR( void );
 		vPortPreemptiveTickISR();
@@ -185,5 +255,155 @@ extern void vPortTickISR( void );
 		vPortCooperativeTickISR();
 	#endif
 }
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TICKLESS_IDLE == 1 )
+
+	void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+	{
+	uint16_t usCountNow;
+	TickType_t xModifiableIdleTime, xCompleteTickPeriods;
+
+		/* Make sure the compare value does not overflow the 16-bit timer. */
+		if( xExpectedIdleTime > xMaximumPossibleSuppressedTicks )
+		{
+			xExpectedIdleTime = xMaximumPossibleSuppressedTicks;
+		}
+
+		/* Stop the timer momentarily.  The ACLK is slow compared to the MCLK
+		so few, if any, timer counts are missed while the timer is stopped. */
+		portDISABLE_INTERRUPTS();
+		configTICK_TIMER_CTL &= ~MC_3;
+
+		/* If a context switch is pending or a task is waiting for the
+		scheduler to be unsuspended then abandon the low power entry.  Also
+		abandon it if the tick interrupt is already pending, as the counter has
+		then wrapped into the next tick period. */
+		if( ( eTaskConfirmSleepModeStatus() == eAbortSleep ) || ( ( configTICK_TIMER_CCTL0 & CCIFG ) != 0 ) )
+		{
+			/* Restart the timer from wherever it stopped. */
+			configTICK_TIMER_CTL |= MC_1;
+			portENABLE_INTERRUPTS();
+		}
+		else
+		{
+			/* The counter holds the time since the start of the current tick
+			period, so moving the compare value to the end of the
+			xExpectedIdleTime'th tick period generates the next interrupt at
+			exactly the time the tick interrupt would have executed had ticks
+			not been suppressed. */
+			configTICK_TIMER_CCR0 = ( uint16_t ) ( ( usTimerCountsForOneTick * ( uint16_t ) xExpectedIdleTime ) - 1U );
+			xTickInterruptOccurred = pdFALSE;
+			configTICK_TIMER_CTL |= MC_1;
+
+			/* Sleep until something happens.  configPRE_SLEEP_PROCESSING() can
+			set its parameter to 0 to indicate that its implementation contains
+			its own wait for interrupt or wait for event instruction, and so the
+			low power mode should not be entered again here. */
+			xModifiableIdleTime = xExpectedIdleTime;
+			configPRE_SLEEP_PROCESSING( xModifiableIdleTime );
+			if( xModifiableIdleTime > 0 )
+			{
+				/* LPM3 leaves the ACLK, and therefore the tick timer, running.
+				Interrupts are enabled as LPM3 is entered.  The tick interrupt,
+				and any application interrupt that is to end the low power
+				period, must clear the low power mode bits on exit. */
+				__bis_SR_register( LPM3_bits + GIE );
+				__no_operation();
+			}
+			configPOST_SLEEP_PROCESSING( xExpectedIdleTime );
+
+			/* Stop the timer again while the time spent in the low power mode
+			is calculated. */
+			portDISABLE_INTERRUPTS();
+			configTICK_TIMER_CTL &= ~MC_3;
+			usCountNow = configTICK_TIMER_R;
+
+			if( ( xTickInterruptOccurred != pdFALSE ) || ( ( configTICK_TIMER_CCTL0 & CCIFG ) != 0 ) )
+			{
+				/* The counter reached the extended compare value so the tick
+				interrupt has either already executed or will execute as soon as
+				interrupts are re-enabled.  Either way it accounts for the final
+				tick period itself, and the counter has wrapped to the time since
+				that tick. */
+				xCompleteTickPeriods = xExpectedIdleTime - ( TickType_t ) 1;
+			}
+			else
+			{
+				/* Something other than the tick interrupt ended the low power
+				period.  The counter has not wrapped, so still holds the time
+				since the start of the tick period in which sleep was entered. */
+				xCompleteTickPeriods = ( TickType_t ) ( usCountNow / usTimerCountsForOneTick );
+			}
+
+			/* Restart the timer part way through the current tick period, and
+			restore the compare value to generate a single tick period. */
+			configTICK_TIMER_R = usCountNow % usTimerCountsForOneTick;
+			configTICK_TIMER_CCR0 = usTimerCountsForOneTick - 1U;
+			configTICK_TIMER_CTL |= MC_1;
+
+			vTaskStepTick( xCompleteTickPeriods );
+			portENABLE_INTERRUPTS();
+		}
+	}
+
+#endif /* configUSE_TICKLESS_IDLE */
+/*-----------------------------------------------------------*/
+
+#if( ( configGENERATE_RUN_TIME_STATS == 1 ) && defined( configRUN_TIME_TIMER_VECTOR ) )
+
+	void vPortConfigureRunTimeCounter( void )
+	{
+		/* Stop and clear the timer, then start it in continuous mode with the
+		overflow interrupt enabled. */
+		configRUN_TIME_TIMER_CTL = 0;
+		configRUN_TIME_TIMER_CTL |= TACLR;
+		ulRunTimeCounterOverflows = 0;
+		configRUN_TIME_TIMER_CTL = configRUN_TIME_TIMER_CLOCK | MC__CONTINUOUS | TAIE;
+	}
+	/*-----------------------------------------------------------*/
+
+	configRUN_TIME_COUNTER_TYPE xPortGetRunTimeCounterValue( void )
+	{
+	configRUN_TIME_COUNTER_TYPE ulOverflows;
+	uint16_t usCount;
+	__istate_t xInterruptState;
+
+		/* This is called from vTaskSwitchContext(), which can execute inside
+		an interrupt, so the interrupt state is saved and restored rather than
+		using a critical section.  SR is read directly as the in430.h
+		__get_interrupt_state() used with clang casts its asm output operand,
+		which clang warns about. */
+		__asm__ __volatile__ ( "mov.w SR, %0" : "=r" ( xInterruptState ) );
+		portDISABLE_INTERRUPTS();
+		{
+			usCount = configRUN_TIME_TIMER_R;
+			ulOverflows = ulRunTimeCounterOverflows;
+
+			/* If the timer overflowed after interrupts were disabled then the
+			overflow has not been counted yet, and the count read above might
+			be from before or after the overflow.  Read the count again, which
+			is now known to be from after the overflow, and count the overflow
+			here instead. */
+			if( ( configRUN_TIME_TIMER_CTL & TAIFG ) != 0 )
+			{
+				usCount = configRUN_TIME_TIMER_R;
+				ulOverflows += portRUN_TIME_TIMER_PERIOD;
+			}
+		}
+		__set_interrupt_state( xInterruptState );
+
+		return ulOverflows + ( configRUN_TIME_COUNTER_TYPE ) usCount;
+	}
+	/*-----------------------------------------------------------*/
+
+	__attribute__((interrupt(configRUN_TIME_TIMER_VECTOR)))
+	void vPortRunTimeCounterOverflowISR( void )
+	{
+		configRUN_TIME_TIMER_CTL &= ~TAIFG;
+		ulRunTimeCounterOverflows += portRUN_TIME_TIMER_PERIOD;
+		__bic_SR_register_on_exit( SCG1 + SCG0 + OSCOFF + CPUOFF );
+	}
+
+#endif /* ( configGENERATE_RUN_TIME_STATS == 1 ) && defined( configRUN_TIME_TIMER_VECTOR ) */
 
-#endif	
@@ -125,6 +125,10 @@ extern void vPortYield( void );
 #define portSTACK_GROWTH			( -1 )
 #define portTICK_PERIOD_MS			( ( TickType_t ) 1000 / configTICK_RATE_HZ )
 #define portNOP()					__no_operation()
+
+/* The MSP430X has a single core and does not reorder memory accesses, so only
+the compiler needs to be prevented from reordering accesses. */
+#define portMEMORY_BARRIER()		__asm volatile( "" ::: "memory" )
 /*-----------------------------------------------------------*/
 
 /* Task function macros as described on the FreeRTOS.org WEB site. */
@@ -136,6 +140,22 @@ extern void vTaskSwitchContext( void );
 
 void vApplicationSetupTimerInterrupt( void );
 
+/* Tickless idle/low power functionality. */
+#ifndef portSUPPRESS_TICKS_AND_SLEEP
+	extern void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
+	#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime ) vPortSuppressTicksAndSleep( xExpectedIdleTime )
+#endif
+
+/* Run time stats.  If configRUN_TIME_TIMER_VECTOR is defined in
+FreeRTOSConfig.h then the port provides the run time counter by extending a
+16-bit Timer_A or Timer_B with a count of its overflows. */
+#if( ( configGENERATE_RUN_TIME_STATS == 1 ) && defined( configRUN_TIME_TIMER_VECTOR ) )
+	extern void vPortConfigureRunTimeCounter( void );
+	extern configRUN_TIME_COUNTER_TYPE xPortGetRunTimeCounterValue( void );
+	#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() vPortConfigureRunTimeCounter()
+	#define portGET_RUN_TIME_COUNTER_VALUE() xPortGetRunTimeCounterValue()
+#endif
+
 /* sizeof( int ) != sizeof( long ) so a full printf() library is required if
 run time stats information is to be displayed. */
 #define portLU_PRINTF_SPECIFIER_REQUIRED
@@ -0,0 +1,515 @@
+/*
+ * FreeRTOS Kernel V10.1.1
+ * Copyright (C) 2018 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the Posix port.
+ *
+ * Each task is executed by its own pthread.  Only the thread of the task
+ * referenced by pxCurrentTCB is allowed to execute, all the other task threads
+ * are parked on an event that is private to the thread.  A context switch
+ * signals the event of the thread being switched in, then parks the thread
+ * being switched out.
+ *
+ * The tick interrupt is simulated by SIGALRM, generated by an interval timer.
+ * Disabling interrupts blocks SIGALRM in the calling thread.  Task threads are
+ * created with all signals blocked, and the only thread that ever has SIGALRM
+ * unblocked is the thread of the running task when it is outside of a critical
+ * section - so the tick handler always executes in the context of the running
+ * task, exactly as a tick interrupt would on real hardware.
+ *----------------------------------------------------------*/
+
+/* Standard includes. */
+#include <pthread.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/time.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define portNO_CRITICAL_NESTING		( ( UBaseType_t ) 0 )
+
+/* The signal used to simulate the tick interrupt. */
+#define portTICK_SIGNAL				SIGALRM
+
+/* Task code executes on a stack allocated by the host when the task's thread
+is created, rather than on the stack allocated by the kernel, so the stack size
+passed to xTaskCreate() only needs to be large enough to hold a ThreadState_t
+structure.  This is the size of the host stack given to each task thread. */
+#ifndef configPOSIX_THREAD_STACK_SIZE
+	#define configPOSIX_THREAD_STACK_SIZE	( 256U * 1024U )
+#endif
+
+/*-----------------------------------------------------------*/
+
+/* A latching event on which a thread can block until it is signalled. */
+typedef struct xTHREAD_EVENT
+{
+	pthread_mutex_t xMutex;
+	pthread_cond_t xCondition;
+	BaseType_t xSignalled;
+} ThreadEvent_t;
+
+/* The state of the thread that executes a task.  The structure is placed at the
+top of the task's kernel allocated stack, from where it can be located from the
+task's handle as the first member of the TCB points to it. */
+typedef struct xTHREAD_STATE
+{
+	pthread_t xThread;						/*< The host thread that executes the task. */
+	TaskFunction_t pxCode;					/*< The task's entry point. */
+	void *pvParameters;						/*< The parameter passed into the task's entry point. */
+	volatile BaseType_t xDying;				/*< Set to pdTRUE when the task has been deleted so the thread exits rather than parks. */
+	ThreadEvent_t xResumeEvent;				/*< Signalled when the task is switched in. */
+} ThreadState_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Latching event primitives used to park and resume task threads.
+ */
+static void prvEventInit( ThreadEvent_t *pxEvent );
+static void prvEventDelete( ThreadEvent_t *pxEvent );
+static void prvEventWait( ThreadEvent_t *pxEvent );
+static void prvEventSignal( ThreadEvent_t *pxEvent );
+
+/*
+ * The entry point of every task thread.  The thread parks until the task is
+ * switched in for the first time, then calls the task's entry point.
+ */
+static void *prvThreadEntry( void *pvParameters );
+
+/*
+ * Resume the thread of the task being switched in, then park the thread of the
+ * task being switched out (or let it exit if the task has been deleted).
+ */
+static void prvSwitchThread( ThreadState_t *pxThreadToResume, ThreadState_t *pxThreadToSuspend );
+
+/*
+ * Park the calling thread until its task is next switched in.
+ */
+static void prvSuspendSelf( ThreadState_t *pxThread );
+
+/*
+ * Obtain the thread state of a task from its handle (TCB).
+ */
+static ThreadState_t *prvGetThreadFromTask( void *pvTask );
+
+/*
+ * The simulated tick interrupt.
+ */
+static void prvTickSignalHandler( int iSignal );
+
+/*
+ * Install the tick signal handler and start the interval timer that generates
+ * the simulated tick interrupt.
+ */
+static void prvSetupTimerInterrupt( void );
+
+/*
+ * Used to catch tasks that attempt to return from their implementing function.
+ */
+static void prvTaskExitError( void );
+
+/*-----------------------------------------------------------*/
+
+/* We require the address of the pxCurrentTCB variable, but don't want to know
+any details of its type. */
+typedef void TCB_t;
+extern volatile TCB_t * volatile pxCurrentTCB;
+
+/* The critical nesting count of the running task.  Each task's count is held
+on the stack of its thread while the task is not running. */
+static volatile UBaseType_t uxCriticalNesting = portNO_CRITICAL_NESTING;
+
+/* Set while the tick handler is calling into the kernel, so a yield requested
+from an interrupt safe API function can be deferred until the handler exits. */
+static volatile BaseType_t xInsideInterrupt = pdFALSE;
+static volatile BaseType_t xYieldPendingFromISR = pdFALSE;
+
+/* The main() thread parks on this event once the scheduler has started, and is
+resumed by vPortEndScheduler(). */
+static ThreadEvent_t xSchedulerEndEvent;
+
+/*-----------------------------------------------------------*/
+
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
+{
+ThreadState_t *pxThread;
+pthread_attr_t xThreadAttributes;
+sigset_t xAllSignals, xSavedSignals;
+int iReturned;
+
+	/* Place the thread state at the top of the stack.  The returned top of
+	stack points to the thread state, which is the only item placed on the
+	stack, and is never moved as the context of the task is held by its thread
+	rather than on its stack. */
+	pxThread = ( ThreadState_t * ) ( pxTopOfStack + 1 ) - 1;
+	pxTopOfStack = ( StackType_t * ) pxThread;
+
+	pxThread->pxCode = pxCode;
+	pxThread->pvParameters = pvParameters;
+	pxThread->xDying = pdFALSE;
+	prvEventInit( &( pxThread->xResumeEvent ) );
+
+	pthread_attr_init( &xThreadAttributes );
+	pthread_attr_setstacksize( &xThreadAttributes, configPOSIX_THREAD_STACK_SIZE );
+
+	/* A thread inherits the signal mask of its creator, so create the thread
+	with all signals blocked.  The thread only unblocks the simulated interrupts
+	once its task is running. */
+	sigfillset( &xAllSignals );
+	pthread_sigmask( SIG_SETMASK, &xAllSignals, &xSavedSignals );
+	iReturned = pthread_create( &( pxThread->xThread ), &xThreadAttributes, prvThreadEntry, pxThread );
+	pthread_sigmask( SIG_SETMASK, &xSavedSignals, NULL );
+
+	pthread_attr_destroy( &xThreadAttributes );
+	configASSERT( iReturned == 0 );
+	( void ) iReturned;
+
+	return pxTopOfStack;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortStartScheduler( void )
+{
+ThreadState_t *pxFirstThread;
+
+	/* The main() thread never executes task code, so must never take a
+	simulated interrupt. */
+	vPortDisableInterrupts();
+
+	prvEventInit( &xSchedulerEndEvent );
+	prvSetupTimerInterrupt();
+
+	/* Start the first task. */
+	pxFirstThread = prvGetThreadFromTask( ( void * ) pxCurrentTCB );
+	prvEventSignal( &( pxFirstThread->xResumeEvent ) );
+
+	/* Park until vPortEndScheduler() is called. */
+	prvEventWait( &xSchedulerEndEvent );
+	prvEventDelete( &xSchedulerEndEvent );
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+struct itimerval xTimer;
+struct sigaction xTickAction;
+
+	/* Stop the tick, and discard any tick that is already pending. */
+	memset( &xTimer, 0x00, sizeof( xTimer ) );
+	setitimer( ITIMER_REAL, &xTimer, NULL );
+
+	memset( &xTickAction, 0x00, sizeof( xTickAction ) );
+	xTickAction.sa_handler = SIG_IGN;
+	sigaction( portTICK_SIGNAL, &xTickAction, NULL );
+
+	/* Return control to the main() thread, from where vTaskStartScheduler()
+	was called.  The calling task never runs again. */
+	prvEventSignal( &xSchedulerEndEvent );
+	prvSuspendSelf( prvGetThreadFromTask( ( void * ) pxCurrentTCB ) );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+ThreadState_t *pxThreadToSuspend, *pxThreadToResume;
+
+	vPortEnterCritical();
+	{
+		pxThreadToSuspend = prvGetThreadFromTask( ( void * ) pxCurrentTCB );
+		vTaskSwitchContext();
+		pxThreadToResume = prvGetThreadFromTask( ( void * ) pxCurrentTCB );
+
+		prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+	}
+	vPortExitCritical();
+}
+/*-----------------------------------------------------------*/
+
+void vPortYieldFromISR( BaseType_t xSwitchRequired )
+{
+	if( xSwitchRequired != pdFALSE )
+	{
+		if( xInsideInterrupt != pdFALSE )
+		{
+			/* Called from the tick hook.  The switch is performed when the tick
+			handler has finished calling into the kernel. */
+			xYieldPendingFromISR = pdTRUE;
+		}
+		else
+		{
+			vPortYield();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortDisableInterrupts( void )
+{
+sigset_t xSignals;
+
+	sigemptyset( &xSignals );
+	sigaddset( &xSignals, portTICK_SIGNAL );
+	pthread_sigmask( SIG_BLOCK, &xSignals, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnableInterrupts( void )
+{
+sigset_t xSignals;
+
+	sigemptyset( &xSignals );
+	sigaddset( &xSignals, portTICK_SIGNAL );
+	pthread_sigmask( SIG_UNBLOCK, &xSignals, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+	vPortDisableInterrupts();
+	uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+	if( uxCriticalNesting > portNO_CRITICAL_NESTING )
+	{
+		uxCriticalNesting--;
+
+		/* Interrupts are only re-enabled when the nesting count reaches zero,
+		and never from within the simulated interrupt itself. */
+		if( ( uxCriticalNesting == portNO_CRITICAL_NESTING ) && ( xInsideInterrupt == pdFALSE ) )
+		{
+			vPortEnableInterrupts();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortThreadDying( void *pvTaskToDelete, volatile BaseType_t *pxPendYield )
+{
+ThreadState_t *pxThread = prvGetThreadFromTask( pvTaskToDelete );
+
+	( void ) pxPendYield;
+
+	/* The task is deleting itself.  Its thread exits, rather than parks, when
+	the task yields and the next task is switched in. */
+	pxThread->xDying = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortCancelThread( void *pvTaskToDelete )
+{
+ThreadState_t *pxThread = prvGetThreadFromTask( pvTaskToDelete );
+
+	/* The thread is either parked, or has already exited because the task
+	deleted itself.  Wake it so it exits, then wait for it to do so before the
+	stack holding its thread state is freed. */
+	pxThread->xDying = pdTRUE;
+	prvEventSignal( &( pxThread->xResumeEvent ) );
+	pthread_join( pxThread->xThread, NULL );
+	prvEventDelete( &( pxThread->xResumeEvent ) );
+}
+/*-----------------------------------------------------------*/
+
+static void *prvThreadEntry( void *pvParameters )
+{
+ThreadState_t *pxThread = ( ThreadState_t * ) pvParameters;
+
+	prvSuspendSelf( pxThread );
+
+	/* The task is running for the first time.  Tasks start outside of any
+	critical section, with interrupts enabled. */
+	uxCriticalNesting = portNO_CRITICAL_NESTING;
+	vPortEnableInterrupts();
+
+	pxThread->pxCode( pxThread->pvParameters );
+
+	/* Tasks must not return from their implementing function. */
+	prvTaskExitError();
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchThread( ThreadState_t *pxThreadToResume, ThreadState_t *pxThreadToSuspend )
+{
+UBaseType_t uxSavedCriticalNesting;
+
+	if( pxThreadToResume != pxThreadToSuspend )
+	{
+		/* The critical nesting count is per task, so hold it on the stack of
+		the thread being switched out until the thread runs again. */
+		uxSavedCriticalNesting = uxCriticalNesting;
+
+		prvEventSignal( &( pxThreadToResume->xResumeEvent ) );
+
+		if( pxThreadToSuspend->xDying != pdFALSE )
+		{
+			/* The task deleted itself, so its thread is no longer needed.  It
+			is joined by vPortCancelThread() when the idle task frees the TCB. */
+			pthread_exit( NULL );
+		}
+
+		prvSuspendSelf( pxThreadToSuspend );
+
+		uxCriticalNesting = uxSavedCriticalNesting;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSuspendSelf( ThreadState_t *pxThread )
+{
+	prvEventWait( &( pxThread->xResumeEvent ) );
+
+	if( pxThread->xDying != pdFALSE )
+	{
+		/* The task was deleted while its thread was parked. */
+		pthread_exit( NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static ThreadState_t *prvGetThreadFromTask( void *pvTask )
+{
+StackType_t *pxTopOfStack = *( StackType_t ** ) pvTask;
+
+	return ( ThreadState_t * ) pxTopOfStack;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTickSignalHandler( int iSignal )
+{
+ThreadState_t *pxThreadToSuspend, *pxThreadToResume;
+BaseType_t xSwitchRequired;
+
+	( void ) iSignal;
+
+	/* All signals are blocked while the handler executes, so the handler is
+	itself a critical section. */
+	xInsideInterrupt = pdTRUE;
+	{
+		xSwitchRequired = xTaskIncrementTick();
+
+		if( xYieldPendingFromISR != pdFALSE )
+		{
+			xYieldPendingFromISR = pdFALSE;
+			xSwitchRequired = pdTRUE;
+		}
+	}
+	xInsideInterrupt = pdFALSE;
+
+	if( xSwitchRequired != pdFALSE )
+	{
+		pxThreadToSuspend = prvGetThreadFromTask( ( void * ) pxCurrentTCB );
+		vTaskSwitchContext();
+		pxThreadToResume = prvGetThreadFromTask( ( void * ) pxCurrentTCB );
+
+		/* If a different task was selected then the thread that was
+		interrupted parks here, within the handler, and returns from the
+		handler when its task is next switched in. */
+		prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetupTimerInterrupt( void )
+{
+struct sigaction xTickAction;
+struct itimerval xTimer;
+
+	memset( &xTickAction, 0x00, sizeof( xTickAction ) );
+	xTickAction.sa_handler = prvTickSignalHandler;
+	xTickAction.sa_flags = SA_RESTART;
+
+	/* Interrupts do not nest. */
+	sigfillset( &xTickAction.sa_mask );
+	sigaction( portTICK_SIGNAL, &xTickAction, NULL );
+
+	xTimer.it_interval.tv_sec = portTICK_PERIOD_US / 1000000UL;
+	xTimer.it_interval.tv_usec = portTICK_PERIOD_US % 1000000UL;
+	xTimer.it_value = xTimer.it_interval;
+	setitimer( ITIMER_REAL, &xTimer, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTaskExitError( void )
+{
+	/* A function that implements a task must not exit or attempt to return to
+	its caller as there is nothing to return to.  If a task wants to exit it
+	should instead call vTaskDelete( NULL ). */
+	configASSERT( uxCriticalNesting == ~0UL );
+	portDISABLE_INTERRUPTS();
+	for( ;; );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventInit( ThreadEvent_t *pxEvent )
+{
+	pthread_mutex_init( &( pxEvent->xMutex ), NULL );
+	pthread_cond_init( &( pxEvent->xCondition ), NULL );
+	pxEvent->xSignalled = pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventDelete( ThreadEvent_t *pxEvent )
+{
+	pthread_cond_destroy( &( pxEvent->xCondition ) );
+	pthread_mutex_destroy( &( pxEvent->xMutex ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventWait( ThreadEvent_t *pxEvent )
+{
+	pthread_mutex_lock( &( pxEvent->xMutex ) );
+	{
+		while( pxEvent->xSignalled == pdFALSE )
+		{
+			pthread_cond_wait( &( pxEvent->xCondition ), &( pxEvent->xMutex ) );
+		}
+
+		pxEvent->xSignalled = pdFALSE;
+	}
+	pthread_mutex_unlock( &( pxEvent->xMutex ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventSignal( ThreadEvent_t *pxEvent )
+{
+	pthread_mutex_lock( &( pxEvent->xMutex ) );
+	{
+		pxEvent->xSignalled = pdTRUE;
+		pthread_cond_signal( &( pxEvent->xCondition ) );
+	}
+	pthread_mutex_unlock( &( pxEvent->xMutex ) );
+}
+/*-----------------------------------------------------------*/
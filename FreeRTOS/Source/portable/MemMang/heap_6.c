@@ -0,0 +1,742 @@
+/*
+ * FreeRTOS Kernel V10.1.1
+ * Copyright (C) 2018 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * A sample implementation of pvPortMalloc() and vPortFree() that uses a two
+ * level segregated fit (TLSF) scheme, so the time taken to allocate and free a
+ * block is bounded and does not depend on how many blocks are free or on how
+ * fragmented the heap has become.  Like heap_5.c, the heap can be defined
+ * across multiple non-contiguous blocks of memory, and adjacent blocks are
+ * combined (coalesced) as they are freed.
+ *
+ * Free blocks are held in an array of lists.  The first level index selects a
+ * power of two size range, and the second level index divides that range into
+ * ( 1 << heapSL_INDEX_COUNT_LOG2 ) equal sized lists.  A bitmap records which
+ * lists are not empty, so the list to take a block from is found with a couple
+ * of find-first-set operations rather than by walking the free blocks.  A
+ * request is rounded up to the start of the next list so any block in that list
+ * is large enough, meaning no more than one block is ever inspected.  The cost
+ * of that rounding is that a request can fail when a block that is just large
+ * enough exists but is held in the same list as blocks that are too small.
+ *
+ * Each block records the address of the block immediately before it in memory,
+ * so a block being freed can be combined with both of its neighbours without
+ * searching for them.
+ *
+ * See heap_1.c, heap_2.c, heap_3.c, heap_4.c and heap_5.c for alternative
+ * implementations, and the memory management pages of http://www.FreeRTOS.org
+ * for more information.
+ *
+ * Usage notes:
+ *
+ * vPortDefineHeapRegions() ***must*** be called before pvPortMalloc(), exactly
+ * as when heap_5.c is used - see the comments at the top of heap_5.c.  Unlike
+ * heap_5.c the regions do not need to appear in address order.  A region that
+ * is larger than the largest block that can be represented (see
+ * heapFL_INDEX_MAX below) is truncated.
+ *
+ * vPortGetHeapStats() can be used to obtain information on the state of the
+ * heap.  Unlike pvPortMalloc() and vPortFree() its execution time grows with
+ * the number of free blocks, so it is intended for diagnostics.
+ */
+#include <stdlib.h>
+#include <stddef.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+	#error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+/* Assumes 8bit bytes! */
+#define heapBITS_PER_BYTE			( ( size_t ) 8 )
+
+/* The top bit of a size_t.  When this bit is set in the xBlockSize member of a
+BlockLink_t structure the block belongs to the application, when it is clear
+the block is free. */
+#define heapBLOCK_ALLOCATED_BIT		( ( size_t ) 1 << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 ) )
+
+/* Each first level size range is divided into this many second level lists.
+More lists means less memory is lost to rounding requests up, at the cost of
+more RAM being used by the list heads. */
+#define heapSL_INDEX_COUNT_LOG2		( 3U )
+#define heapSL_INDEX_COUNT			( 1U << heapSL_INDEX_COUNT_LOG2 )
+
+#if portBYTE_ALIGNMENT == 32
+	#define heapALIGNMENT_LOG2		( 5U )
+#elif portBYTE_ALIGNMENT == 16
+	#define heapALIGNMENT_LOG2		( 4U )
+#elif portBYTE_ALIGNMENT == 8
+	#define heapALIGNMENT_LOG2		( 3U )
+#elif portBYTE_ALIGNMENT == 4
+	#define heapALIGNMENT_LOG2		( 2U )
+#elif portBYTE_ALIGNMENT == 2
+	#define heapALIGNMENT_LOG2		( 1U )
+#elif portBYTE_ALIGNMENT == 1
+	#define heapALIGNMENT_LOG2		( 0U )
+#else
+	#error "Invalid portBYTE_ALIGNMENT definition"
+#endif
+
+/* Blocks smaller than heapSMALL_BLOCK_SIZE all map to first level list 0,
+which is divided linearly into lists that each hold blocks of one size.  Larger
+blocks map to the first level list given by the position of their most
+significant set bit. */
+#define heapFL_INDEX_SHIFT			( heapSL_INDEX_COUNT_LOG2 + heapALIGNMENT_LOG2 )
+#define heapSMALL_BLOCK_SIZE		( ( size_t ) 1 << heapFL_INDEX_SHIFT )
+
+/* Blocks must be smaller than ( 1 << heapFL_INDEX_MAX ) bytes.  This limits the
+number of first level lists so the first level bitmap fits in 32 bits. */
+#define heapFL_INDEX_MAX			( ( sizeof( size_t ) >= 4U ) ? 30U : 15U )
+#define heapFL_INDEX_COUNT			( heapFL_INDEX_MAX - heapFL_INDEX_SHIFT + 1U )
+#define heapMAXIMUM_BLOCK_SIZE		( ( size_t ) 1 << heapFL_INDEX_MAX )
+
+/* Define the block header.  The first two members are present in every block.
+The free list links are only used while the block is free, so overlap the
+memory returned to the application while the block is allocated. */
+typedef struct A_BLOCK_LINK
+{
+	struct A_BLOCK_LINK *pxPreviousPhysicalBlock;	/*<< The block immediately before this one in memory, or NULL if this is the first block in its region. */
+	size_t xBlockSize;								/*<< The size of the block, including this header. */
+	struct A_BLOCK_LINK *pxNextFreeBlock;			/*<< The next block in the same free list. */
+	struct A_BLOCK_LINK *pxPreviousFreeBlock;		/*<< The previous block in the same free list. */
+} BlockLink_t;
+
+/* The block that follows pxBlock in memory.  Every region ends with a zero
+sized allocated block so this is never used to step outside of a region. */
+#define heapNEXT_PHYSICAL_BLOCK( pxBlock ) ( ( BlockLink_t * ) ( ( ( uint8_t * ) ( pxBlock ) ) + ( ( pxBlock )->xBlockSize & ~heapBLOCK_ALLOCATED_BIT ) ) )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Return the bit position of the most significant set bit in xValue, which
+ * must not be zero.
+ */
+static UBaseType_t prvFindLastSet( size_t xValue );
+
+/*
+ * Return the bit position of the least significant set bit in ulBitmap, which
+ * must not be zero.
+ */
+static UBaseType_t prvFindFirstSet( uint32_t ulBitmap );
+
+/*
+ * Calculate the first and second level indexes of the free list that holds
+ * blocks of xBlockSize bytes.
+ */
+static void prvMapBlockSize( size_t xBlockSize, UBaseType_t *puxFirstLevel, UBaseType_t *puxSecondLevel );
+
+/*
+ * Return a free block of at least xWantedSize bytes, or NULL if there is no
+ * such block.  The block is not removed from its free list.
+ */
+static BlockLink_t *prvFindSuitableBlock( size_t xWantedSize );
+
+/*
+ * Add a block to, and remove a block from, the free list that corresponds to
+ * its size.
+ */
+static void prvInsertFreeBlock( BlockLink_t *pxBlock );
+static void prvRemoveFreeBlock( BlockLink_t *pxBlock );
+
+/*-----------------------------------------------------------*/
+
+/* The size of the part of the structure placed at the beginning of each
+allocated memory block, rounded up so the memory returned to the application is
+correctly byte aligned. */
+static const size_t xHeapStructSize	= ( offsetof( BlockLink_t, pxNextFreeBlock ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* Block sizes must not get too small - a free block has to be able to hold the
+whole structure. */
+static const size_t xMinimumBlockSize = ( sizeof( BlockLink_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* The free lists, and the bitmaps that record which of them are not empty.
+Bit n of ulFirstLevelBitmap is set when ulSecondLevelBitmaps[ n ] is not zero,
+and bit m of ulSecondLevelBitmaps[ n ] is set when pxFreeLists[ n ][ m ] is not
+empty. */
+static BlockLink_t *pxFreeLists[ heapFL_INDEX_COUNT ][ heapSL_INDEX_COUNT ];
+static uint32_t ulSecondLevelBitmaps[ heapFL_INDEX_COUNT ];
+static uint32_t ulFirstLevelBitmap = 0UL;
+
+/* Set to pdTRUE when vPortDefineHeapRegions() has been called. */
+static BaseType_t xHeapDefined = pdFALSE;
+
+/* Keeps track of the number of free bytes remaining, but says nothing about
+fragmentation. */
+static size_t xFreeBytesRemaining = 0U;
+static size_t xMinimumEverFreeBytesRemaining = 0U;
+
+/* Counts the calls to pvPortMalloc() and vPortFree() that succeeded. */
+static size_t xNumberOfSuccessfulAllocations = 0U;
+static size_t xNumberOfSuccessfulFrees = 0U;
+
+/*-----------------------------------------------------------*/
+
+void *pvPortMalloc( size_t xWantedSize )
+{
+BlockLink_t *pxBlock, *pxNewBlockLink;
+void *pvReturn = NULL;
+
+	/* The heap must be initialised before the first call to
+	prvPortMalloc(). */
+	configASSERT( xHeapDefined );
+
+	vTaskSuspendAll();
+	{
+		/* Check the requested block size is not zero, and not so large that
+		adding the structure and the alignment padding would make a block that
+		cannot be represented. */
+		if( ( xWantedSize > 0 ) && ( xWantedSize < ( heapMAXIMUM_BLOCK_SIZE - ( xHeapStructSize + portBYTE_ALIGNMENT ) ) ) )
+		{
+			/* The wanted size is increased so it can contain the start of a
+			BlockLink_t structure in addition to the requested amount of
+			bytes. */
+			xWantedSize += xHeapStructSize;
+
+			/* Ensure that blocks are always aligned to the required number of
+			bytes. */
+			if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+			{
+				/* Byte alignment required. */
+				xWantedSize += ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* The block must be able to hold the free list links once it is
+			freed again. */
+			if( xWantedSize < xMinimumBlockSize )
+			{
+				xWantedSize = xMinimumBlockSize;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxBlock = prvFindSuitableBlock( xWantedSize );
+
+			if( pxBlock != NULL )
+			{
+				/* This block is being returned for use so must be taken out of
+				the free lists. */
+				prvRemoveFreeBlock( pxBlock );
+
+				/* If the block is larger than required it can be split into
+				two. */
+				if( ( pxBlock->xBlockSize - xWantedSize ) >= xMinimumBlockSize )
+				{
+					/* This block is to be split into two.  Create a new block
+					following the number of bytes requested.  The void cast is
+					used to prevent byte alignment warnings from the compiler. */
+					pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+
+					/* Calculate the sizes of two blocks split from the single
+					block, and keep the physical links of the new block and the
+					block that follows it up to date. */
+					pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+					pxNewBlockLink->pxPreviousPhysicalBlock = pxBlock;
+					pxBlock->xBlockSize = xWantedSize;
+					heapNEXT_PHYSICAL_BLOCK( pxNewBlockLink )->pxPreviousPhysicalBlock = pxNewBlockLink;
+
+					/* The block that follows cannot be free, as free blocks
+					are always combined, so the new block can be added to the
+					free lists as it is. */
+					prvInsertFreeBlock( pxNewBlockLink );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+				if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+				{
+					xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* The block is being returned - it is allocated and owned by
+				the application. */
+				pxBlock->xBlockSize |= heapBLOCK_ALLOCATED_BIT;
+				xNumberOfSuccessfulAllocations++;
+
+				/* Return the memory space pointed to - jumping over the start
+				of the BlockLink_t structure. */
+				pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		traceMALLOC( pvReturn, xWantedSize );
+	}
+	( void ) xTaskResumeAll();
+
+	#if( configUSE_MALLOC_FAILED_HOOK == 1 )
+	{
+		if( pvReturn == NULL )
+		{
+			extern void vApplicationMallocFailedHook( void );
+			vApplicationMallocFailedHook();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void *pv )
+{
+uint8_t *puc = ( uint8_t * ) pv;
+BlockLink_t *pxLink, *pxNeighbour;
+
+	if( pv != NULL )
+	{
+		/* The memory being freed will have the start of a BlockLink_t
+		structure immediately before it. */
+		puc -= xHeapStructSize;
+
+		/* This casting is to keep the compiler from issuing warnings. */
+		pxLink = ( void * ) puc;
+
+		/* Check the block is actually allocated. */
+		configASSERT( ( pxLink->xBlockSize & heapBLOCK_ALLOCATED_BIT ) != 0 );
+
+		if( ( pxLink->xBlockSize & heapBLOCK_ALLOCATED_BIT ) != 0 )
+		{
+			vTaskSuspendAll();
+			{
+				/* The block is being returned to the heap - it is no longer
+				allocated. */
+				pxLink->xBlockSize &= ~heapBLOCK_ALLOCATED_BIT;
+				xFreeBytesRemaining += pxLink->xBlockSize;
+				xNumberOfSuccessfulFrees++;
+				traceFREE( pv, pxLink->xBlockSize );
+
+				/* If the block before this one in memory is free then form one
+				big block from the two blocks. */
+				pxNeighbour = pxLink->pxPreviousPhysicalBlock;
+				if( ( pxNeighbour != NULL ) && ( ( pxNeighbour->xBlockSize & heapBLOCK_ALLOCATED_BIT ) == 0 ) )
+				{
+					prvRemoveFreeBlock( pxNeighbour );
+					pxNeighbour->xBlockSize += pxLink->xBlockSize;
+					pxLink = pxNeighbour;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Likewise if the block after this one in memory is free.  The
+				marker at the end of each region is never free. */
+				pxNeighbour = heapNEXT_PHYSICAL_BLOCK( pxLink );
+				if( ( pxNeighbour->xBlockSize & heapBLOCK_ALLOCATED_BIT ) == 0 )
+				{
+					prvRemoveFreeBlock( pxNeighbour );
+					pxLink->xBlockSize += pxNeighbour->xBlockSize;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				heapNEXT_PHYSICAL_BLOCK( pxLink )->pxPreviousPhysicalBlock = pxLink;
+				prvInsertFreeBlock( pxLink );
+			}
+			( void ) xTaskResumeAll();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+	return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+	return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( HeapStats_t *pxHeapStats )
+{
+BlockLink_t *pxBlock;
+size_t xBlocks = 0, xMaxSize = 0, xMinSize = 0;
+UBaseType_t uxFirstLevel, uxSecondLevel;
+
+	vTaskSuspendAll();
+	{
+		for( uxFirstLevel = 0; uxFirstLevel < heapFL_INDEX_COUNT; uxFirstLevel++ )
+		{
+			for( uxSecondLevel = 0; uxSecondLevel < heapSL_INDEX_COUNT; uxSecondLevel++ )
+			{
+				for( pxBlock = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+				{
+					if( ( xBlocks == 0 ) || ( pxBlock->xBlockSize < xMinSize ) )
+					{
+						xMinSize = pxBlock->xBlockSize;
+					}
+
+					if( pxBlock->xBlockSize > xMaxSize )
+					{
+						xMaxSize = pxBlock->xBlockSize;
+					}
+
+					xBlocks++;
+				}
+			}
+		}
+
+		pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+		pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+		pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
+		pxHeapStats->xNumberOfFreeBlocks = xBlocks;
+		pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+		pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+		pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+	}
+	( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+#if defined( __GNUC__ )
+
+	static UBaseType_t prvFindLastSet( size_t xValue )
+	{
+		/* size_t is never wider than unsigned long on the targets GCC
+		supports. */
+		return ( UBaseType_t ) ( ( sizeof( unsigned long ) * heapBITS_PER_BYTE ) - 1U - ( size_t ) __builtin_clzl( ( unsigned long ) xValue ) );
+	}
+
+#else
+
+	static UBaseType_t prvFindLastSet( size_t xValue )
+	{
+	UBaseType_t uxBit = 0;
+	size_t xShift = ( sizeof( size_t ) * heapBITS_PER_BYTE ) >> 1;
+
+		/* A binary search, so the number of iterations depends only on the
+		width of size_t. */
+		while( xShift != 0 )
+		{
+			if( ( xValue >> xShift ) != 0 )
+			{
+				xValue >>= xShift;
+				uxBit += ( UBaseType_t ) xShift;
+			}
+
+			xShift >>= 1;
+		}
+
+		return uxBit;
+	}
+
+#endif /* __GNUC__ */
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvFindFirstSet( uint32_t ulBitmap )
+{
+	/* Isolate the least significant set bit.  The bitmaps never have more bits
+	than a size_t. */
+	return prvFindLastSet( ( size_t ) ( ulBitmap & ( ~ulBitmap + 1UL ) ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvMapBlockSize( size_t xBlockSize, UBaseType_t *puxFirstLevel, UBaseType_t *puxSecondLevel )
+{
+UBaseType_t uxLastSet;
+
+	if( xBlockSize < heapSMALL_BLOCK_SIZE )
+	{
+		/* Small blocks are held in lists of a single size. */
+		*puxFirstLevel = 0;
+		*puxSecondLevel = ( UBaseType_t ) ( xBlockSize >> heapALIGNMENT_LOG2 );
+	}
+	else
+	{
+		/* The most significant set bit selects the first level list, and the
+		heapSL_INDEX_COUNT_LOG2 bits below it select the second level list. */
+		uxLastSet = prvFindLastSet( xBlockSize );
+		*puxFirstLevel = uxLastSet - ( heapFL_INDEX_SHIFT - 1U );
+		*puxSecondLevel = ( UBaseType_t ) ( ( xBlockSize >> ( uxLastSet - heapSL_INDEX_COUNT_LOG2 ) ) ^ heapSL_INDEX_COUNT );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BlockLink_t *prvFindSuitableBlock( size_t xWantedSize )
+{
+UBaseType_t uxFirstLevel, uxSecondLevel;
+uint32_t ulBitmap;
+BlockLink_t *pxBlock = NULL;
+
+	/* Round the size up to the start of the next list so every block in the
+	list that is found is large enough.  xWantedSize is always well below
+	heapMAXIMUM_BLOCK_SIZE so this cannot overflow. */
+	if( xWantedSize >= heapSMALL_BLOCK_SIZE )
+	{
+		xWantedSize += ( ( size_t ) 1 << ( prvFindLastSet( xWantedSize ) - heapSL_INDEX_COUNT_LOG2 ) ) - 1U;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	prvMapBlockSize( xWantedSize, &uxFirstLevel, &uxSecondLevel );
+
+	if( uxFirstLevel < heapFL_INDEX_COUNT )
+	{
+		/* Look for a non-empty list in the same size range first, then for the
+		smallest larger size range that has any non-empty list. */
+		ulBitmap = ulSecondLevelBitmaps[ uxFirstLevel ] & ( ~( ( uint32_t ) 0 ) << uxSecondLevel );
+
+		if( ulBitmap == 0 )
+		{
+			ulBitmap = ulFirstLevelBitmap & ( ~( ( uint32_t ) 0 ) << ( uxFirstLevel + 1U ) );
+
+			if( ulBitmap != 0 )
+			{
+				uxFirstLevel = prvFindFirstSet( ulBitmap );
+				ulBitmap = ulSecondLevelBitmaps[ uxFirstLevel ];
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( ulBitmap != 0 )
+		{
+			uxSecondLevel = prvFindFirstSet( ulBitmap );
+			pxBlock = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ];
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pxBlock;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertFreeBlock( BlockLink_t *pxBlock )
+{
+UBaseType_t uxFirstLevel, uxSecondLevel;
+
+	prvMapBlockSize( pxBlock->xBlockSize, &uxFirstLevel, &uxSecondLevel );
+
+	/* Add the block to the front of its list. */
+	pxBlock->pxNextFreeBlock = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ];
+	pxBlock->pxPreviousFreeBlock = NULL;
+
+	if( pxBlock->pxNextFreeBlock != NULL )
+	{
+		pxBlock->pxNextFreeBlock->pxPreviousFreeBlock = pxBlock;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxFreeLists[ uxFirstLevel ][ uxSecondLevel ] = pxBlock;
+	ulFirstLevelBitmap |= ( uint32_t ) 1 << uxFirstLevel;
+	ulSecondLevelBitmaps[ uxFirstLevel ] |= ( uint32_t ) 1 << uxSecondLevel;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveFreeBlock( BlockLink_t *pxBlock )
+{
+UBaseType_t uxFirstLevel, uxSecondLevel;
+
+	prvMapBlockSize( pxBlock->xBlockSize, &uxFirstLevel, &uxSecondLevel );
+
+	if( pxBlock->pxNextFreeBlock != NULL )
+	{
+		pxBlock->pxNextFreeBlock->pxPreviousFreeBlock = pxBlock->pxPreviousFreeBlock;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( pxBlock->pxPreviousFreeBlock != NULL )
+	{
+		pxBlock->pxPreviousFreeBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+	}
+	else
+	{
+		/* The block was at the front of its list. */
+		pxFreeLists[ uxFirstLevel ][ uxSecondLevel ] = pxBlock->pxNextFreeBlock;
+
+		/* Clear the bitmap bits if the list is now empty. */
+		if( pxBlock->pxNextFreeBlock == NULL )
+		{
+			ulSecondLevelBitmaps[ uxFirstLevel ] &= ~( ( uint32_t ) 1 << uxSecondLevel );
+
+			if( ulSecondLevelBitmaps[ uxFirstLevel ] == 0 )
+			{
+				ulFirstLevelBitmap &= ~( ( uint32_t ) 1 << uxFirstLevel );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions )
+{
+BlockLink_t *pxFirstFreeBlockInRegion, *pxEnd;
+size_t xAlignedHeap;
+size_t xTotalRegionSize, xTotalHeapSize = 0;
+BaseType_t xDefinedRegions = 0;
+size_t xAddress;
+const HeapRegion_t *pxHeapRegion;
+
+	/* Can only call once! */
+	configASSERT( xHeapDefined == pdFALSE );
+
+	/* The first level bitmap must be able to represent every first level
+	list. */
+	configASSERT( heapFL_INDEX_COUNT <= 32U );
+
+	pxHeapRegion = &( pxHeapRegions[ xDefinedRegions ] );
+
+	while( pxHeapRegion->xSizeInBytes > 0 )
+	{
+		xTotalRegionSize = pxHeapRegion->xSizeInBytes;
+
+		/* Truncate regions that are too large to be held in a single
+		block. */
+		if( xTotalRegionSize >= heapMAXIMUM_BLOCK_SIZE )
+		{
+			xTotalRegionSize = heapMAXIMUM_BLOCK_SIZE - 1U;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Ensure the heap region starts on a correctly aligned boundary. */
+		xAddress = ( size_t ) pxHeapRegion->pucStartAddress;
+		if( ( xAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+		{
+			xAddress += ( portBYTE_ALIGNMENT - 1 );
+			xAddress &= ~portBYTE_ALIGNMENT_MASK;
+
+			/* Adjust the size for the bytes lost to alignment. */
+			xTotalRegionSize -= xAddress - ( size_t ) pxHeapRegion->pucStartAddress;
+		}
+
+		xAlignedHeap = xAddress;
+
+		/* The region must be large enough to hold at least one block in
+		addition to the end marker. */
+		configASSERT( xTotalRegionSize >= ( xMinimumBlockSize + ( 2U * xHeapStructSize ) ) );
+
+		/* pxEnd is a zero sized block that is always marked as allocated, so
+		free blocks are never combined with memory beyond the end of the
+		region.  It is placed at the end of the region space. */
+		xAddress = xAlignedHeap + xTotalRegionSize;
+		xAddress -= xHeapStructSize;
+		xAddress &= ~portBYTE_ALIGNMENT_MASK;
+		pxEnd = ( BlockLink_t * ) xAddress;
+
+		/* To start with there is a single free block in this region that is
+		sized to take up the entire heap region minus the space taken by the
+		end marker.  There is no block before it. */
+		pxFirstFreeBlockInRegion = ( BlockLink_t * ) xAlignedHeap;
+		pxFirstFreeBlockInRegion->xBlockSize = xAddress - xAlignedHeap;
+		pxFirstFreeBlockInRegion->pxPreviousPhysicalBlock = NULL;
+
+		pxEnd->xBlockSize = heapBLOCK_ALLOCATED_BIT;
+		pxEnd->pxPreviousPhysicalBlock = pxFirstFreeBlockInRegion;
+
+		prvInsertFreeBlock( pxFirstFreeBlockInRegion );
+		xTotalHeapSize += pxFirstFreeBlockInRegion->xBlockSize;
+
+		/* Move onto the next HeapRegion_t structure. */
+		xDefinedRegions++;
+		pxHeapRegion = &( pxHeapRegions[ xDefinedRegions ] );
+	}
+
+	xMinimumEverFreeBytesRemaining = xTotalHeapSize;
+	xFreeBytesRemaining = xTotalHeapSize;
+
+	/* Check something was actually defined before it is accessed. */
+	configASSERT( xTotalHeapSize );
+
+	xHeapDefined = pdTRUE;
+}
+
@@ -36,6 +36,7 @@ task.h is included from an application file. */
 #include "FreeRTOS.h"
 #include "task.h"
 #include "queue.h"
+#include "object_pool.h"
 
 #if ( configUSE_CO_ROUTINES == 1 )
 	#include "croutine.h"
@@ -51,6 +52,7 @@ correct privileged Vs unprivileged linkage and placement. */
 /* Constants used with the cRxLock and cTxLock structure members. */
 #define queueUNLOCKED					( ( int8_t ) -1 )
 #define queueLOCKED_UNMODIFIED			( ( int8_t ) 0 )
+#define queueMAX_LOCK_COUNT				( ( int8_t ) 127 )
 
 /* When the Queue_t structure is used to represent a base queue its pcHead and
 pcTail members are used as pointers into the queue storage area.  When the
@@ -72,7 +74,7 @@ typedef struct QueuePointers
 
 typedef struct SemaphoreData
 {
-	TaskHandle_t xMutexHolder;		 /*< The handle of the task that holds the mutex. */
+	MutexLink_t xMutexLink;			 /*< The handle of the task that holds the mutex, and, if configUSE_TRANSITIVE_PRIORITY_INHERITANCE is 1, the links used to pass inherited priorities along chains of mutexes. */
 	UBaseType_t uxRecursiveCallCount;/*< Maintains a count of the number of times a recursive mutex has been recursively 'taken' when the structure is used as a mutex. */
 } SemaphoreData_t;
 
@@ -105,8 +107,8 @@ typedef struct QueueDefinition 		/* The old naming convention is used to prevent
 		SemaphoreData_t xSemaphore; /*< Data required exclusively when this structure is used as a semaphore. */
 	} u;
 
-	List_t xTasksWaitingToSend;		/*< List of tasks that are blocked waiting to post onto this queue.  Stored in priority order. */
-	List_t xTasksWaitingToReceive;	/*< List of tasks that are blocked waiting to read from this queue.  Stored in priority order. */
+	EventList_t xTasksWaitingToSend;		/*< List of tasks that are blocked waiting to post onto this queue.  Stored in priority order. */
+	EventList_t xTasksWaitingToReceive;		/*< List of tasks that are blocked waiting to read from this queue.  Stored in priority order. */
 
 	volatile UBaseType_t uxMessagesWaiting;/*< The number of items currently in the queue. */
 	UBaseType_t uxLength;			/*< The length of the queue defined as the number of items it will hold, not the number of bytes. */
@@ -163,6 +165,25 @@ typedef xQUEUE Queue_t;
 
 #endif /* configQUEUE_REGISTRY_SIZE */
 
+/*
+ * Queues that are created dynamically are taken from a pool, rather than the
+ * heap, when configQUEUE_POOL_SIZE is not 0.  Each object in the pool holds a
+ * Queue_t structure and a storage area of configQUEUE_POOL_STORAGE_BYTES
+ * bytes.  Queues that need a larger storage area are taken from the heap.
+ */
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configQUEUE_POOL_SIZE > 0 ) )
+
+	objectpoolDEFINE_POOL( xQueuePool, ucQueuePoolStorage, sizeof( Queue_t ) + configQUEUE_POOL_STORAGE_BYTES, configQUEUE_POOL_SIZE );
+	#define queueMALLOC( xSize )	pvObjectPoolMalloc( &xQueuePool, ( xSize ) )
+	#define queueFREE( pv )			vObjectPoolFree( &xQueuePool, ( pv ) )
+
+#else
+
+	#define queueMALLOC( xSize )	pvPortMalloc( xSize )
+	#define queueFREE( pv )			vPortFree( pv )
+
+#endif /* configQUEUE_POOL_SIZE */
+
 /*
  * Unlocks a queue locked by a call to prvLockQueue.  Locking a queue does not
  * prevent an ISR from adding or removing items to the queue, but does prevent
@@ -198,6 +219,38 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue, const void *pvIte
  */
 static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+/*
+ * Copies uxItemCount items to the back of a queue using at most two calls to
+ * memcpy(), one up to the end of the queue storage area and, if the items
+ * wrap, one from the start of the storage area.  The caller must have already
+ * checked there is space for the items.
+ */
+static void prvCopyMultipleToQueue( Queue_t * const pxQueue, const int8_t *pcItems, const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copies uxItemCount items out of a queue using at most two calls to
+ * memcpy().  The caller must have already checked the queue contains at least
+ * uxItemCount items.
+ */
+static void prvCopyMultipleFromQueue( Queue_t * const pxQueue, int8_t *pcBuffer, const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblock up to one task that is waiting to receive from (or, if the queue is
+ * a member of a queue set, notify the queue set once) for each of the
+ * uxItemsAdded items that have just been added to the queue, so the result is
+ * the same as if the items had been sent one at a time.  Returns pdTRUE if any
+ * unblocked task has a priority above the running task.  Must be called with
+ * the queue unlocked.
+ */
+static BaseType_t prvUnblockTasksWaitingToReceive( Queue_t * const pxQueue, UBaseType_t uxItemsAdded ) PRIVILEGED_FUNCTION;
+
+/*
+ * As prvUnblockTasksWaitingToReceive(), but unblocks up to one task that is
+ * waiting to send to the queue for each of the uxItemsRemoved items that have
+ * just been removed from the queue.
+ */
+static BaseType_t prvUnblockTasksWaitingToSend( Queue_t * const pxQueue, UBaseType_t uxItemsRemoved ) PRIVILEGED_FUNCTION;
+
 #if ( configUSE_QUEUE_SETS == 1 )
 	/*
 	 * Checks to see if a queue is a member of a queue set, and if so, notifies
@@ -221,7 +274,7 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 	static void prvInitialiseMutex( Queue_t *pxNewQueue ) PRIVILEGED_FUNCTION;
 #endif
 
-#if( configUSE_MUTEXES == 1 )
+#if( ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 0 ) )
 	/*
 	 * If a task waiting for a mutex causes the mutex holder to inherit a
 	 * priority, but the waiting task times out, then the holder should
@@ -229,7 +282,7 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 	 * other tasks that are waiting for the same mutex.  This function returns
 	 * that priority.
 	 */
-	static UBaseType_t prvGetDisinheritPriorityAfterTimeout( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+	static UBaseType_t prvGetDisinheritPriorityAfterTimeout( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
 #endif
 /*-----------------------------------------------------------*/
 
@@ -274,7 +327,7 @@ Queue_t * const pxQueue = xQueue;
 			will still be empty.  If there are tasks blocked waiting to write to
 			the queue, then one should be unblocked as after this function exits
 			it will be possible to write to it. */
-			if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+			if( xTaskEventListIsEmpty( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
 			{
 				if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
 				{
@@ -293,8 +346,8 @@ Queue_t * const pxQueue = xQueue;
 		else
 		{
 			/* Ensure the event queues start in the correct state. */
-			vListInitialise( &( pxQueue->xTasksWaitingToSend ) );
-			vListInitialise( &( pxQueue->xTasksWaitingToReceive ) );
+			vTaskEventListInitialise( &( pxQueue->xTasksWaitingToSend ) );
+			vTaskEventListInitialise( &( pxQueue->xTasksWaitingToReceive ) );
 		}
 	}
 	taskEXIT_CRITICAL();
@@ -394,7 +447,7 @@ Queue_t * const pxQueue = xQueue;
 		are greater than or equal to the pointer to char requirements the cast
 		is safe.  In other cases alignment requirements are not strict (one or
 		two bytes). */
-		pxNewQueue = ( Queue_t * ) pvPortMalloc( sizeof( Queue_t ) + xQueueSizeInBytes ); /*lint !e9087 !e9079 see comment above. */
+		pxNewQueue = ( Queue_t * ) queueMALLOC( sizeof( Queue_t ) + xQueueSizeInBytes ); /*lint !e9087 !e9079 see comment above. */
 
 		if( pxNewQueue != NULL )
 		{
@@ -478,9 +531,16 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 			correctly for a generic queue, but this function is creating a
 			mutex.  Overwrite those members that need to be set differently -
 			in particular the information required for priority inheritance. */
-			pxNewQueue->u.xSemaphore.xMutexHolder = NULL;
+			pxNewQueue->u.xSemaphore.xMutexLink.xHolder = NULL;
 			pxNewQueue->uxQueueType = queueQUEUE_IS_MUTEX;
 
+			#if( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+			{
+				pxNewQueue->u.xSemaphore.xMutexLink.pxNextHeldMutex = NULL;
+				pxNewQueue->u.xSemaphore.xMutexLink.pxTasksWaiting = &( pxNewQueue->xTasksWaitingToReceive );
+			}
+			#endif
+
 			/* In case this is a recursive mutex. */
 			pxNewQueue->u.xSemaphore.uxRecursiveCallCount = 0;
 
@@ -550,7 +610,7 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 		{
 			if( pxSemaphore->uxQueueType == queueQUEUE_IS_MUTEX )
 			{
-				pxReturn = pxSemaphore->u.xSemaphore.xMutexHolder;
+				pxReturn = pxSemaphore->u.xSemaphore.xMutexLink.xHolder;
 			}
 			else
 			{
@@ -578,7 +638,7 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 		not required here. */
 		if( ( ( Queue_t * ) xSemaphore )->uxQueueType == queueQUEUE_IS_MUTEX )
 		{
-			pxReturn = ( ( Queue_t * ) xSemaphore )->u.xSemaphore.xMutexHolder;
+			pxReturn = ( ( Queue_t * ) xSemaphore )->u.xSemaphore.xMutexLink.xHolder;
 		}
 		else
 		{
@@ -600,17 +660,17 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 
 		configASSERT( pxMutex );
 
-		/* If this is the task that holds the mutex then xMutexHolder will not
+		/* If this is the task that holds the mutex then xHolder will not
 		change outside of this task.  If this task does not hold the mutex then
 		pxMutexHolder can never coincidentally equal the tasks handle, and as
 		this is the only condition we are interested in it does not matter if
 		pxMutexHolder is accessed simultaneously by another task.  Therefore no
 		mutual exclusion is required to test the pxMutexHolder variable. */
-		if( pxMutex->u.xSemaphore.xMutexHolder == xTaskGetCurrentTaskHandle() )
+		if( pxMutex->u.xSemaphore.xMutexLink.xHolder == xTaskGetCurrentTaskHandle() )
 		{
 			traceGIVE_MUTEX_RECURSIVE( pxMutex );
 
-			/* uxRecursiveCallCount cannot be zero if xMutexHolder is equal to
+			/* uxRecursiveCallCount cannot be zero if xHolder is equal to
 			the task handle, therefore no underflow check is required.  Also,
 			uxRecursiveCallCount is only modified by the mutex holder, and as
 			there can only be one, no mutual exclusion is required to modify the
@@ -660,7 +720,7 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 
 		traceTAKE_MUTEX_RECURSIVE( pxMutex );
 
-		if( pxMutex->u.xSemaphore.xMutexHolder == xTaskGetCurrentTaskHandle() )
+		if( pxMutex->u.xSemaphore.xMutexLink.xHolder == xTaskGetCurrentTaskHandle() )
 		{
 			( pxMutex->u.xSemaphore.uxRecursiveCallCount )++;
 			xReturn = pdPASS;
@@ -806,7 +866,7 @@ Queue_t * const pxQueue = xQueue;
 					{
 						/* If there was a task waiting for data to arrive on the
 						queue then unblock it now. */
-						if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+						if( xTaskEventListIsEmpty( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 						{
 							if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 							{
@@ -841,7 +901,7 @@ Queue_t * const pxQueue = xQueue;
 
 					/* If there was a task waiting for data to arrive on the
 					queue then unblock it now. */
-					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+					if( xTaskEventListIsEmpty( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 					{
 						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 						{
@@ -1029,7 +1089,7 @@ Queue_t * const pxQueue = xQueue;
 					}
 					else
 					{
-						if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+						if( xTaskEventListIsEmpty( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 						{
 							if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 							{
@@ -1057,7 +1117,7 @@ Queue_t * const pxQueue = xQueue;
 				}
 				#else /* configUSE_QUEUE_SETS */
 				{
-					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+					if( xTaskEventListIsEmpty( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 					{
 						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 						{
@@ -1126,7 +1186,7 @@ Queue_t * const pxQueue = xQueue;
 	/* Normally a mutex would not be given from an interrupt, especially if
 	there is a mutex holder, as priority inheritance makes no sense for an
 	interrupts, only tasks. */
-	configASSERT( !( ( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX ) && ( pxQueue->u.xSemaphore.xMutexHolder != NULL ) ) );
+	configASSERT( !( ( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX ) && ( pxQueue->u.xSemaphore.xMutexLink.xHolder != NULL ) ) );
 
 	/* RTOS ports that support interrupt nesting have the concept of a maximum
 	system call (or maximum API call) interrupt priority.  Interrupts that are
@@ -1194,7 +1254,7 @@ Queue_t * const pxQueue = xQueue;
 					}
 					else
 					{
-						if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+						if( xTaskEventListIsEmpty( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 						{
 							if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 							{
@@ -1222,7 +1282,7 @@ Queue_t * const pxQueue = xQueue;
 				}
 				#else /* configUSE_QUEUE_SETS */
 				{
-					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+					if( xTaskEventListIsEmpty( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 					{
 						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 						{
@@ -1312,7 +1372,7 @@ Queue_t * const pxQueue = xQueue;
 				/* There is now space in the queue, were any tasks waiting to
 				post to the queue?  If so, unblock the highest priority waiting
 				task. */
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+				if( xTaskEventListIsEmpty( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
 				{
 					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
 					{
@@ -1463,7 +1523,15 @@ Queue_t * const pxQueue = xQueue;
 					{
 						/* Record the information required to implement
 						priority inheritance should it become necessary. */
-						pxQueue->u.xSemaphore.xMutexHolder = pvTaskIncrementMutexHeldCount();
+						#if( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+						{
+							vTaskMutexTaken( &( pxQueue->u.xSemaphore.xMutexLink ) );
+						}
+						#else
+						{
+							pxQueue->u.xSemaphore.xMutexLink.xHolder = pvTaskIncrementMutexHeldCount();
+						}
+						#endif
 					}
 					else
 					{
@@ -1474,7 +1542,7 @@ Queue_t * const pxQueue = xQueue;
 
 				/* Check to see if other tasks are blocked waiting to give the
 				semaphore, and if so, unblock the highest priority such task. */
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+				if( xTaskEventListIsEmpty( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
 				{
 					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
 					{
@@ -1551,7 +1619,15 @@ Queue_t * const pxQueue = xQueue;
 					{
 						taskENTER_CRITICAL();
 						{
-							xInheritanceOccurred = xTaskPriorityInherit( pxQueue->u.xSemaphore.xMutexHolder );
+							#if( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+							{
+								xInheritanceOccurred = xTaskPriorityInheritThroughMutex( &( pxQueue->u.xSemaphore.xMutexLink ) );
+							}
+							#else
+							{
+								xInheritanceOccurred = xTaskPriorityInherit( pxQueue->u.xSemaphore.xMutexLink.xHolder );
+							}
+							#endif
 						}
 						taskEXIT_CRITICAL();
 					}
@@ -1593,7 +1669,28 @@ Queue_t * const pxQueue = xQueue;
 			queue being empty is equivalent to the semaphore count being 0. */
 			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
 			{
-				#if ( configUSE_MUTEXES == 1 )
+				#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+				{
+					/* The priority of the holder, and of the tasks along the
+					chain of mutexes from it, is recalculated even if this task
+					did not cause the holder to inherit a priority, as this task
+					might have been passed a priority along the chain since. */
+					if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+					{
+						taskENTER_CRITICAL();
+						{
+							vTaskPriorityDisinheritMutexAfterTimeout( &( pxQueue->u.xSemaphore.xMutexLink ) );
+						}
+						taskEXIT_CRITICAL();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					( void ) xInheritanceOccurred;
+				}
+				#elif ( configUSE_MUTEXES == 1 )
 				{
 					/* xInheritanceOccurred could only have be set if
 					pxQueue->uxQueueType == queueQUEUE_IS_MUTEX so no need to
@@ -1610,7 +1707,7 @@ Queue_t * const pxQueue = xQueue;
 							again, but only as low as the next highest priority
 							task that is waiting for the same mutex. */
 							uxHighestWaitingPriority = prvGetDisinheritPriorityAfterTimeout( pxQueue );
-							vTaskPriorityDisinheritAfterTimeout( pxQueue->u.xSemaphore.xMutexHolder, uxHighestWaitingPriority );
+							vTaskPriorityDisinheritAfterTimeout( pxQueue->u.xSemaphore.xMutexLink.xHolder, uxHighestWaitingPriority );
 						}
 						taskEXIT_CRITICAL();
 					}
@@ -1677,7 +1774,7 @@ Queue_t * const pxQueue = xQueue;
 
 				/* The data is being left in the queue, so see if there are
 				any other tasks waiting for the data. */
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+				if( xTaskEventListIsEmpty( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 				{
 					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 					{
@@ -1823,7 +1920,7 @@ Queue_t * const pxQueue = xQueue;
 			locked. */
 			if( cRxLock == queueUNLOCKED )
 			{
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+				if( xTaskEventListIsEmpty( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
 				{
 					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
 					{
@@ -1869,150 +1966,604 @@ Queue_t * const pxQueue = xQueue;
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,  void * const pvBuffer )
+size_t xQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItemsToQueue, size_t xItemCount, TickType_t xTicksToWait )
 {
-BaseType_t xReturn;
-UBaseType_t uxSavedInterruptStatus;
-int8_t *pcOriginalReadPosition;
+BaseType_t xEntryTimeSet = pdFALSE;
+TimeOut_t xTimeOut;
 Queue_t * const pxQueue = xQueue;
+const int8_t *pcNextItem = ( const int8_t * ) pvItemsToQueue;
+size_t xItemsSent = 0;
+UBaseType_t uxItemsToCopy;
 
 	configASSERT( pxQueue );
-	configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
-	configASSERT( pxQueue->uxItemSize != 0 ); /* Can't peek a semaphore. */
+	configASSERT( !( ( pvItemsToQueue == NULL ) && ( xItemCount != ( size_t ) 0 ) ) );
 
-	/* RTOS ports that support interrupt nesting have the concept of a maximum
-	system call (or maximum API call) interrupt priority.  Interrupts that are
-	above the maximum system call priority are kept permanently enabled, even
-	when the RTOS kernel is in a critical section, but cannot make any calls to
-	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
-	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-	failure if a FreeRTOS API function is called from an interrupt that has been
-	assigned a priority above the configured maximum system call priority.
-	Only FreeRTOS functions that end in FromISR can be called from interrupts
-	that have been assigned a priority at or (logically) below the maximum
-	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
-	safe API to ensure interrupt entry is as fast and as simple as possible.
-	More information (albeit Cortex-M specific) is provided on the following
-	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
-	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+	/* Semaphores and mutexes do not hold any data so cannot be used with this
+	function. */
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
 
-	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
 	{
-		/* Cannot block in an ISR, so check there is data available. */
-		if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
-		{
-			traceQUEUE_PEEK_FROM_ISR( pxQueue );
-
-			/* Remember the read position so it can be reset as nothing is
-			actually being removed from the queue. */
-			pcOriginalReadPosition = pxQueue->u.xQueue.pcReadFrom;
-			prvCopyDataFromQueue( pxQueue, pvBuffer );
-			pxQueue->u.xQueue.pcReadFrom = pcOriginalReadPosition;
-
-			xReturn = pdPASS;
-		}
-		else
-		{
-			xReturn = pdFAIL;
-			traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
-		}
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
 	}
-	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
-
-	return xReturn;
-}
-/*-----------------------------------------------------------*/
-
-UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
-{
-UBaseType_t uxReturn;
+	#endif
 
-	configASSERT( xQueue );
 
-	taskENTER_CRITICAL();
+	/*lint -save -e904 This function relaxes the coding standard somewhat to
+	allow return statements within the function itself.  This is done in the
+	interest of execution time efficiency. */
+	for( ;; )
 	{
-		uxReturn = ( ( Queue_t * ) xQueue )->uxMessagesWaiting;
-	}
-	taskEXIT_CRITICAL();
-
-	return uxReturn;
-} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
-/*-----------------------------------------------------------*/
+		taskENTER_CRITICAL();
+		{
+			/* Copy as many of the remaining items as there is space for.  To
+			be running the calling task must be the highest priority task
+			wanting to access the queue. */
+			uxItemsToCopy = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
 
-UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue )
-{
-UBaseType_t uxReturn;
-Queue_t * const pxQueue = xQueue;
+			if( ( size_t ) uxItemsToCopy > ( xItemCount - xItemsSent ) )
+			{
+				uxItemsToCopy = ( UBaseType_t ) ( xItemCount - xItemsSent );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-	configASSERT( pxQueue );
+			if( uxItemsToCopy > ( UBaseType_t ) 0 )
+			{
+				traceQUEUE_SEND( pxQueue );
+				prvCopyMultipleToQueue( pxQueue, pcNextItem, uxItemsToCopy );
+				pcNextItem += ( size_t ) uxItemsToCopy * ( size_t ) pxQueue->uxItemSize; /*lint !e9016 Pointer arithmetic on char types ok. */
+				xItemsSent += ( size_t ) uxItemsToCopy;
+
+				/* Unblock as many tasks that were waiting for data as there
+				were items sent, but only yield once.  Yes it is ok to do this
+				from within the critical section - the kernel takes care of
+				that. */
+				if( prvUnblockTasksWaitingToReceive( pxQueue, uxItemsToCopy ) != pdFALSE )
+				{
+					queueYIELD_IF_USING_PREEMPTION();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-	taskENTER_CRITICAL();
-	{
-		uxReturn = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
-	}
-	taskEXIT_CRITICAL();
+			if( xItemsSent == xItemCount )
+			{
+				taskEXIT_CRITICAL();
+				return xItemsSent;
+			}
+			else if( xTicksToWait == ( TickType_t ) 0 )
+			{
+				/* The queue is full and no block time is specified (or the
+				block time has expired) so leave now. */
+				taskEXIT_CRITICAL();
+				traceQUEUE_SEND_FAILED( pxQueue );
+				return xItemsSent;
+			}
+			else if( xEntryTimeSet == pdFALSE )
+			{
+				/* The queue is full and a block time was specified so
+				configure the timeout structure. */
+				vTaskInternalSetTimeOutState( &xTimeOut );
+				xEntryTimeSet = pdTRUE;
+			}
+			else
+			{
+				/* Entry time was already set. */
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
 
-	return uxReturn;
-} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
-/*-----------------------------------------------------------*/
+		/* Interrupts and other tasks can send to and receive from the queue
+		now the critical section has been exited. */
 
-UBaseType_t uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue )
-{
-UBaseType_t uxReturn;
-Queue_t * const pxQueue = xQueue;
+		vTaskSuspendAll();
+		prvLockQueue( pxQueue );
 
-	configASSERT( pxQueue );
-	uxReturn = pxQueue->uxMessagesWaiting;
+		/* Update the timeout state to see if it has expired yet. */
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+		{
+			if( prvIsQueueFull( pxQueue ) != pdFALSE )
+			{
+				traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+				prvUnlockQueue( pxQueue );
 
-	return uxReturn;
-} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
+				if( xTaskResumeAll() == pdFALSE )
+				{
+					portYIELD_WITHIN_API();
+				}
+			}
+			else
+			{
+				/* Try again. */
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+			}
+		}
+		else
+		{
+			/* The timeout has expired.  xTicksToWait is now zero, so loop back
+			to send whatever will fit without blocking, then return. */
+			prvUnlockQueue( pxQueue );
+			( void ) xTaskResumeAll();
+		}
+	} /*lint -restore */
+}
 /*-----------------------------------------------------------*/
 
-void vQueueDelete( QueueHandle_t xQueue )
+size_t xQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, size_t xMaxItemCount, TickType_t xTicksToWait )
 {
+BaseType_t xEntryTimeSet = pdFALSE;
+TimeOut_t xTimeOut;
 Queue_t * const pxQueue = xQueue;
+UBaseType_t uxItemsToCopy;
 
 	configASSERT( pxQueue );
-	traceQUEUE_DELETE( pxQueue );
+	configASSERT( pvBuffer );
+	configASSERT( xMaxItemCount != ( size_t ) 0 );
 
-	#if ( configQUEUE_REGISTRY_SIZE > 0 )
+	/* Semaphores and mutexes do not hold any data so cannot be used with this
+	function. */
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
 	{
-		vQueueUnregisterQueue( pxQueue );
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
 	}
 	#endif
 
-	#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
-	{
-		/* The queue can only have been allocated dynamically - free it
-		again. */
-		vPortFree( pxQueue );
-	}
-	#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+	/*lint -save -e904  This function relaxes the coding standard somewhat to
+	allow return statements within the function itself.  This is done in the
+	interest of execution time efficiency. */
+	for( ;; )
 	{
-		/* The queue could have been allocated statically or dynamically, so
-		check before attempting to free the memory. */
-		if( pxQueue->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
-		{
-			vPortFree( pxQueue );
-		}
-		else
+		taskENTER_CRITICAL();
 		{
-			mtCOVERAGE_TEST_MARKER();
-		}
-	}
-	#else
-	{
-		/* The queue must have been statically allocated, so is not going to be
-		deleted.  Avoid compiler warnings about the unused parameter. */
-		( void ) pxQueue;
-	}
-	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
-}
-/*-----------------------------------------------------------*/
+			uxItemsToCopy = pxQueue->uxMessagesWaiting;
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+			/* Is there data in the queue now?  To be running the calling task
+			must be the highest priority task wanting to access the queue. */
+			if( uxItemsToCopy > ( UBaseType_t ) 0 )
+			{
+				/* Data available, remove as many items as are available, up to
+				the size of the buffer. */
+				if( ( size_t ) uxItemsToCopy > xMaxItemCount )
+				{
+					uxItemsToCopy = ( UBaseType_t ) xMaxItemCount;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 
-	UBaseType_t uxQueueGetQueueNumber( QueueHandle_t xQueue )
+				prvCopyMultipleFromQueue( pxQueue, ( int8_t * ) pvBuffer, uxItemsToCopy );
+				traceQUEUE_RECEIVE( pxQueue );
+
+				/* There is now space in the queue.  Unblock as many tasks that
+				were waiting to post to the queue as there were items removed,
+				but only yield once. */
+				if( prvUnblockTasksWaitingToSend( pxQueue, uxItemsToCopy ) != pdFALSE )
+				{
+					queueYIELD_IF_USING_PREEMPTION();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				taskEXIT_CRITICAL();
+				return ( size_t ) uxItemsToCopy;
+			}
+			else
+			{
+				if( xTicksToWait == ( TickType_t ) 0 )
+				{
+					/* The queue was empty and no block time is specified (or
+					the block time has expired) so leave now. */
+					taskEXIT_CRITICAL();
+					traceQUEUE_RECEIVE_FAILED( pxQueue );
+					return ( size_t ) 0;
+				}
+				else if( xEntryTimeSet == pdFALSE )
+				{
+					/* The queue was empty and a block time was specified so
+					configure the timeout structure. */
+					vTaskInternalSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					/* Entry time was already set. */
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		/* Interrupts and other tasks can send to and receive from the queue
+		now the critical section has been exited. */
+
+		vTaskSuspendAll();
+		prvLockQueue( pxQueue );
+
+		/* Update the timeout state to see if it has expired yet. */
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+		{
+			/* The timeout has not expired.  If the queue is still empty place
+			the task on the list of tasks waiting to receive from the queue. */
+			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+			{
+				traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+				prvUnlockQueue( pxQueue );
+				if( xTaskResumeAll() == pdFALSE )
+				{
+					portYIELD_WITHIN_API();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				/* The queue contains data again.  Loop back to try and read the
+				data. */
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+			}
+		}
+		else
+		{
+			/* Timed out.  If there is no data in the queue exit, otherwise loop
+			back and attempt to read the data. */
+			prvUnlockQueue( pxQueue );
+			( void ) xTaskResumeAll();
+
+			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+			{
+				traceQUEUE_RECEIVE_FAILED( pxQueue );
+				return ( size_t ) 0;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	} /*lint -restore */
+}
+/*-----------------------------------------------------------*/
+
+size_t xQueueSendMultipleFromISR( QueueHandle_t xQueue, const void * const pvItemsToQueue, size_t xItemCount, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+UBaseType_t uxSavedInterruptStatus;
+UBaseType_t uxItemsToCopy;
+Queue_t * const pxQueue = xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvItemsToQueue == NULL ) && ( xItemCount != ( size_t ) 0 ) ) );
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+	/* See the comments in xQueueGenericSendFromISR(). */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		/* Cannot block in an ISR, so send only as many items as there is
+		space for. */
+		uxItemsToCopy = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+
+		if( ( size_t ) uxItemsToCopy > xItemCount )
+		{
+			uxItemsToCopy = ( UBaseType_t ) xItemCount;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( uxItemsToCopy > ( UBaseType_t ) 0 )
+		{
+			const int8_t cTxLock = pxQueue->cTxLock;
+
+			traceQUEUE_SEND_FROM_ISR( pxQueue );
+			prvCopyMultipleToQueue( pxQueue, ( const int8_t * ) pvItemsToQueue, uxItemsToCopy );
+
+			/* The event list is not altered if the queue is locked.  This will
+			be done when the queue is unlocked later. */
+			if( cTxLock == queueUNLOCKED )
+			{
+				if( prvUnblockTasksWaitingToReceive( pxQueue, uxItemsToCopy ) != pdFALSE )
+				{
+					if( pxHigherPriorityTaskWoken != NULL )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				/* Add the number of items sent to the lock count so the task
+				that unlocks the queue knows how many tasks may need to be
+				unblocked.  The count saturates rather than overflowing. */
+				if( ( UBaseType_t ) ( queueMAX_LOCK_COUNT - cTxLock ) > uxItemsToCopy )
+				{
+					pxQueue->cTxLock = ( int8_t ) ( cTxLock + ( int8_t ) uxItemsToCopy );
+				}
+				else
+				{
+					pxQueue->cTxLock = queueMAX_LOCK_COUNT;
+				}
+			}
+		}
+		else
+		{
+			traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return ( size_t ) uxItemsToCopy;
+}
+/*-----------------------------------------------------------*/
+
+size_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue, void * const pvBuffer, size_t xMaxItemCount, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+UBaseType_t uxSavedInterruptStatus;
+UBaseType_t uxItemsToCopy;
+Queue_t * const pxQueue = xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvBuffer == NULL ) && ( xMaxItemCount != ( size_t ) 0 ) ) );
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+	/* See the comments in xQueueGenericSendFromISR(). */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		/* Cannot block in an ISR, so receive only the items that are already
+		available. */
+		uxItemsToCopy = pxQueue->uxMessagesWaiting;
+
+		if( ( size_t ) uxItemsToCopy > xMaxItemCount )
+		{
+			uxItemsToCopy = ( UBaseType_t ) xMaxItemCount;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( uxItemsToCopy > ( UBaseType_t ) 0 )
+		{
+			const int8_t cRxLock = pxQueue->cRxLock;
+
+			traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+			prvCopyMultipleFromQueue( pxQueue, ( int8_t * ) pvBuffer, uxItemsToCopy );
+
+			/* If the queue is locked the event list will not be modified.
+			Instead add to the lock count so the task that unlocks the queue
+			will know how many items were removed while the queue was locked.
+			The count saturates rather than overflowing. */
+			if( cRxLock == queueUNLOCKED )
+			{
+				if( prvUnblockTasksWaitingToSend( pxQueue, uxItemsToCopy ) != pdFALSE )
+				{
+					if( pxHigherPriorityTaskWoken != NULL )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else if( ( UBaseType_t ) ( queueMAX_LOCK_COUNT - cRxLock ) > uxItemsToCopy )
+			{
+				pxQueue->cRxLock = ( int8_t ) ( cRxLock + ( int8_t ) uxItemsToCopy );
+			}
+			else
+			{
+				pxQueue->cRxLock = queueMAX_LOCK_COUNT;
+			}
+		}
+		else
+		{
+			traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return ( size_t ) uxItemsToCopy;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,  void * const pvBuffer )
+{
+BaseType_t xReturn;
+UBaseType_t uxSavedInterruptStatus;
+int8_t *pcOriginalReadPosition;
+Queue_t * const pxQueue = xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+	configASSERT( pxQueue->uxItemSize != 0 ); /* Can't peek a semaphore. */
+
+	/* RTOS ports that support interrupt nesting have the concept of a maximum
+	system call (or maximum API call) interrupt priority.  Interrupts that are
+	above the maximum system call priority are kept permanently enabled, even
+	when the RTOS kernel is in a critical section, but cannot make any calls to
+	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+	failure if a FreeRTOS API function is called from an interrupt that has been
+	assigned a priority above the configured maximum system call priority.
+	Only FreeRTOS functions that end in FromISR can be called from interrupts
+	that have been assigned a priority at or (logically) below the maximum
+	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
+	safe API to ensure interrupt entry is as fast and as simple as possible.
+	More information (albeit Cortex-M specific) is provided on the following
+	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		/* Cannot block in an ISR, so check there is data available. */
+		if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+		{
+			traceQUEUE_PEEK_FROM_ISR( pxQueue );
+
+			/* Remember the read position so it can be reset as nothing is
+			actually being removed from the queue. */
+			pcOriginalReadPosition = pxQueue->u.xQueue.pcReadFrom;
+			prvCopyDataFromQueue( pxQueue, pvBuffer );
+			pxQueue->u.xQueue.pcReadFrom = pcOriginalReadPosition;
+
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = pdFAIL;
+			traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
+{
+UBaseType_t uxReturn;
+
+	configASSERT( xQueue );
+
+	taskENTER_CRITICAL();
+	{
+		uxReturn = ( ( Queue_t * ) xQueue )->uxMessagesWaiting;
+	}
+	taskEXIT_CRITICAL();
+
+	return uxReturn;
+} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue )
+{
+UBaseType_t uxReturn;
+Queue_t * const pxQueue = xQueue;
+
+	configASSERT( pxQueue );
+
+	taskENTER_CRITICAL();
+	{
+		uxReturn = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+	}
+	taskEXIT_CRITICAL();
+
+	return uxReturn;
+} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue )
+{
+UBaseType_t uxReturn;
+Queue_t * const pxQueue = xQueue;
+
+	configASSERT( pxQueue );
+	uxReturn = pxQueue->uxMessagesWaiting;
+
+	return uxReturn;
+} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
+/*-----------------------------------------------------------*/
+
+void vQueueDelete( QueueHandle_t xQueue )
+{
+Queue_t * const pxQueue = xQueue;
+
+	configASSERT( pxQueue );
+	traceQUEUE_DELETE( pxQueue );
+
+	#if ( configQUEUE_REGISTRY_SIZE > 0 )
+	{
+		vQueueUnregisterQueue( pxQueue );
+	}
+	#endif
+
+	#if( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+	{
+		if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+		{
+			taskENTER_CRITICAL();
+			{
+				vTaskMutexDeleted( &( pxQueue->u.xSemaphore.xMutexLink ) );
+			}
+			taskEXIT_CRITICAL();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configUSE_TRANSITIVE_PRIORITY_INHERITANCE */
+
+	#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+	{
+		/* The queue can only have been allocated dynamically - free it
+		again. */
+		queueFREE( pxQueue );
+	}
+	#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+	{
+		/* The queue could have been allocated statically or dynamically, so
+		check before attempting to free the memory. */
+		if( pxQueue->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+		{
+			queueFREE( pxQueue );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#else
+	{
+		/* The queue must have been statically allocated, so is not going to be
+		deleted.  Avoid compiler warnings about the unused parameter. */
+		( void ) pxQueue;
+	}
+	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	UBaseType_t uxQueueGetQueueNumber( QueueHandle_t xQueue )
 	{
 		return ( ( Queue_t * ) xQueue )->uxQueueNumber;
 	}
@@ -2040,31 +2591,20 @@ Queue_t * const pxQueue = xQueue;
 #endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
-#if( configUSE_MUTEXES == 1 )
+#if( ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 0 ) )
 
-	static UBaseType_t prvGetDisinheritPriorityAfterTimeout( const Queue_t * const pxQueue )
+	static UBaseType_t prvGetDisinheritPriorityAfterTimeout( Queue_t * const pxQueue )
 	{
-	UBaseType_t uxHighestPriorityOfWaitingTasks;
-
 		/* If a task waiting for a mutex causes the mutex holder to inherit a
 		priority, but the waiting task times out, then the holder should
 		disinherit the priority - but only down to the highest priority of any
 		other tasks that are waiting for the same mutex.  For this purpose,
 		return the priority of the highest priority task that is waiting for the
 		mutex. */
-		if( listCURRENT_LIST_LENGTH( &( pxQueue->xTasksWaitingToReceive ) ) > 0U )
-		{
-			uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxQueue->xTasksWaitingToReceive ) );
-		}
-		else
-		{
-			uxHighestPriorityOfWaitingTasks = tskIDLE_PRIORITY;
-		}
-
-		return uxHighestPriorityOfWaitingTasks;
+		return uxTaskEventListGetHighestPriority( &( pxQueue->xTasksWaitingToReceive ) );
 	}
 
-#endif /* configUSE_MUTEXES */
+#endif /* ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 0 ) */
 /*-----------------------------------------------------------*/
 
 static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue, const void *pvItemToQueue, const BaseType_t xPosition )
@@ -2083,8 +2623,16 @@ UBaseType_t uxMessagesWaiting;
 			if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
 			{
 				/* The mutex is no longer being held. */
-				xReturn = xTaskPriorityDisinherit( pxQueue->u.xSemaphore.xMutexHolder );
-				pxQueue->u.xSemaphore.xMutexHolder = NULL;
+				#if( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+				{
+					xReturn = xTaskPriorityDisinheritMutex( &( pxQueue->u.xSemaphore.xMutexLink ) );
+				}
+				#else
+				{
+					xReturn = xTaskPriorityDisinherit( pxQueue->u.xSemaphore.xMutexLink.xHolder );
+				}
+				#endif
+				pxQueue->u.xSemaphore.xMutexLink.xHolder = NULL;
 			}
 			else
 			{
@@ -2164,6 +2712,178 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer
 }
 /*-----------------------------------------------------------*/
 
+static void prvCopyMultipleToQueue( Queue_t * const pxQueue, const int8_t *pcItems, const UBaseType_t uxItemCount )
+{
+size_t xFirstLength;
+const size_t xTotalLength = ( size_t ) uxItemCount * ( size_t ) pxQueue->uxItemSize;
+
+	/* This function is called from a critical section. */
+
+	/* Copy as much as will fit between the write position and the end of the
+	storage area. */
+	xFirstLength = ( size_t ) ( pxQueue->u.xQueue.pcTail - pxQueue->pcWriteTo ); /*lint !e946 !e9033 Pointer difference within the same storage area. */
+
+	if( xFirstLength > xTotalLength )
+	{
+		xFirstLength = xTotalLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	( void ) memcpy( ( void * ) pxQueue->pcWriteTo, ( const void * ) pcItems, xFirstLength ); /*lint !e961 !e418 !e9087 Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+
+	if( xTotalLength > xFirstLength )
+	{
+		/* The items wrap, so copy the remainder to the start of the storage
+		area. */
+		( void ) memcpy( ( void * ) pxQueue->pcHead, ( const void * ) ( pcItems + xFirstLength ), xTotalLength - xFirstLength ); /*lint !e961 !e418 !e9087 !e9016 Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+		pxQueue->pcWriteTo = pxQueue->pcHead + ( xTotalLength - xFirstLength ); /*lint !e9016 Pointer arithmetic on char types ok. */
+	}
+	else
+	{
+		pxQueue->pcWriteTo += xTotalLength; /*lint !e9016 Pointer arithmetic on char types ok. */
+
+		if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+		{
+			pxQueue->pcWriteTo = pxQueue->pcHead;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	pxQueue->uxMessagesWaiting += uxItemCount;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCopyMultipleFromQueue( Queue_t * const pxQueue, int8_t *pcBuffer, const UBaseType_t uxItemCount )
+{
+size_t xFirstLength;
+const size_t xTotalLength = ( size_t ) uxItemCount * ( size_t ) pxQueue->uxItemSize;
+int8_t *pcReadFrom;
+
+	/* This function is called from a critical section. */
+
+	/* pcReadFrom points to the last item read, so the first item to read is
+	the one that follows it. */
+	pcReadFrom = pxQueue->u.xQueue.pcReadFrom + pxQueue->uxItemSize; /*lint !e9016 Pointer arithmetic on char types ok. */
+
+	if( pcReadFrom >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+	{
+		pcReadFrom = pxQueue->pcHead;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xFirstLength = ( size_t ) ( pxQueue->u.xQueue.pcTail - pcReadFrom ); /*lint !e946 !e9033 Pointer difference within the same storage area. */
+
+	if( xFirstLength > xTotalLength )
+	{
+		xFirstLength = xTotalLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	( void ) memcpy( ( void * ) pcBuffer, ( void * ) pcReadFrom, xFirstLength ); /*lint !e961 !e418 !e9087 Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+
+	if( xTotalLength > xFirstLength )
+	{
+		/* The items wrap, so copy the remainder from the start of the storage
+		area. */
+		( void ) memcpy( ( void * ) ( pcBuffer + xFirstLength ), ( void * ) pxQueue->pcHead, xTotalLength - xFirstLength ); /*lint !e961 !e418 !e9087 !e9016 Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+		pcReadFrom = pxQueue->pcHead + ( xTotalLength - xFirstLength ); /*lint !e9016 Pointer arithmetic on char types ok. */
+	}
+	else
+	{
+		pcReadFrom += xTotalLength; /*lint !e9016 Pointer arithmetic on char types ok. */
+	}
+
+	/* Leave pcReadFrom pointing to the last item read, as prvCopyDataFromQueue()
+	does. */
+	pxQueue->u.xQueue.pcReadFrom = pcReadFrom - pxQueue->uxItemSize; /*lint !e9016 Pointer arithmetic on char types ok. */
+	pxQueue->uxMessagesWaiting -= uxItemCount;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvUnblockTasksWaitingToReceive( Queue_t * const pxQueue, UBaseType_t uxItemsAdded )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	/* This function is called from a critical section, or from an ISR with
+	interrupts masked, and only when the queue is not locked. */
+
+	#if ( configUSE_QUEUE_SETS == 1 )
+		if( pxQueue->pxQueueSetContainer != NULL )
+		{
+			/* The queue set holds one entry for each item in its member
+			queues, so is notified once per item. */
+			while( uxItemsAdded > ( UBaseType_t ) 0 )
+			{
+				if( prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
+				{
+					xHigherPriorityTaskWoken = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				uxItemsAdded--;
+			}
+		}
+		else
+	#endif /* configUSE_QUEUE_SETS */
+	{
+		while( ( uxItemsAdded > ( UBaseType_t ) 0 ) && ( xTaskEventListIsEmpty( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE ) )
+		{
+			if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+			{
+				xHigherPriorityTaskWoken = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			uxItemsAdded--;
+		}
+	}
+
+	return xHigherPriorityTaskWoken;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvUnblockTasksWaitingToSend( Queue_t * const pxQueue, UBaseType_t uxItemsRemoved )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	/* This function is called from a critical section, or from an ISR with
+	interrupts masked, and only when the queue is not locked. */
+	while( ( uxItemsRemoved > ( UBaseType_t ) 0 ) && ( xTaskEventListIsEmpty( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE ) )
+	{
+		if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+		{
+			xHigherPriorityTaskWoken = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		uxItemsRemoved--;
+	}
+
+	return xHigherPriorityTaskWoken;
+}
+/*-----------------------------------------------------------*/
+
 static void prvUnlockQueue( Queue_t * const pxQueue )
 {
 	/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
@@ -2202,7 +2922,7 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
 					/* Tasks that are removed from the event list will get
 					added to the pending ready list as the scheduler is still
 					suspended. */
-					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+					if( xTaskEventListIsEmpty( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 					{
 						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 						{
@@ -2225,7 +2945,7 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
 			{
 				/* Tasks that are removed from the event list will get added to
 				the pending ready list as the scheduler is still suspended. */
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+				if( xTaskEventListIsEmpty( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 				{
 					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 					{
@@ -2259,7 +2979,7 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
 
 		while( cRxLock > queueLOCKED_UNMODIFIED )
 		{
-			if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+			if( xTaskEventListIsEmpty( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
 			{
 				if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
 				{
@@ -2896,7 +3616,7 @@ Queue_t * const pxQueue = xQueue;
 
 			if( cTxLock == queueUNLOCKED )
 			{
-				if( listLIST_IS_EMPTY( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) == pdFALSE )
+				if( xTaskEventListIsEmpty( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) == pdFALSE )
 				{
 					if( xTaskRemoveFromEventList( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) != pdFALSE )
 					{
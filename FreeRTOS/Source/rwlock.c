@@ -0,0 +1,573 @@
+/*
+ * FreeRTOS Kernel V10.1.1
+ * Copyright (C) 2018 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* The reader-writer lock is built on the public mutex and task notification
+API functions, so, unlike the other kernel source files, this file does not
+define MPU_WRAPPERS_INCLUDED_FROM_API_FILE. */
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "rwlock.h"
+
+#if( configUSE_MUTEXES != 1 )
+	#error configUSE_MUTEXES must be set to 1 to build rwlock.c
+#endif
+
+#if( configUSE_TASK_NOTIFICATIONS != 1 )
+	#error configUSE_TASK_NOTIFICATIONS must be set to 1 to build rwlock.c
+#endif
+
+#if( configRWLOCK_NOTIFICATION_INDEX >= configTASK_NOTIFICATION_ARRAY_ENTRIES )
+	#error configTASK_NOTIFICATION_ARRAY_ENTRIES must be greater than configRWLOCK_NOTIFICATION_INDEX to build rwlock.c
+#endif
+
+/* Contention statistics are only counted when configUSE_RWLOCK_STATS is 1.
+The counters are only updated from within a critical section. */
+#if( configUSE_RWLOCK_STATS == 1 )
+	#define rwlockCOUNT( pxRWLock, ulCounter )	( ( pxRWLock )->xStats.ulCounter )++
+#else
+	#define rwlockCOUNT( pxRWLock, ulCounter )
+#endif
+
+typedef struct RWLockDef_t
+{
+	volatile UBaseType_t uxReaders;			/*< The number of readers that hold the lock. */
+	volatile UBaseType_t uxWritersPending;	/*< The number of writers that hold, or are waiting for, the lock.  Readers are not admitted without passing through xWriteMutex while this is not 0. */
+	volatile TaskHandle_t xWriter;			/*< The task that holds xWriteMutex, which either holds the lock for writing or is waiting for the readers to release it. */
+	SemaphoreHandle_t xWriteMutex;			/*< Serialises writers, and readers that have to wait for a writer. */
+
+	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+		StaticSemaphore_t xWriteMutexBuffer; /*< Holds xWriteMutex, so the lock is created with a single allocation. */
+	#endif
+
+	#if( configUSE_RWLOCK_STATS == 1 )
+		RWLockStats_t xStats;
+	#endif
+
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t ucStaticallyAllocated; /*< Set to pdTRUE if the lock is statically allocated to ensure no attempt is made to free the memory. */
+	#endif
+} RWLock_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Initialise the members of a newly allocated lock.  Returns pdFAIL if the
+ * writers' mutex could not be created.
+ */
+static BaseType_t prvInitialiseNewRWLock( RWLock_t *pxRWLock );
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	RWLockHandle_t xRWLockCreateStatic( StaticRWLock_t *pxRWLockBuffer )
+	{
+	RWLock_t *pxRWLock;
+
+		/* A StaticRWLock_t object must be provided. */
+		configASSERT( pxRWLockBuffer );
+
+		#if( configASSERT_DEFINED == 1 )
+		{
+			/* Sanity check that the size of the structure used to declare a
+			variable of type StaticRWLock_t equals the size of the real lock
+			structure. */
+			volatile size_t xSize = sizeof( StaticRWLock_t );
+			configASSERT( xSize == sizeof( RWLock_t ) );
+		} /*lint !e529 xSize is referenced if configASSERT() is defined. */
+		#endif /* configASSERT_DEFINED */
+
+		pxRWLock = ( RWLock_t * ) pxRWLockBuffer; /*lint !e740 !e9087 RWLock_t and StaticRWLock_t are deliberately aliased for data hiding purposes and guaranteed to have the same size and alignment requirement - checked by configASSERT(). */
+
+		if( pxRWLock != NULL )
+		{
+			( void ) prvInitialiseNewRWLock( pxRWLock );
+
+			#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+			{
+				/* Both static and dynamic allocation can be used, so note that
+				this lock was created statically in case it is later deleted. */
+				pxRWLock->ucStaticallyAllocated = pdTRUE;
+			}
+			#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pxRWLock;
+	}
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	RWLockHandle_t xRWLockCreate( void )
+	{
+	RWLock_t *pxRWLock;
+
+		pxRWLock = ( RWLock_t * ) pvPortMalloc( sizeof( RWLock_t ) ); /*lint !e9087 !e9079 pvPortMalloc() returns memory aligned for any structure. */
+
+		if( pxRWLock != NULL )
+		{
+			if( prvInitialiseNewRWLock( pxRWLock ) != pdFAIL )
+			{
+				#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+				{
+					/* Both static and dynamic allocation can be used, so note
+					this lock was allocated dynamically in case it is later
+					deleted. */
+					pxRWLock->ucStaticallyAllocated = pdFALSE;
+				}
+				#endif /* configSUPPORT_STATIC_ALLOCATION */
+			}
+			else
+			{
+				vPortFree( pxRWLock );
+				pxRWLock = NULL;
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pxRWLock;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvInitialiseNewRWLock( RWLock_t *pxRWLock )
+{
+BaseType_t xReturn = pdPASS;
+
+	pxRWLock->uxReaders = ( UBaseType_t ) 0;
+	pxRWLock->uxWritersPending = ( UBaseType_t ) 0;
+	pxRWLock->xWriter = NULL;
+
+	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	{
+		pxRWLock->xWriteMutex = xSemaphoreCreateMutexStatic( &( pxRWLock->xWriteMutexBuffer ) );
+	}
+	#else
+	{
+		pxRWLock->xWriteMutex = xSemaphoreCreateMutex();
+	}
+	#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+	if( pxRWLock->xWriteMutex == NULL )
+	{
+		xReturn = pdFAIL;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	#if( configUSE_RWLOCK_STATS == 1 )
+	{
+		vRWLockResetStats( pxRWLock );
+	}
+	#endif /* configUSE_RWLOCK_STATS */
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vRWLockDelete( RWLockHandle_t xRWLock )
+{
+RWLock_t *pxRWLock = xRWLock;
+
+	configASSERT( pxRWLock );
+	configASSERT( pxRWLock->uxReaders == ( UBaseType_t ) 0 );
+	configASSERT( pxRWLock->uxWritersPending == ( UBaseType_t ) 0 );
+
+	vSemaphoreDelete( pxRWLock->xWriteMutex );
+
+	#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+	{
+		/* The lock can only have been allocated dynamically - free it
+		again. */
+		vPortFree( pxRWLock );
+	}
+	#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+	{
+		/* The lock could have been allocated statically or dynamically, so
+		check before attempting to free the memory. */
+		if( pxRWLock->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+		{
+			vPortFree( pxRWLock );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRWLockReadLock( RWLockHandle_t xRWLock, TickType_t xTicksToWait )
+{
+RWLock_t * const pxRWLock = xRWLock;
+BaseType_t xReturn = pdFAIL;
+
+	configASSERT( pxRWLock );
+
+	taskENTER_CRITICAL();
+	{
+		/* Readers are admitted straight away unless a writer holds, or is
+		waiting for, the lock. */
+		if( pxRWLock->uxWritersPending == ( UBaseType_t ) 0 )
+		{
+			( pxRWLock->uxReaders )++;
+			rwlockCOUNT( pxRWLock, ulReadLocks );
+			xReturn = pdPASS;
+		}
+		else
+		{
+			rwlockCOUNT( pxRWLock, ulReadContentions );
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	if( xReturn == pdFAIL )
+	{
+		/* Wait behind the writers by taking the writers' mutex.  The task that
+		holds the mutex inherits the priority of this task while it waits.  Once
+		the mutex has been obtained no writer holds the lock, so this task can
+		join the readers and pass the mutex on to the next task waiting for it.
+		A writer that takes the mutex next will wait for this task to release
+		the lock. */
+		if( xSemaphoreTake( pxRWLock->xWriteMutex, xTicksToWait ) != pdFALSE )
+		{
+			taskENTER_CRITICAL();
+			{
+				( pxRWLock->uxReaders )++;
+				rwlockCOUNT( pxRWLock, ulReadLocks );
+			}
+			taskEXIT_CRITICAL();
+
+			( void ) xSemaphoreGive( pxRWLock->xWriteMutex );
+			xReturn = pdPASS;
+		}
+		else
+		{
+			taskENTER_CRITICAL();
+			{
+				rwlockCOUNT( pxRWLock, ulTimeouts );
+			}
+			taskEXIT_CRITICAL();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRWLockReadUnlock( RWLockHandle_t xRWLock )
+{
+RWLock_t * const pxRWLock = xRWLock;
+BaseType_t xReturn = pdPASS;
+
+	configASSERT( pxRWLock );
+
+	taskENTER_CRITICAL();
+	{
+		if( pxRWLock->uxReaders > ( UBaseType_t ) 0 )
+		{
+			( pxRWLock->uxReaders )--;
+
+			/* If this was the last reader then a writer may be waiting for the
+			readers to release the lock.  It is notified from within the
+			critical section so it cannot time out, and be deleted, first. */
+			if( ( pxRWLock->uxReaders == ( UBaseType_t ) 0 ) && ( pxRWLock->xWriter != NULL ) )
+			{
+				( void ) xTaskNotifyIndexed( pxRWLock->xWriter, configRWLOCK_NOTIFICATION_INDEX, ( uint32_t ) 0, eNoAction );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			xReturn = pdFAIL;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRWLockTryReadLockFromISR( RWLockHandle_t xRWLock )
+{
+RWLock_t * const pxRWLock = xRWLock;
+BaseType_t xReturn;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxRWLock );
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		if( pxRWLock->uxWritersPending == ( UBaseType_t ) 0 )
+		{
+			( pxRWLock->uxReaders )++;
+			rwlockCOUNT( pxRWLock, ulReadLocks );
+			xReturn = pdPASS;
+		}
+		else
+		{
+			rwlockCOUNT( pxRWLock, ulReadContentions );
+			xReturn = pdFAIL;
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRWLockReadUnlockFromISR( RWLockHandle_t xRWLock, BaseType_t *pxHigherPriorityTaskWoken )
+{
+RWLock_t * const pxRWLock = xRWLock;
+BaseType_t xReturn = pdPASS;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxRWLock );
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		if( pxRWLock->uxReaders > ( UBaseType_t ) 0 )
+		{
+			( pxRWLock->uxReaders )--;
+
+			if( ( pxRWLock->uxReaders == ( UBaseType_t ) 0 ) && ( pxRWLock->xWriter != NULL ) )
+			{
+				( void ) xTaskNotifyIndexedFromISR( pxRWLock->xWriter, configRWLOCK_NOTIFICATION_INDEX, ( uint32_t ) 0, eNoAction, pxHigherPriorityTaskWoken );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			xReturn = pdFAIL;
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRWLockWriteLock( RWLockHandle_t xRWLock, TickType_t xTicksToWait )
+{
+RWLock_t * const pxRWLock = xRWLock;
+TimeOut_t xTimeOut;
+BaseType_t xReturn, xReadersActive;
+
+	configASSERT( pxRWLock );
+	configASSERT( pxRWLock->xWriter != xTaskGetCurrentTaskHandle() );
+
+	vTaskSetTimeOutState( &xTimeOut );
+
+	/* Stop further readers being admitted without passing through the
+	writers' mutex. */
+	taskENTER_CRITICAL();
+	{
+		if( ( pxRWLock->uxWritersPending != ( UBaseType_t ) 0 ) || ( pxRWLock->uxReaders != ( UBaseType_t ) 0 ) )
+		{
+			rwlockCOUNT( pxRWLock, ulWriteContentions );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		( pxRWLock->uxWritersPending )++;
+	}
+	taskEXIT_CRITICAL();
+
+	/* Wait for any other writer, and for any reader that is passing through
+	the mutex. */
+	xReturn = xSemaphoreTake( pxRWLock->xWriteMutex, xTicksToWait );
+
+	if( xReturn != pdFALSE )
+	{
+		/* Wait for the readers that already hold the lock to release it.  The
+		last of them notifies the task recorded in xWriter. */
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
+			{
+				if( pxRWLock->uxReaders == ( UBaseType_t ) 0 )
+				{
+					xReadersActive = pdFALSE;
+				}
+				else
+				{
+					/* Clear notification state as going to wait for the
+					readers. */
+					( void ) xTaskNotifyStateClearIndexed( NULL, configRWLOCK_NOTIFICATION_INDEX );
+					xReadersActive = pdTRUE;
+				}
+
+				pxRWLock->xWriter = xTaskGetCurrentTaskHandle();
+			}
+			taskEXIT_CRITICAL();
+
+			if( xReadersActive == pdFALSE )
+			{
+				break;
+			}
+			else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+			{
+				/* Timed out while readers still hold the lock, so let other
+				tasks have the mutex again. */
+				taskENTER_CRITICAL();
+				{
+					pxRWLock->xWriter = NULL;
+				}
+				taskEXIT_CRITICAL();
+
+				( void ) xSemaphoreGive( pxRWLock->xWriteMutex );
+				xReturn = pdFAIL;
+				break;
+			}
+			else
+			{
+				( void ) xTaskNotifyWaitIndexed( configRWLOCK_NOTIFICATION_INDEX, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+			}
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	taskENTER_CRITICAL();
+	{
+		if( xReturn != pdFALSE )
+		{
+			rwlockCOUNT( pxRWLock, ulWriteLocks );
+		}
+		else
+		{
+			( pxRWLock->uxWritersPending )--;
+			rwlockCOUNT( pxRWLock, ulTimeouts );
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRWLockWriteUnlock( RWLockHandle_t xRWLock )
+{
+RWLock_t * const pxRWLock = xRWLock;
+BaseType_t xReturn;
+
+	configASSERT( pxRWLock );
+
+	if( pxRWLock->xWriter == xTaskGetCurrentTaskHandle() )
+	{
+		taskENTER_CRITICAL();
+		{
+			pxRWLock->xWriter = NULL;
+			( pxRWLock->uxWritersPending )--;
+		}
+		taskEXIT_CRITICAL();
+
+		/* Giving the mutex disinherits any priority inherited from the tasks
+		that waited for the lock, and lets the highest priority of them run. */
+		xReturn = xSemaphoreGive( pxRWLock->xWriteMutex );
+	}
+	else
+	{
+		xReturn = pdFAIL;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_RWLOCK_STATS == 1 )
+
+	void vRWLockGetStats( RWLockHandle_t xRWLock, RWLockStats_t *pxStats )
+	{
+	RWLock_t * const pxRWLock = xRWLock;
+
+		configASSERT( pxRWLock );
+		configASSERT( pxStats );
+
+		taskENTER_CRITICAL();
+		{
+			*pxStats = pxRWLock->xStats;
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_RWLOCK_STATS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_RWLOCK_STATS == 1 )
+
+	void vRWLockResetStats( RWLockHandle_t xRWLock )
+	{
+	RWLock_t * const pxRWLock = xRWLock;
+
+		configASSERT( pxRWLock );
+
+		taskENTER_CRITICAL();
+		{
+			pxRWLock->xStats.ulReadLocks = 0UL;
+			pxRWLock->xStats.ulReadContentions = 0UL;
+			pxRWLock->xStats.ulWriteLocks = 0UL;
+			pxRWLock->xStats.ulWriteContentions = 0UL;
+			pxRWLock->xStats.ulTimeouts = 0UL;
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_RWLOCK_STATS */
@@ -43,6 +43,28 @@ task.h is included from an application file. */
 	#error configUSE_TASK_NOTIFICATIONS must be set to 1 to build stream_buffer.c
 #endif
 
+#if( configUSE_LOCK_FREE_STREAM_BUFFERS == 1 )
+	#ifndef portMEMORY_BARRIER
+		#error portMEMORY_BARRIER() must be defined in portmacro.h to use configUSE_LOCK_FREE_STREAM_BUFFERS
+	#endif
+
+	/* There is only one writer, which only updates xHead, and only one reader,
+	which only updates xTail, so the indexes can be updated without a critical
+	section provided the data is written to (or read from) the buffer before
+	the index that makes it visible to the other side is updated, and the index
+	is updated before the other side's waiting task handle is checked. */
+	#define sbINDEX_BARRIER()	portMEMORY_BARRIER()
+
+	/* A notification only needs to be sent if the other side is blocked.  The
+	other side sets its handle and checks the index in one critical section, so
+	if the handle is NULL here the other side will see the updated index before
+	it blocks. */
+	#define sbTASK_MIGHT_BE_WAITING( xTask ) ( ( xTask ) != NULL )
+#else
+	#define sbINDEX_BARRIER()
+	#define sbTASK_MIGHT_BE_WAITING( xTask ) ( pdTRUE )
+#endif /* configUSE_LOCK_FREE_STREAM_BUFFERS */
+
 /* Lint e961, e9021 and e750 are suppressed as a MISRA exception justified
 because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
 for the header files above, but not in this file, in order to generate the
@@ -55,22 +77,26 @@ that uses task notifications. */
 /*lint -save -e9026 Function like macros allowed and needed here so they can be overidden. */
 #ifndef sbRECEIVE_COMPLETED
 	#define sbRECEIVE_COMPLETED( pxStreamBuffer )										\
-		vTaskSuspendAll();																\
+		if( sbTASK_MIGHT_BE_WAITING( ( pxStreamBuffer )->xTaskWaitingToSend ) )		\
 		{																				\
-			if( ( pxStreamBuffer )->xTaskWaitingToSend != NULL )						\
+			vTaskSuspendAll();															\
 			{																			\
-				( void ) xTaskNotify( ( pxStreamBuffer )->xTaskWaitingToSend,			\
-									  ( uint32_t ) 0,									\
-									  eNoAction );										\
-				( pxStreamBuffer )->xTaskWaitingToSend = NULL;							\
+				if( ( pxStreamBuffer )->xTaskWaitingToSend != NULL )					\
+				{																		\
+					( void ) xTaskNotify( ( pxStreamBuffer )->xTaskWaitingToSend,		\
+										  ( uint32_t ) 0,								\
+										  eNoAction );									\
+					( pxStreamBuffer )->xTaskWaitingToSend = NULL;						\
+				}																		\
 			}																			\
-		}																				\
-		( void ) xTaskResumeAll();
+			( void ) xTaskResumeAll();													\
+		}
 #endif /* sbRECEIVE_COMPLETED */
 
 #ifndef sbRECEIVE_COMPLETED_FROM_ISR
 	#define sbRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer,								\
 										  pxHigherPriorityTaskWoken )					\
+	if( sbTASK_MIGHT_BE_WAITING( ( pxStreamBuffer )->xTaskWaitingToSend ) )			\
 	{																					\
 	UBaseType_t uxSavedInterruptStatus;													\
 																						\
@@ -94,21 +120,25 @@ or #defined the notification macro away, them provide a default implementation
 that uses task notifications. */
 #ifndef sbSEND_COMPLETED
 	#define sbSEND_COMPLETED( pxStreamBuffer )											\
-		vTaskSuspendAll();																\
+		if( sbTASK_MIGHT_BE_WAITING( ( pxStreamBuffer )->xTaskWaitingToReceive ) )		\
 		{																				\
-			if( ( pxStreamBuffer )->xTaskWaitingToReceive != NULL )						\
+			vTaskSuspendAll();															\
 			{																			\
-				( void ) xTaskNotify( ( pxStreamBuffer )->xTaskWaitingToReceive,		\
-									  ( uint32_t ) 0,									\
-									  eNoAction );										\
-				( pxStreamBuffer )->xTaskWaitingToReceive = NULL;						\
+				if( ( pxStreamBuffer )->xTaskWaitingToReceive != NULL )					\
+				{																		\
+					( void ) xTaskNotify( ( pxStreamBuffer )->xTaskWaitingToReceive,	\
+										  ( uint32_t ) 0,								\
+										  eNoAction );									\
+					( pxStreamBuffer )->xTaskWaitingToReceive = NULL;					\
+				}																		\
 			}																			\
-		}																				\
-		( void ) xTaskResumeAll();
+			( void ) xTaskResumeAll();													\
+		}
 #endif /* sbSEND_COMPLETED */
 
 #ifndef sbSEND_COMPLETE_FROM_ISR
 	#define sbSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken )		\
+	if( sbTASK_MIGHT_BE_WAITING( ( pxStreamBuffer )->xTaskWaitingToReceive ) )			\
 	{																					\
 	UBaseType_t uxSavedInterruptStatus;													\
 																						\
@@ -202,6 +232,23 @@ static size_t prvReadBytesFromBuffer( StreamBuffer_t *pxStreamBuffer,
 									  size_t xMaxCount,
 									  size_t xBytesAvailable ) PRIVILEGED_FUNCTION;
 
+/*
+ * Used by the zero copy API functions to obtain the contiguous free region
+ * that starts at the head of the buffer, or the contiguous data region that
+ * starts at the tail of the buffer.  Both return the length of the region and
+ * set *ppucRegion to point to its start.
+ */
+static size_t prvGetWriteRegion( StreamBuffer_t * const pxStreamBuffer, uint8_t **ppucRegion ) PRIVILEGED_FUNCTION;
+static size_t prvGetReadRegion( const StreamBuffer_t * const pxStreamBuffer, uint8_t **ppucRegion ) PRIVILEGED_FUNCTION;
+
+/*
+ * Used by the zero copy API functions to move the head of the buffer past the
+ * bytes written in place, or the tail of the buffer past the bytes read in
+ * place.
+ */
+static void prvCommitWrite( StreamBuffer_t * const pxStreamBuffer, size_t xCount ) PRIVILEGED_FUNCTION;
+static void prvCommitRead( StreamBuffer_t * const pxStreamBuffer, size_t xCount ) PRIVILEGED_FUNCTION;
+
 /*
  * Called by both pxStreamBufferCreate() and pxStreamBufferCreateStatic() to
  * initialise the members of the newly created stream buffer structure.
@@ -532,6 +579,23 @@ TimeOut_t xTimeOut;
 		mtCOVERAGE_TEST_MARKER();
 	}
 
+	#if( configUSE_LOCK_FREE_STREAM_BUFFERS == 1 )
+	{
+		/* Only the writer reduces the free space, so if there is enough space
+		now there is no need for the critical section used to block. */
+		xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+
+		if( xSpace >= xRequiredSpace )
+		{
+			xTicksToWait = ( TickType_t ) 0;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configUSE_LOCK_FREE_STREAM_BUFFERS */
+
 	if( xTicksToWait != ( TickType_t ) 0 )
 	{
 		vTaskSetTimeOutState( &xTimeOut );
@@ -735,6 +799,21 @@ size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 		xBytesToStoreMessageLength = 0;
 	}
 
+	#if( configUSE_LOCK_FREE_STREAM_BUFFERS == 1 )
+	{
+		/* Only the reader removes data, so if data is available now there is
+		no need for the critical section used to block. */
+		if( prvBytesInBuffer( pxStreamBuffer ) > xBytesToStoreMessageLength )
+		{
+			xTicksToWait = ( TickType_t ) 0;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configUSE_LOCK_FREE_STREAM_BUFFERS */
+
 	if( xTicksToWait != ( TickType_t ) 0 )
 	{
 		/* Checking if there is data and clearing the notification state must be
@@ -915,6 +994,280 @@ size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 }
 /*-----------------------------------------------------------*/
 
+size_t xStreamBufferSendAcquire( StreamBufferHandle_t xStreamBuffer,
+								 void **ppvWriteRegion,
+								 TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+TimeOut_t xTimeOut;
+
+	configASSERT( ppvWriteRegion );
+	configASSERT( pxStreamBuffer );
+
+	/* Message buffers hold the length of each message in front of the
+	message, so cannot be written to in place. */
+	configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+	#if( configUSE_LOCK_FREE_STREAM_BUFFERS == 1 )
+	{
+		/* As per xStreamBufferSend(). */
+		if( xStreamBufferSpacesAvailable( pxStreamBuffer ) != ( size_t ) 0 )
+		{
+			xTicksToWait = ( TickType_t ) 0;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configUSE_LOCK_FREE_STREAM_BUFFERS */
+
+	if( xTicksToWait != ( TickType_t ) 0 )
+	{
+		vTaskSetTimeOutState( &xTimeOut );
+
+		do
+		{
+			/* Wait until at least one byte is free in the stream buffer. */
+			taskENTER_CRITICAL();
+			{
+				if( xStreamBufferSpacesAvailable( pxStreamBuffer ) == ( size_t ) 0 )
+				{
+					/* Clear notification state as going to wait for space. */
+					( void ) xTaskNotifyStateClear( NULL );
+
+					/* Should only be one writer. */
+					configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
+					pxStreamBuffer->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
+				}
+				else
+				{
+					taskEXIT_CRITICAL();
+					break;
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer );
+			( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+			pxStreamBuffer->xTaskWaitingToSend = NULL;
+
+		} while( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return prvGetWriteRegion( pxStreamBuffer, ( uint8_t ** ) ppvWriteRegion );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendAcquireFromISR( StreamBufferHandle_t xStreamBuffer,
+										void **ppvWriteRegion )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+	configASSERT( ppvWriteRegion );
+	configASSERT( pxStreamBuffer );
+	configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+	return prvGetWriteRegion( pxStreamBuffer, ( uint8_t ** ) ppvWriteRegion );
+}
+/*-----------------------------------------------------------*/
+
+void vStreamBufferSendCommit( StreamBufferHandle_t xStreamBuffer,
+							  size_t xBytesWritten )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+
+	if( xBytesWritten > ( size_t ) 0 )
+	{
+		prvCommitWrite( pxStreamBuffer, xBytesWritten );
+		traceSTREAM_BUFFER_SEND( xStreamBuffer, xBytesWritten );
+
+		/* Was a task waiting for the data? */
+		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+		{
+			sbSEND_COMPLETED( pxStreamBuffer );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vStreamBufferSendCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+									 size_t xBytesWritten,
+									 BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+
+	if( xBytesWritten > ( size_t ) 0 )
+	{
+		prvCommitWrite( pxStreamBuffer, xBytesWritten );
+
+		/* Was a task waiting for the data? */
+		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+		{
+			sbSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xBytesWritten );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveAcquire( StreamBufferHandle_t xStreamBuffer,
+									void **ppvReadRegion,
+									TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+size_t xBytesAvailable;
+
+	configASSERT( ppvReadRegion );
+	configASSERT( pxStreamBuffer );
+
+	/* Message buffers hold the length of each message in front of the
+	message, so cannot be read in place. */
+	configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+	#if( configUSE_LOCK_FREE_STREAM_BUFFERS == 1 )
+	{
+		/* As per xStreamBufferReceive(). */
+		if( prvBytesInBuffer( pxStreamBuffer ) != ( size_t ) 0 )
+		{
+			xTicksToWait = ( TickType_t ) 0;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configUSE_LOCK_FREE_STREAM_BUFFERS */
+
+	if( xTicksToWait != ( TickType_t ) 0 )
+	{
+		/* Checking if there is data and clearing the notification state must be
+		performed atomically. */
+		taskENTER_CRITICAL();
+		{
+			xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+			if( xBytesAvailable == ( size_t ) 0 )
+			{
+				/* Clear notification state as going to wait for data. */
+				( void ) xTaskNotifyStateClear( NULL );
+
+				/* Should only be one reader. */
+				configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
+				pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( xBytesAvailable == ( size_t ) 0 )
+		{
+			/* Wait for data to be available. */
+			traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer );
+			( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+			pxStreamBuffer->xTaskWaitingToReceive = NULL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return prvGetReadRegion( pxStreamBuffer, ( uint8_t ** ) ppvReadRegion );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveAcquireFromISR( StreamBufferHandle_t xStreamBuffer,
+										   void **ppvReadRegion )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+	configASSERT( ppvReadRegion );
+	configASSERT( pxStreamBuffer );
+	configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+	return prvGetReadRegion( pxStreamBuffer, ( uint8_t ** ) ppvReadRegion );
+}
+/*-----------------------------------------------------------*/
+
+void vStreamBufferReceiveCommit( StreamBufferHandle_t xStreamBuffer,
+								 size_t xBytesRead )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+
+	if( xBytesRead > ( size_t ) 0 )
+	{
+		prvCommitRead( pxStreamBuffer, xBytesRead );
+		traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xBytesRead );
+
+		/* Was a task waiting for space in the buffer? */
+		sbRECEIVE_COMPLETED( pxStreamBuffer );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vStreamBufferReceiveCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+										size_t xBytesRead,
+										BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+
+	if( xBytesRead > ( size_t ) 0 )
+	{
+		prvCommitRead( pxStreamBuffer, xBytesRead );
+
+		/* Was a task waiting for space in the buffer? */
+		sbRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xBytesRead );
+}
+/*-----------------------------------------------------------*/
+
 static size_t prvReadMessageFromBuffer( StreamBuffer_t *pxStreamBuffer,
 										void *pvRxData,
 										size_t xBufferLengthBytes,
@@ -1125,7 +1478,10 @@ size_t xNextHead, xFirstLength;
 		mtCOVERAGE_TEST_MARKER();
 	}
 
+	/* Make the data visible to the reader. */
+	sbINDEX_BARRIER();
 	pxStreamBuffer->xHead = xNextHead;
+	sbINDEX_BARRIER();
 
 	return xCount;
 }
@@ -1140,6 +1496,9 @@ size_t xCount, xFirstLength, xNextTail;
 
 	if( xCount > ( size_t ) 0 )
 	{
+		/* Do not read the data before the head index that made it available
+		was read. */
+		sbINDEX_BARRIER();
 		xNextTail = pxStreamBuffer->xTail;
 
 		/* Calculate the number of bytes that can be read - which may be
@@ -1175,7 +1534,11 @@ size_t xCount, xFirstLength, xNextTail;
 			xNextTail -= pxStreamBuffer->xLength;
 		}
 
+		/* Finish reading the data before the space it occupied is made
+		available to the writer. */
+		sbINDEX_BARRIER();
 		pxStreamBuffer->xTail = xNextTail;
+		sbINDEX_BARRIER();
 	}
 	else
 	{
@@ -1186,6 +1549,87 @@ size_t xCount, xFirstLength, xNextTail;
 }
 /*-----------------------------------------------------------*/
 
+static size_t prvGetWriteRegion( StreamBuffer_t * const pxStreamBuffer, uint8_t **ppucRegion )
+{
+size_t xSpace;
+const size_t xHead = pxStreamBuffer->xHead;
+
+	/* The free space starts at the head, and is contiguous up to the end of
+	the storage area at most. */
+	xSpace = configMIN( xStreamBufferSpacesAvailable( pxStreamBuffer ), pxStreamBuffer->xLength - xHead );
+	*ppucRegion = &( pxStreamBuffer->pucBuffer[ xHead ] );
+
+	return xSpace;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvGetReadRegion( const StreamBuffer_t * const pxStreamBuffer, uint8_t **ppucRegion )
+{
+size_t xCount;
+const size_t xTail = pxStreamBuffer->xTail;
+
+	/* The data starts at the tail, and is contiguous up to the end of the
+	storage area at most. */
+	xCount = configMIN( prvBytesInBuffer( pxStreamBuffer ), pxStreamBuffer->xLength - xTail );
+	*ppucRegion = &( pxStreamBuffer->pucBuffer[ xTail ] );
+
+	/* The caller must not read the data before the head index was read. */
+	sbINDEX_BARRIER();
+
+	return xCount;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCommitWrite( StreamBuffer_t * const pxStreamBuffer, size_t xCount )
+{
+size_t xNextHead = pxStreamBuffer->xHead;
+
+	/* Cannot commit more than was acquired - as there is only one writer the
+	free space can only have grown since it was acquired. */
+	configASSERT( xCount <= xStreamBufferSpacesAvailable( pxStreamBuffer ) );
+	configASSERT( ( xNextHead + xCount ) <= pxStreamBuffer->xLength );
+
+	xNextHead += xCount;
+	if( xNextHead >= pxStreamBuffer->xLength )
+	{
+		xNextHead -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	sbINDEX_BARRIER();
+	pxStreamBuffer->xHead = xNextHead;
+	sbINDEX_BARRIER();
+}
+/*-----------------------------------------------------------*/
+
+static void prvCommitRead( StreamBuffer_t * const pxStreamBuffer, size_t xCount )
+{
+size_t xNextTail = pxStreamBuffer->xTail;
+
+	/* Cannot commit more than was acquired - as there is only one reader the
+	data available can only have grown since it was acquired. */
+	configASSERT( xCount <= prvBytesInBuffer( pxStreamBuffer ) );
+	configASSERT( ( xNextTail + xCount ) <= pxStreamBuffer->xLength );
+
+	xNextTail += xCount;
+	if( xNextTail >= pxStreamBuffer->xLength )
+	{
+		xNextTail -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	sbINDEX_BARRIER();
+	pxStreamBuffer->xTail = xNextTail;
+	sbINDEX_BARRIER();
+}
+/*-----------------------------------------------------------*/
+
 static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer )
 {
 /* Returns the distance between xTail and xHead. */
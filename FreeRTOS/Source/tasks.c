@@ -39,6 +39,7 @@ task.h is included from an application file. */
 #include "task.h"
 #include "timers.h"
 #include "stack_macros.h"
+#include "object_pool.h"
 
 /* Lint e9021, e961 and e750 are suppressed as a MISRA exception justified
 because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
@@ -100,12 +101,22 @@ changed then the definition of StaticTask_t must also be updated. */
 /* If any of the following are set then task stacks are filled with a known
 value so the high water mark can be determined.  If none of the following are
 set then don't fill the stack so there is no unnecessary dependency on memset. */
-#if( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+#if( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) || ( configUSE_STACK_WATERMARK == 1 ) )
 	#define tskSET_NEW_STACKS_TO_KNOWN_VALUE	1
 #else
 	#define tskSET_NEW_STACKS_TO_KNOWN_VALUE	0
 #endif
 
+/* If either of the following are set then every task that has not been deleted
+is also held in xAllTasksList, in the order in which the tasks were created, so
+the tasks can be visited one at a time without searching the state lists.  If
+this is changed then the definition of StaticTask_t must also be updated. */
+#if( ( configUSE_TRACE_FACILITY == 1 ) || ( ( configUSE_STACK_WATERMARK == 1 ) && ( configSTACK_WATERMARK_SCAN_BYTES > 0 ) ) )
+	#define tskUSE_ALL_TASKS_LIST	1
+#else
+	#define tskUSE_ALL_TASKS_LIST	0
+#endif
+
 /*
  * Macros used by vListTask to indicate which state a task is in.
  */
@@ -210,6 +221,57 @@ configIDLE_TASK_NAME in FreeRTOSConfig.h. */
 
 /*-----------------------------------------------------------*/
 
+#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+
+	/* Records that tasks of priority uxPriority might be waiting on
+	pxEventList, using the same method as taskRECORD_READY_PRIORITY().  The
+	record is not updated when a task is removed from the event list, as tasks
+	can be removed by any code that removes the event list item of a task, so
+	prvGetHighestPriorityEventList() corrects it lazily instead. */
+	#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+
+		/* uxWaitingPriorities holds the highest priority that might have
+		waiting tasks. */
+		#define taskRECORD_EVENT_LIST_PRIORITY( uxPriority, pxEventList )								\
+		{																								\
+			if( ( uxPriority ) > ( pxEventList )->uxWaitingPriorities )									\
+			{																							\
+				( pxEventList )->uxWaitingPriorities = ( uxPriority );									\
+			}																							\
+		} /* taskRECORD_EVENT_LIST_PRIORITY */
+
+	#else
+
+		/* uxWaitingPriorities has a bit set for each priority that might have
+		waiting tasks. */
+		#define taskRECORD_EVENT_LIST_PRIORITY( uxPriority, pxEventList )	portRECORD_READY_PRIORITY( ( uxPriority ), ( pxEventList )->uxWaitingPriorities )
+
+	#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+
+#endif /* configUSE_PRIORITY_EVENT_LISTS */
+
+/*
+ * Place the task represented by pxTCB into the event list pxEventList, in
+ * priority order.  When configUSE_PRIORITY_EVENT_LISTS is 1 tasks of equal
+ * priority are woken in the order in which they blocked, as they are when the
+ * list is sorted by vListInsert().
+ */
+#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+
+	#define prvAddTaskToEventList( pxTCB, pxEventList )															\
+	{																											\
+		vListInsertEnd( &( ( pxEventList )->xWaitingTasks[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xEventListItem ) );	\
+		taskRECORD_EVENT_LIST_PRIORITY( ( pxTCB )->uxPriority, ( pxEventList ) );								\
+	}
+
+#else
+
+	#define prvAddTaskToEventList( pxTCB, pxEventList ) vListInsert( ( pxEventList ), &( ( pxTCB )->xEventListItem ) )
+
+#endif /* configUSE_PRIORITY_EVENT_LISTS */
+
+/*-----------------------------------------------------------*/
+
 /* pxDelayedTaskList and pxOverflowDelayedTaskList are switched when the tick
 count overflows. */
 #define taskSWITCH_DELAYED_LISTS()																	\
@@ -226,6 +288,18 @@ count overflows. */
 	prvResetNextTaskUnblockTime();																	\
 }
 
+/* The bucket of the task name registry that holds tasks with names that have
+the hash ulHash. */
+#define taskGET_NAME_REGISTRY_BUCKET( ulHash ) ( &( pxTaskNameRegistry[ ( ulHash ) & ( ( uint32_t ) configTASK_NAME_REGISTRY_SIZE - 1UL ) ] ) )
+
+/* When configUSE_DELAYED_TASK_WHEEL is 1 the delayed tasks are instead held in
+a two level wheel that is indexed by the tick count at which they are to be
+unblocked.  A revolution of the wheel is taskDELAYED_TASK_WHEEL_SIZE groups of
+taskDELAYED_TASK_WHEEL_SIZE ticks. */
+#define taskDELAYED_TASK_WHEEL_SIZE				( ( TickType_t ) configDELAYED_TASK_WHEEL_SIZE )
+#define taskDELAYED_TASK_WHEEL_MASK				( taskDELAYED_TASK_WHEEL_SIZE - ( TickType_t ) 1 )
+#define taskDELAYED_TASK_WHEEL_REVOLUTION_MASK	( ( TickType_t ) ( ( taskDELAYED_TASK_WHEEL_SIZE * taskDELAYED_TASK_WHEEL_SIZE ) - ( TickType_t ) 1 ) )
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -296,6 +370,11 @@ typedef struct tskTaskControlBlock 			/* The old naming convention is used to pr
 	#if ( configUSE_MUTEXES == 1 )
 		UBaseType_t		uxBasePriority;		/*< The priority last assigned to the task - used by the priority inheritance mechanism. */
 		UBaseType_t		uxMutexesHeld;
+
+		#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+			MutexLink_t	*pxMutexesHeld;		/*< The mutexes held by the task, most recently taken first. */
+			MutexLink_t	*pxWaitingForMutex;	/*< The mutex the task last blocked on.  Only valid while the task's event list item is in the mutex's list of waiting tasks. */
+		#endif
 	#endif
 
 	#if ( configUSE_APPLICATION_TASK_TAG == 1 )
@@ -307,7 +386,7 @@ typedef struct tskTaskControlBlock 			/* The old naming convention is used to pr
 	#endif
 
 	#if( configGENERATE_RUN_TIME_STATS == 1 )
-		uint32_t		ulRunTimeCounter;	/*< Stores the amount of time the task has spent in the Running state. */
+		configRUN_TIME_COUNTER_TYPE	ulRunTimeCounter;	/*< Stores the amount of time the task has spent in the Running state. */
 	#endif
 
 	#if ( configUSE_NEWLIB_REENTRANT == 1 )
@@ -322,8 +401,8 @@ typedef struct tskTaskControlBlock 			/* The old naming convention is used to pr
 	#endif
 
 	#if( configUSE_TASK_NOTIFICATIONS == 1 )
-		volatile uint32_t ulNotifiedValue;
-		volatile uint8_t ucNotifyState;
+		volatile uint32_t ulNotifiedValue[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+		volatile uint8_t ucNotifyState[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
 	#endif
 
 	/* See the comments above the definition of
@@ -340,6 +419,21 @@ typedef struct tskTaskControlBlock 			/* The old naming convention is used to pr
 		int iTaskErrno;
 	#endif
 
+	#if( configUSE_TASK_NAME_REGISTRY == 1 )
+		struct tskTaskControlBlock *pxNextInNameRegistry; /*< The next task in the same bucket of the task name registry. */
+		uint32_t		ulNameHash;			/*< The hash of pcTaskName, which selects the registry bucket and avoids comparing names that cannot match. */
+	#endif
+
+	#if( configUSE_STACK_WATERMARK == 1 )
+		StackType_t		*pxStackWatermark;	/*< The deepest saved stack pointer seen when the task was switched out. */
+		configSTACK_DEPTH_TYPE uxStackHighWaterMark; /*< The minimum free stack space, in words, found by the last complete background scan of the stack. */
+	#endif
+
+	#if( tskUSE_ALL_TASKS_LIST == 1 )
+		ListItem_t		xAllTasksListItem;	/*< Used to reference a task from xAllTasksList. */
+		uint32_t		ulAllTasksListSequence;	/*< The sequence number the task was given when it was added to xAllTasksList.  Held separately from the list item value as a TickType_t can be only 16 bits. */
+	#endif
+
 } tskTCB;
 
 /* The old tskTCB name is maintained above then typedefed to the new TCB_t name
@@ -348,17 +442,28 @@ typedef tskTCB TCB_t;
 
 /*lint -save -e956 A manual analysis and inspection has been used to determine
 which static variables must be declared volatile. */
-PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
+PRIVILEGED_DATA configCURRENT_TCB_PLACEMENT TCB_t * volatile pxCurrentTCB = NULL;
 
 /* Lists for ready and blocked tasks. --------------------
 xDelayedTaskList1 and xDelayedTaskList2 could be move to function scople but
 doing so breaks some kernel aware debuggers and debuggers that rely on removing
 the static qualifier. */
-PRIVILEGED_DATA static List_t pxReadyTasksLists[ configMAX_PRIORITIES ];/*< Prioritised ready tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList1;						/*< Delayed tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList2;						/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
-PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;				/*< Points to the delayed task list currently being used. */
-PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;		/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+PRIVILEGED_DATA configREADY_LISTS_PLACEMENT static List_t pxReadyTasksLists[ configMAX_PRIORITIES ];/*< Prioritised ready tasks. */
+#if( configUSE_DELAYED_TASK_WHEEL == 0 )
+	PRIVILEGED_DATA configDELAYED_LISTS_PLACEMENT static List_t xDelayedTaskList1;						/*< Delayed tasks. */
+	PRIVILEGED_DATA configDELAYED_LISTS_PLACEMENT static List_t xDelayedTaskList2;						/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
+	PRIVILEGED_DATA configDELAYED_LISTS_PLACEMENT static List_t * volatile pxDelayedTaskList;				/*< Points to the delayed task list currently being used. */
+	PRIVILEGED_DATA configDELAYED_LISTS_PLACEMENT static List_t * volatile pxOverflowDelayedTaskList;		/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+#else
+	/* The first level of the delayed task wheel holds the tasks that are due
+	later in the same group as the tick count, by wake time.  The second level
+	holds the tasks that are due in later groups of the same revolution, by
+	group.  All other delayed tasks are held in the overflow list.  The lists
+	are not sorted. */
+	PRIVILEGED_DATA configDELAYED_LISTS_PLACEMENT static List_t xDelayedTaskWheelLevel0[ configDELAYED_TASK_WHEEL_SIZE ];
+	PRIVILEGED_DATA configDELAYED_LISTS_PLACEMENT static List_t xDelayedTaskWheelLevel1[ configDELAYED_TASK_WHEEL_SIZE ];
+	PRIVILEGED_DATA configDELAYED_LISTS_PLACEMENT static List_t xDelayedTaskWheelOverflowList;
+#endif
 PRIVILEGED_DATA static List_t xPendingReadyList;						/*< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 
 #if( INCLUDE_vTaskDelete == 1 )
@@ -374,6 +479,14 @@ PRIVILEGED_DATA static List_t xPendingReadyList;						/*< Tasks that have been r
 
 #endif
 
+#if ( tskUSE_ALL_TASKS_LIST == 1 )
+
+	PRIVILEGED_DATA static List_t xAllTasksList;						/*< Tasks that have not been deleted, in the order in which they were created. */
+	PRIVILEGED_DATA static uint32_t ulAllTasksListSequence = 0UL;		/*< The sequence number given to the next task added to xAllTasksList. */
+	PRIVILEGED_DATA static UBaseType_t uxAllTasksListDeletions = ( UBaseType_t ) 0U;	/*< Incremented each time a task is removed from xAllTasksList, so a pointer to a task held between calls is known to still be valid if this has not changed. */
+
+#endif
+
 /* Global POSIX errno. Its value is changed upon context switching to match
 the errno of the currently running task. */
 #if ( configUSE_POSIX_ERRNO == 1 )
@@ -382,14 +495,14 @@ the errno of the currently running task. */
 
 /* Other file private variables. --------------------------------*/
 PRIVILEGED_DATA static volatile UBaseType_t uxCurrentNumberOfTasks 	= ( UBaseType_t ) 0U;
-PRIVILEGED_DATA static volatile TickType_t xTickCount 				= ( TickType_t ) configINITIAL_TICK_COUNT;
-PRIVILEGED_DATA static volatile UBaseType_t uxTopReadyPriority 		= tskIDLE_PRIORITY;
+PRIVILEGED_DATA configTICK_COUNT_PLACEMENT static volatile TickType_t xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
+PRIVILEGED_DATA configREADY_LISTS_PLACEMENT static volatile UBaseType_t uxTopReadyPriority = tskIDLE_PRIORITY;
 PRIVILEGED_DATA static volatile BaseType_t xSchedulerRunning 		= pdFALSE;
 PRIVILEGED_DATA static volatile UBaseType_t uxPendedTicks 			= ( UBaseType_t ) 0U;
 PRIVILEGED_DATA static volatile BaseType_t xYieldPending 			= pdFALSE;
 PRIVILEGED_DATA static volatile BaseType_t xNumOfOverflows 			= ( BaseType_t ) 0;
 PRIVILEGED_DATA static UBaseType_t uxTaskNumber 					= ( UBaseType_t ) 0U;
-PRIVILEGED_DATA static volatile TickType_t xNextTaskUnblockTime		= ( TickType_t ) 0U; /* Initialised to portMAX_DELAY before the scheduler starts. */
+PRIVILEGED_DATA configDELAYED_LISTS_PLACEMENT static volatile TickType_t xNextTaskUnblockTime = ( TickType_t ) 0U; /* Initialised to portMAX_DELAY before the scheduler starts. */
 PRIVILEGED_DATA static TaskHandle_t xIdleTaskHandle					= NULL;			/*< Holds the handle of the idle task.  The idle task is created automatically when the scheduler is started. */
 
 /* Context switches are held pending while the scheduler is suspended.  Also,
@@ -402,15 +515,61 @@ when the scheduler is unsuspended.  The pending ready list itself can only be
 accessed from a critical section. */
 PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended	= ( UBaseType_t ) pdFALSE;
 
+#if ( configUSE_TASK_NAME_REGISTRY == 1 )
+
+	/* Tasks that have not been deleted, chained together in the bucket selected
+	by the low bits of the hash of their names, so xTaskGetHandle() only has to
+	compare the names of the tasks in one bucket. */
+	PRIVILEGED_DATA static TCB_t *pxTaskNameRegistry[ configTASK_NAME_REGISTRY_SIZE ];
+
+#endif
+
+#if ( ( configUSE_STACK_WATERMARK == 1 ) && ( configSTACK_WATERMARK_SCAN_BYTES > 0 ) )
+
+	/* The idle task scans the stacks of the tasks in turn, a few bytes on each
+	iteration.  pxStackScanTCB is the task being scanned, or NULL if the next
+	task to scan has not been selected, and is cleared if the task is deleted.
+	pxLastStackScanTCB is the task scanned most recently, after which the next
+	task is selected from xAllTasksList.  If that task is deleted it is replaced
+	by the task before it in xAllTasksList, or NULL if there is no such task. */
+	PRIVILEGED_DATA static TCB_t * volatile pxStackScanTCB = NULL;
+	PRIVILEGED_DATA static const TCB_t *pxLastStackScanTCB = NULL;
+	PRIVILEGED_DATA static const uint8_t *pucStackScanByte = NULL;
+	PRIVILEGED_DATA static uint32_t ulStackScanFreeBytes = 0UL;
+
+#endif
+
 #if ( configGENERATE_RUN_TIME_STATS == 1 )
 
 	/* Do not move these variables to function scope as doing so prevents the
 	code working with debuggers that need to remove the static qualifier. */
-	PRIVILEGED_DATA static uint32_t ulTaskSwitchedInTime = 0UL;	/*< Holds the value of a timer/counter the last time a task was switched in. */
-	PRIVILEGED_DATA static uint32_t ulTotalRunTime = 0UL;		/*< Holds the total amount of execution time as defined by the run time counter clock. */
+	PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulTaskSwitchedInTime = 0UL;	/*< Holds the value of a timer/counter the last time a task was switched in. */
+	PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulTotalRunTime = 0UL;		/*< Holds the total amount of execution time as defined by the run time counter clock. */
 
 #endif
 
+/* Tasks that are created dynamically take their TCB from a pool, rather than
+the heap, when configTASK_POOL_SIZE is not 0, and take their stack from a pool
+when configTASK_STACK_POOL_SIZE is not 0 and the stack is no deeper than
+configTASK_STACK_POOL_DEPTH. */
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configTASK_POOL_SIZE > 0 ) )
+	objectpoolDEFINE_POOL( xTCBPool, ucTCBPoolStorage, sizeof( TCB_t ), configTASK_POOL_SIZE );
+	#define tskMALLOC_TCB()				( ( TCB_t * ) pvObjectPoolMalloc( &xTCBPool, sizeof( TCB_t ) ) )
+	#define tskFREE_TCB( pxTCB )		vObjectPoolFree( &xTCBPool, ( pxTCB ) )
+#else
+	#define tskMALLOC_TCB()				( ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) ) )
+	#define tskFREE_TCB( pxTCB )		vPortFree( pxTCB )
+#endif /* configTASK_POOL_SIZE */
+
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configTASK_STACK_POOL_SIZE > 0 ) )
+	objectpoolDEFINE_POOL( xStackPool, ucStackPoolStorage, configTASK_STACK_POOL_DEPTH * sizeof( StackType_t ), configTASK_STACK_POOL_SIZE );
+	#define tskMALLOC_STACK( xSize )	pvObjectPoolMalloc( &xStackPool, ( xSize ) )
+	#define tskFREE_STACK( pxStack )	vObjectPoolFree( &xStackPool, ( pxStack ) )
+#else
+	#define tskMALLOC_STACK( xSize )	pvPortMalloc( xSize )
+	#define tskFREE_STACK( pxStack )	vPortFree( pxStack )
+#endif /* configTASK_STACK_POOL_SIZE */
+
 /*lint -restore */
 
 /*-----------------------------------------------------------*/
@@ -510,12 +669,28 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait, const BaseT
  * Searches pxList for a task with name pcNameToQuery - returning a handle to
  * the task if it is found, or NULL if the task is not found.
  */
-#if ( INCLUDE_xTaskGetHandle == 1 )
+#if ( ( INCLUDE_xTaskGetHandle == 1 ) && ( configUSE_TASK_NAME_REGISTRY == 0 ) )
 
 	static TCB_t *prvSearchForNameWithinSingleList( List_t *pxList, const char pcNameToQuery[] ) PRIVILEGED_FUNCTION;
 
 #endif
 
+#if ( configUSE_TASK_NAME_REGISTRY == 1 )
+
+	/*
+	 * Returns the hash of a task name, considering at most the first
+	 * configMAX_TASK_NAME_LEN characters.
+	 */
+	static uint32_t prvHashTaskName( const char *pcName ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+	/*
+	 * Remove a task that is being deleted from the task name registry.  Must
+	 * be called from a critical section.
+	 */
+	static void prvRemoveTaskFromNameRegistry( const TCB_t *pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * When a task is created, the stack of the task is filled with a known value.
  * This function determines the 'high water mark' of the task stack by
@@ -548,6 +723,100 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait, const BaseT
  */
 static void prvResetNextTaskUnblockTime( void );
 
+#if( ( configUSE_STACK_WATERMARK == 1 ) && ( configSTACK_WATERMARK_SCAN_BYTES > 0 ) )
+
+	/*
+	 * Called by the idle task to examine the next configSTACK_WATERMARK_SCAN_BYTES
+	 * bytes of the stack being scanned, selecting the next task to scan first if
+	 * necessary.  When the end of the unused part of the stack is found the free
+	 * space is recorded in the task's TCB.
+	 */
+	static void prvScanStackHighWaterMark( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if( configUSE_TRACE_FACILITY == 1 )
+
+	/*
+	 * Used by xTaskStatusIteratorNext() to find its place in xAllTasksList
+	 * again after a task has been deleted, as the task it reported last may
+	 * have been freed.  Returns the item of the first task in xAllTasksList
+	 * that was created after the task with sequence number ulSequence, or the
+	 * end marker of xAllTasksList if there is no such task.  Must be called with
+	 * the scheduler suspended.
+	 */
+	static const ListItem_t *prvGetAllTasksListItemAfter( uint32_t ulSequence ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Called by xTaskResumeAll() to process, in one pass, the ticks that occurred
+ * while the scheduler was suspended.  Each delayed task that is due is moved
+ * to its ready list, but the tick hook is not called.  Returns pdTRUE if a
+ * context switch should be performed.
+ */
+static BaseType_t prvCatchUpPendedTicks( TickType_t xTicksToCatchUp ) PRIVILEGED_FUNCTION;
+
+/*
+ * Remove a task whose block time has expired from the delayed list, and from
+ * any event list it is also in, and place it in its ready list.
+ */
+static void prvMoveDelayedTaskToReadyList( TCB_t *pxTCB ) PRIVILEGED_FUNCTION;
+
+#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+	/*
+	 * Place the calling task in the delayed task wheel to be unblocked at
+	 * xTimeToWake.
+	 */
+	static void prvAddCurrentTaskToDelayedTaskWheel( TickType_t xTimeToWake, const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Return the list in the level of the delayed task wheel that matches how
+	 * far xTimeToWake is from xWheelTime, and set *pxEventTime to the time at
+	 * which the wheel will next have to handle a task in that list, either
+	 * because it is due or because it must move to a lower level.
+	 */
+	static List_t * prvGetDelayedTaskWheelList( const TickType_t xTimeToWake, const TickType_t xWheelTime, TickType_t * const pxEventTime ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Move each task that is in pxList to the list of the delayed task wheel
+	 * that it belongs in now the wheel has turned to xWheelTime.
+	 */
+	static void prvCascadeDelayedTaskList( List_t * const pxList, const TickType_t xWheelTime ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Turn the delayed task wheel to xWheelTime, moving tasks down from the
+	 * higher levels if a group starts at xWheelTime, then moving every task
+	 * that is due to the ready lists.  Returns pdTRUE and raises
+	 * *puxHighestReadiedPriority to the priority of the highest priority task
+	 * unblocked if any task was unblocked, otherwise returns pdFALSE.
+	 */
+	static BaseType_t prvTurnDelayedTaskWheel( const TickType_t xWheelTime, UBaseType_t * const puxHighestReadiedPriority ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * If the delayed task wheel, which has been turned to xWheelTime, must next
+	 * be turned within xMaxTicksAhead ticks then set *pxNextEventTime to the
+	 * time at which it must be turned and return pdTRUE.  Otherwise return
+	 * pdFALSE.
+	 */
+	static BaseType_t prvGetNextDelayedTaskWheelEvent( const TickType_t xWheelTime, const TickType_t xMaxTicksAhead, TickType_t * const pxNextEventTime ) PRIVILEGED_FUNCTION;
+
+	#if( configUSE_TICKLESS_IDLE != 0 )
+
+		/*
+		 * When the delayed task wheel is used xNextTaskUnblockTime is only a
+		 * lower bound, and is held equal to the tick count when it needs to be
+		 * recalculated.  This function searches the wheel for the next time at
+		 * which it must be turned, and must only be called with the scheduler
+		 * suspended.
+		 */
+		static TickType_t prvGetNextTaskUnblockTimeFromWheel( void ) PRIVILEGED_FUNCTION;
+
+	#endif
+
+#endif
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
 
 	/*
@@ -558,6 +827,17 @@ static void prvResetNextTaskUnblockTime( void );
 
 #endif
 
+#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	/*
+	 * Helper function used to write a run time counter value in decimal when
+	 * printing out the run time stats table, whatever the width of
+	 * configRUN_TIME_COUNTER_TYPE.
+	 */
+	static char *prvWriteRunTimeCounterToBuffer( char *pcBuffer, configRUN_TIME_COUNTER_TYPE ulValue ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * Called after a Task_t structure has been allocated either statically or
  * dynamically to fill in the structure's members.
@@ -577,6 +857,48 @@ static void prvInitialiseNewTask( 	TaskFunction_t pxTaskCode,
  */
 static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 
+/*
+ * Returns the list in pxEventList that holds the highest priority waiting
+ * tasks, or NULL if no tasks are waiting.  Lists recorded as possibly holding
+ * tasks that are found to be empty are removed from the record.
+ */
+#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+
+	static List_t *prvGetHighestPriorityEventList( EventList_t * const pxEventList ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Support for transitive priority inheritance.  prvRemoveHeldMutex() removes
+ * pxMutex from the list of mutexes held by pxTCB.  prvGetMutexWaitedFor() returns
+ * the mutex on which pxTCB is blocked, or NULL if pxTCB is not blocked on a
+ * mutex.  prvGetInheritedPriority() returns the priority pxTCB should run at -
+ * the higher of its base priority and the priority of the highest priority
+ * task waiting for any mutex it holds.  prvSetInheritedPriority() changes the
+ * priority of pxTCB, moving it within its ready list or within the list of
+ * tasks waiting for the mutex on which it is blocked as necessary.
+ */
+#if( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+
+	static void prvRemoveHeldMutex( TCB_t * const pxTCB, const MutexLink_t * const pxMutex ) PRIVILEGED_FUNCTION;
+	static MutexLink_t *prvGetMutexWaitedFor( const TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+	static UBaseType_t prvGetInheritedPriority( const TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+	static void prvSetInheritedPriority( TCB_t * const pxTCB, const UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Returns the amount of time pxTCB has spent in the Running state, including
+ * the time since it was last switched in if it is the running task, and sets
+ * *pulTotalRunTime to the current run time counter value.  Must be called from
+ * a critical section.
+ */
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+	static configRUN_TIME_COUNTER_TYPE prvGetTaskRunTime( const TCB_t *pxTCB, configRUN_TIME_COUNTER_TYPE *pulTotalRunTime ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * freertos_tasks_c_additions_init() should only be called if the user definable
  * macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is the only macro
@@ -707,7 +1029,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 			/* Allocate space for the TCB.  Where the memory comes from depends
 			on the implementation of the port malloc function and whether or
 			not static allocation is being used. */
-			pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+			pxNewTCB = tskMALLOC_TCB();
 
 			if( pxNewTCB != NULL )
 			{
@@ -762,19 +1084,19 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 			/* Allocate space for the TCB.  Where the memory comes from depends on
 			the implementation of the port malloc function and whether or not static
 			allocation is being used. */
-			pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+			pxNewTCB = tskMALLOC_TCB();
 
 			if( pxNewTCB != NULL )
 			{
 				/* Allocate space for the stack used by the task being created.
 				The base of the stack memory stored in the TCB so the task can
 				be deleted later if required. */
-				pxNewTCB->pxStack = ( StackType_t * ) pvPortMalloc( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+				pxNewTCB->pxStack = ( StackType_t * ) tskMALLOC_STACK( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 
 				if( pxNewTCB->pxStack == NULL )
 				{
 					/* Could not allocate the stack.  Delete the allocated TCB. */
-					vPortFree( pxNewTCB );
+					tskFREE_TCB( pxNewTCB );
 					pxNewTCB = NULL;
 				}
 			}
@@ -784,12 +1106,12 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 		StackType_t *pxStack;
 
 			/* Allocate space for the stack used by the task being created. */
-			pxStack = pvPortMalloc( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation is the stack. */
+			pxStack = tskMALLOC_STACK( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation is the stack. */
 
 			if( pxStack != NULL )
 			{
 				/* Allocate space for the TCB. */
-				pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of TCB_t is always a pointer to the task's stack. */
+				pxNewTCB = tskMALLOC_TCB(); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of TCB_t is always a pointer to the task's stack. */
 
 				if( pxNewTCB != NULL )
 				{
@@ -800,7 +1122,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 				{
 					/* The stack cannot be used as the TCB was not created.  Free
 					it again. */
-					vPortFree( pxStack );
+					tskFREE_STACK( pxStack );
 				}
 			}
 			else
@@ -933,6 +1255,15 @@ UBaseType_t x;
 		pxNewTCB->pcTaskName[ 0 ] = 0x00;
 	}
 
+	#if ( configUSE_TASK_NAME_REGISTRY == 1 )
+	{
+		/* The task is added to the registry when it is added to the ready
+		list. */
+		pxNewTCB->ulNameHash = prvHashTaskName( pxNewTCB->pcTaskName );
+		pxNewTCB->pxNextInNameRegistry = NULL;
+	}
+	#endif /* configUSE_TASK_NAME_REGISTRY */
+
 	/* This is used as an array index so must ensure it's not too large.  First
 	remove the privilege bit if one is present. */
 	if( uxPriority >= ( UBaseType_t ) configMAX_PRIORITIES )
@@ -949,6 +1280,13 @@ UBaseType_t x;
 	{
 		pxNewTCB->uxBasePriority = uxPriority;
 		pxNewTCB->uxMutexesHeld = 0;
+
+		#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+		{
+			pxNewTCB->pxMutexesHeld = NULL;
+			pxNewTCB->pxWaitingForMutex = NULL;
+		}
+		#endif
 	}
 	#endif /* configUSE_MUTEXES */
 
@@ -1003,8 +1341,11 @@ UBaseType_t x;
 
 	#if ( configUSE_TASK_NOTIFICATIONS == 1 )
 	{
-		pxNewTCB->ulNotifiedValue = 0;
-		pxNewTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+		for( x = 0; x < ( UBaseType_t ) configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
+		{
+			pxNewTCB->ulNotifiedValue[ x ] = 0;
+			pxNewTCB->ucNotifyState[ x ] = taskNOT_WAITING_NOTIFICATION;
+		}
 	}
 	#endif
 
@@ -1035,6 +1376,15 @@ UBaseType_t x;
 	}
 	#endif /* portUSING_MPU_WRAPPERS */
 
+	#if ( configUSE_STACK_WATERMARK == 1 )
+	{
+		/* The stack has not been scanned yet, so the high water mark is the
+		whole stack until it has. */
+		pxNewTCB->pxStackWatermark = ( StackType_t * ) pxNewTCB->pxTopOfStack;
+		pxNewTCB->uxStackHighWaterMark = ( configSTACK_DEPTH_TYPE ) ulStackDepth;
+	}
+	#endif /* configUSE_STACK_WATERMARK */
+
 	if( pxCreatedTask != NULL )
 	{
 		/* Pass the handle out in an anonymous way.  The handle can be used to
@@ -1103,6 +1453,29 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 			pxNewTCB->uxTCBNumber = uxTaskNumber;
 		}
 		#endif /* configUSE_TRACE_FACILITY */
+
+		#if ( configUSE_TASK_NAME_REGISTRY == 1 )
+		{
+		TCB_t ** const ppxBucket = taskGET_NAME_REGISTRY_BUCKET( pxNewTCB->ulNameHash );
+
+			/* Add the task to the head of the registry bucket for its name. */
+			pxNewTCB->pxNextInNameRegistry = *ppxBucket;
+			*ppxBucket = pxNewTCB;
+		}
+		#endif /* configUSE_TASK_NAME_REGISTRY */
+
+		#if ( tskUSE_ALL_TASKS_LIST == 1 )
+		{
+			/* Tasks are added to the end of the list, so the list remains in
+			the order of the sequence numbers. */
+			vListInitialiseItem( &( pxNewTCB->xAllTasksListItem ) );
+			listSET_LIST_ITEM_OWNER( &( pxNewTCB->xAllTasksListItem ), pxNewTCB );
+			pxNewTCB->ulAllTasksListSequence = ulAllTasksListSequence;
+			ulAllTasksListSequence++;
+			vListInsertEnd( &xAllTasksList, &( pxNewTCB->xAllTasksListItem ) );
+		}
+		#endif /* tskUSE_ALL_TASKS_LIST */
+
 		traceTASK_CREATE( pxNewTCB );
 
 		prvAddTaskToReadyList( pxNewTCB );
@@ -1163,6 +1536,57 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				mtCOVERAGE_TEST_MARKER();
 			}
 
+			/* The deleted task can no longer be found by name. */
+			#if ( configUSE_TASK_NAME_REGISTRY == 1 )
+			{
+				prvRemoveTaskFromNameRegistry( pxTCB );
+			}
+			#endif /* configUSE_TASK_NAME_REGISTRY */
+
+			/* Stop the idle task scanning the stack of the deleted task, as
+			the stack may be freed before the scan completes. */
+			#if ( ( configUSE_STACK_WATERMARK == 1 ) && ( configSTACK_WATERMARK_SCAN_BYTES > 0 ) )
+			{
+				if( pxTCB == pxStackScanTCB )
+				{
+					pxStackScanTCB = NULL;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* ( configUSE_STACK_WATERMARK == 1 ) && ( configSTACK_WATERMARK_SCAN_BYTES > 0 ) */
+
+			#if ( tskUSE_ALL_TASKS_LIST == 1 )
+			{
+				#if ( ( configUSE_STACK_WATERMARK == 1 ) && ( configSTACK_WATERMARK_SCAN_BYTES > 0 ) )
+				{
+					/* The next task to scan is selected from the task scanned
+					last, so step back to the task before the deleted task. */
+					if( pxTCB == pxLastStackScanTCB )
+					{
+						if( pxTCB->xAllTasksListItem.pxPrevious == listGET_END_MARKER( &xAllTasksList ) )
+						{
+							pxLastStackScanTCB = NULL;
+						}
+						else
+						{
+							pxLastStackScanTCB = listGET_LIST_ITEM_OWNER( pxTCB->xAllTasksListItem.pxPrevious ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif
+
+				( void ) uxListRemove( &( pxTCB->xAllTasksListItem ) );
+				uxAllTasksListDeletions++;
+			}
+			#endif /* tskUSE_ALL_TASKS_LIST */
+
 			/* Increment the uxTaskNumber also so kernel aware debuggers can
 			detect that the task lists need re-generating.  This is done before
 			portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
@@ -1357,9 +1781,13 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 	eTaskState eTaskGetState( TaskHandle_t xTask )
 	{
 	eTaskState eReturn;
-	List_t const * pxStateList, *pxDelayedList, *pxOverflowedDelayedList;
+	List_t const * pxStateList;
 	const TCB_t * const pxTCB = xTask;
 
+		#if( configUSE_DELAYED_TASK_WHEEL == 0 )
+			List_t const * pxDelayedList, *pxOverflowedDelayedList;
+		#endif
+
 		configASSERT( pxTCB );
 
 		if( pxTCB == pxCurrentTCB )
@@ -1372,12 +1800,24 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 			taskENTER_CRITICAL();
 			{
 				pxStateList = listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) );
-				pxDelayedList = pxDelayedTaskList;
-				pxOverflowedDelayedList = pxOverflowDelayedTaskList;
+
+				#if( configUSE_DELAYED_TASK_WHEEL == 0 )
+				{
+					pxDelayedList = pxDelayedTaskList;
+					pxOverflowedDelayedList = pxOverflowDelayedTaskList;
+				}
+				#endif
 			}
 			taskEXIT_CRITICAL();
 
-			if( ( pxStateList == pxDelayedList ) || ( pxStateList == pxOverflowedDelayedList ) )
+			#if( configUSE_DELAYED_TASK_WHEEL == 0 )
+				if( ( pxStateList == pxDelayedList ) || ( pxStateList == pxOverflowedDelayedList ) )
+			#else
+				/* Every list of the delayed task wheel is a Blocked list. */
+				if( ( ( pxStateList >= &( xDelayedTaskWheelLevel0[ 0 ] ) ) && ( pxStateList < &( xDelayedTaskWheelLevel0[ configDELAYED_TASK_WHEEL_SIZE ] ) ) ) ||
+					( ( pxStateList >= &( xDelayedTaskWheelLevel1[ 0 ] ) ) && ( pxStateList < &( xDelayedTaskWheelLevel1[ configDELAYED_TASK_WHEEL_SIZE ] ) ) ) ||
+					( pxStateList == &xDelayedTaskWheelOverflowList ) )
+			#endif
 			{
 				/* The task being queried is referenced from one of the Blocked
 				lists. */
@@ -1394,17 +1834,21 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 					{
 						#if( configUSE_TASK_NOTIFICATIONS == 1 )
 						{
+						BaseType_t x;
+
 							/* The task does not appear on the event list item of
 							and of the RTOS objects, but could still be in the
-							blocked state if it is waiting on its notification
-							rather than waiting on an object. */
-							if( pxTCB->ucNotifyState == taskWAITING_NOTIFICATION )
-							{
-								eReturn = eBlocked;
-							}
-							else
+							blocked state if it is waiting on one of its
+							notifications rather than waiting on an object. */
+							eReturn = eSuspended;
+
+							for( x = 0; x < ( BaseType_t ) configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
 							{
-								eReturn = eSuspended;
+								if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
+								{
+									eReturn = eBlocked;
+									break;
+								}
 							}
 						}
 						#else
@@ -1709,11 +2153,16 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 
 			#if( configUSE_TASK_NOTIFICATIONS == 1 )
 			{
-				if( pxTCB->ucNotifyState == taskWAITING_NOTIFICATION )
+			BaseType_t x;
+
+				for( x = 0; x < ( BaseType_t ) configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
 				{
-					/* The task was blocked to wait for a notification, but is
-					now suspended, so no notification was received. */
-					pxTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+					if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
+					{
+						/* The task was blocked to wait for a notification, but is
+						now suspended, so no notification was received. */
+						pxTCB->ucNotifyState[ x ] = taskNOT_WAITING_NOTIFICATION;
+					}
 				}
 			}
 			#endif
@@ -2140,7 +2589,35 @@ void vTaskSuspendAll( void )
 		}
 		else
 		{
-			xReturn = xNextTaskUnblockTime - xTickCount;
+			#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+			{
+				/* xNextTaskUnblockTime is held equal to the tick count when it
+				has to be recalculated from the delayed task wheel.  That can
+				only be done with the scheduler suspended - if it is not then
+				report just enough idle time for the idle task to suspend the
+				scheduler and call this function again. */
+				if( xNextTaskUnblockTime == xTickCount )
+				{
+					if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
+					{
+						xNextTaskUnblockTime = prvGetNextTaskUnblockTimeFromWheel();
+						xReturn = xNextTaskUnblockTime - xTickCount;
+					}
+					else
+					{
+						xReturn = configEXPECTED_IDLE_TIME_BEFORE_SLEEP;
+					}
+				}
+				else
+				{
+					xReturn = xNextTaskUnblockTime - xTickCount;
+				}
+			}
+			#else
+			{
+				xReturn = xNextTaskUnblockTime - xTickCount;
+			}
+			#endif
 		}
 
 		return xReturn;
@@ -2152,6 +2629,7 @@ void vTaskSuspendAll( void )
 BaseType_t xTaskResumeAll( void )
 {
 TCB_t *pxTCB = NULL;
+UBaseType_t uxHighestReadiedPriority = tskIDLE_PRIORITY;
 BaseType_t xAlreadyYielded = pdFALSE;
 
 	/* If uxSchedulerSuspended is zero then this function does not match a
@@ -2172,7 +2650,9 @@ BaseType_t xAlreadyYielded = pdFALSE;
 			if( uxCurrentNumberOfTasks > ( UBaseType_t ) 0U )
 			{
 				/* Move any readied tasks from the pending list into the
-				appropriate ready list. */
+				appropriate ready list.  Only the highest priority of the moved
+				tasks is needed to decide if a yield must be performed, so the
+				decision is made once all the tasks have been moved. */
 				while( listLIST_IS_EMPTY( &xPendingReadyList ) == pdFALSE )
 				{
 					pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xPendingReadyList ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
@@ -2180,11 +2660,9 @@ BaseType_t xAlreadyYielded = pdFALSE;
 					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
 					prvAddTaskToReadyList( pxTCB );
 
-					/* If the moved task has a priority higher than the current
-					task then a yield must be performed. */
-					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+					if( pxTCB->uxPriority > uxHighestReadiedPriority )
 					{
-						xYieldPending = pdTRUE;
+						uxHighestReadiedPriority = pxTCB->uxPriority;
 					}
 					else
 					{
@@ -2194,6 +2672,17 @@ BaseType_t xAlreadyYielded = pdFALSE;
 
 				if( pxTCB != NULL )
 				{
+					/* If a moved task has a priority equal to or higher than
+					the current task then a yield must be performed. */
+					if( uxHighestReadiedPriority >= pxCurrentTCB->uxPriority )
+					{
+						xYieldPending = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
 					/* A task was unblocked while the scheduler was suspended,
 					which may have prevented the next unblock time from being
 					re-calculated, in which case re-calculate it now.  Mainly
@@ -2206,24 +2695,23 @@ BaseType_t xAlreadyYielded = pdFALSE;
 				/* If any ticks occurred while the scheduler was suspended then
 				they should be processed now.  This ensures the tick count does
 				not	slip, and that any delayed tasks are resumed at the correct
-				time. */
+				time.  The ticks are processed together, rather than by calling
+				xTaskIncrementTick() once per tick, so the time taken depends on
+				the number of tasks unblocked rather than on how long the
+				scheduler was suspended. */
 				{
 					UBaseType_t uxPendedCounts = uxPendedTicks; /* Non-volatile copy. */
 
 					if( uxPendedCounts > ( UBaseType_t ) 0U )
 					{
-						do
+						if( prvCatchUpPendedTicks( ( TickType_t ) uxPendedCounts ) != pdFALSE )
 						{
-							if( xTaskIncrementTick() != pdFALSE )
-							{
-								xYieldPending = pdTRUE;
-							}
-							else
-							{
-								mtCOVERAGE_TEST_MARKER();
-							}
-							--uxPendedCounts;
-						} while( uxPendedCounts > ( UBaseType_t ) 0U );
+							xYieldPending = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
 
 						uxPendedTicks = 0;
 					}
@@ -2259,25 +2747,194 @@ BaseType_t xAlreadyYielded = pdFALSE;
 }
 /*-----------------------------------------------------------*/
 
-TickType_t xTaskGetTickCount( void )
+static BaseType_t prvCatchUpPendedTicks( TickType_t xTicksToCatchUp )
 {
-TickType_t xTicks;
+const TickType_t xStartTickCount = xTickCount;
+const TickType_t xEndTickCount = xStartTickCount + xTicksToCatchUp;
+UBaseType_t uxHighestReadiedPriority = tskIDLE_PRIORITY;
+BaseType_t xTaskReadied = pdFALSE, xSwitchRequired = pdFALSE;
 
-	/* Critical section required if running on a 16 bit processor. */
-	portTICK_TYPE_ENTER_CRITICAL();
+	/* Must only be called with the scheduler running, from within a critical
+	section, so the tick interrupt cannot change the delayed lists. */
+	configASSERT( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE );
+	traceTASK_CATCH_UP_PENDED_TICKS( xTicksToCatchUp );
+
+	#if( configUSE_DELAYED_TASK_WHEEL == 1 )
 	{
-		xTicks = xTickCount;
-	}
-	portTICK_TYPE_EXIT_CRITICAL();
+	TickType_t xWheelTime = xStartTickCount, xTicksRemaining = xTicksToCatchUp, xEventTime;
 
-	return xTicks;
-}
-/*-----------------------------------------------------------*/
+		/* Turn the wheel only to the times within the ticks being caught up
+		at which it has something to do, rather than to every tick. */
+		while( prvGetNextDelayedTaskWheelEvent( xWheelTime, xTicksRemaining, &xEventTime ) != pdFALSE )
+		{
+			xTicksRemaining -= ( TickType_t ) ( xEventTime - xWheelTime );
+			xWheelTime = xEventTime;
 
-TickType_t xTaskGetTickCountFromISR( void )
-{
-TickType_t xReturn;
-UBaseType_t uxSavedInterruptStatus;
+			if( prvTurnDelayedTaskWheel( xWheelTime, &uxHighestReadiedPriority ) != pdFALSE )
+			{
+				xTaskReadied = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		if( xEndTickCount < xStartTickCount )
+		{
+			xNumOfOverflows++;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#else
+	{
+	TCB_t * pxTCB;
+	TickType_t xItemValue;
+
+		if( xEndTickCount < xStartTickCount )
+		{
+			/* The tick count overflows, so every task in the current delayed
+			list is due, after which the overflow delayed list becomes the
+			current delayed list. */
+			while( listLIST_IS_EMPTY( pxDelayedTaskList ) == pdFALSE )
+			{
+				pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+				prvMoveDelayedTaskToReadyList( pxTCB );
+				xTaskReadied = pdTRUE;
+
+				if( pxTCB->uxPriority > uxHighestReadiedPriority )
+				{
+					uxHighestReadiedPriority = pxTCB->uxPriority;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+
+			taskSWITCH_DELAYED_LISTS();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* The delayed list is in wake time order, so stop at the first task
+		that is not yet due. */
+		while( listLIST_IS_EMPTY( pxDelayedTaskList ) == pdFALSE )
+		{
+			pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+			xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+
+			if( xEndTickCount < xItemValue )
+			{
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			prvMoveDelayedTaskToReadyList( pxTCB );
+			xTaskReadied = pdTRUE;
+
+			if( pxTCB->uxPriority > uxHighestReadiedPriority )
+			{
+				uxHighestReadiedPriority = pxTCB->uxPriority;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+	#endif /* configUSE_DELAYED_TASK_WHEEL */
+
+	xTickCount = xEndTickCount;
+	prvResetNextTaskUnblockTime();
+
+	/* A task being unblocked cannot cause an immediate context switch if
+	preemption is turned off. */
+	#if (  configUSE_PREEMPTION == 1 )
+	{
+		if( ( xTaskReadied != pdFALSE ) && ( uxHighestReadiedPriority >= pxCurrentTCB->uxPriority ) )
+		{
+			xSwitchRequired = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#else
+	{
+		( void ) uxHighestReadiedPriority;
+		( void ) xTaskReadied;
+	}
+	#endif /* configUSE_PREEMPTION */
+
+	/* Time slicing is applied as it would have been had any of the ticks been
+	processed individually. */
+	#if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+	{
+		if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+		{
+			xSwitchRequired = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
+
+	return xSwitchRequired;
+}
+/*-----------------------------------------------------------*/
+
+static void prvMoveDelayedTaskToReadyList( TCB_t *pxTCB )
+{
+	/* It is time to remove the item from the Blocked state. */
+	( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+
+	/* Is the task waiting on an event also?  If so remove it from the event
+	list. */
+	if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+	{
+		( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* Place the unblocked task into the appropriate ready list. */
+	prvAddTaskToReadyList( pxTCB );
+}
+/*-----------------------------------------------------------*/
+
+TickType_t xTaskGetTickCount( void )
+{
+TickType_t xTicks;
+
+	/* Critical section required if running on a 16 bit processor. */
+	portTICK_TYPE_ENTER_CRITICAL();
+	{
+		xTicks = xTickCount;
+	}
+	portTICK_TYPE_EXIT_CRITICAL();
+
+	return xTicks;
+}
+/*-----------------------------------------------------------*/
+
+TickType_t xTaskGetTickCountFromISR( void )
+{
+TickType_t xReturn;
+UBaseType_t uxSavedInterruptStatus;
 
 	/* RTOS ports that support interrupt nesting have the concept of a maximum
 	system call (or maximum API call) interrupt priority.  Interrupts that are
@@ -2325,7 +2982,7 @@ TCB_t *pxTCB;
 }
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskGetHandle == 1 )
+#if ( ( INCLUDE_xTaskGetHandle == 1 ) && ( configUSE_TASK_NAME_REGISTRY == 0 ) )
 
 	static TCB_t *prvSearchForNameWithinSingleList( List_t *pxList, const char pcNameToQuery[] )
 	{
@@ -2390,67 +3047,163 @@ TCB_t *pxTCB;
 		return pxReturn;
 	}
 
-#endif /* INCLUDE_xTaskGetHandle */
+#endif /* ( INCLUDE_xTaskGetHandle == 1 ) && ( configUSE_TASK_NAME_REGISTRY == 0 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_NAME_REGISTRY == 1 )
+
+	static uint32_t prvHashTaskName( const char *pcName ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	{
+	uint32_t ulHash = 5381UL;
+	UBaseType_t x;
+
+		/* The djb2 string hash, which only needs shifts and additions. */
+		for( x = ( UBaseType_t ) 0; ( x < ( UBaseType_t ) configMAX_TASK_NAME_LEN ) && ( pcName[ x ] != ( char ) 0x00 ); x++ )
+		{
+			ulHash = ( ulHash << 5 ) + ulHash + ( uint32_t ) ( uint8_t ) pcName[ x ];
+		}
+
+		return ulHash;
+	}
+
+#endif /* configUSE_TASK_NAME_REGISTRY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_NAME_REGISTRY == 1 )
+
+	static void prvRemoveTaskFromNameRegistry( const TCB_t *pxTCB )
+	{
+	TCB_t **ppxLink = taskGET_NAME_REGISTRY_BUCKET( pxTCB->ulNameHash );
+
+		/* Find the link that points to the task, then unlink the task. */
+		while( *ppxLink != NULL )
+		{
+			if( *ppxLink == pxTCB )
+			{
+				*ppxLink = pxTCB->pxNextInNameRegistry;
+				break;
+			}
+			else
+			{
+				ppxLink = &( ( *ppxLink )->pxNextInNameRegistry );
+			}
+		}
+	}
+
+#endif /* configUSE_TASK_NAME_REGISTRY */
 /*-----------------------------------------------------------*/
 
 #if ( INCLUDE_xTaskGetHandle == 1 )
 
 	TaskHandle_t xTaskGetHandle( const char *pcNameToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 	{
-	UBaseType_t uxQueue = configMAX_PRIORITIES;
 	TCB_t* pxTCB;
 
 		/* Task names will be truncated to configMAX_TASK_NAME_LEN - 1 bytes. */
 		configASSERT( strlen( pcNameToQuery ) < configMAX_TASK_NAME_LEN );
 
-		vTaskSuspendAll();
+		#if ( configUSE_TASK_NAME_REGISTRY == 1 )
 		{
-			/* Search the ready lists. */
-			do
+		const uint32_t ulNameHash = prvHashTaskName( pcNameToQuery );
+
+			/* Only the tasks in one registry bucket can have the name, and the
+			names are only compared if the hashes match.  The registry is only
+			updated from critical sections, so a short critical section is used
+			here in place of suspending the scheduler. */
+			taskENTER_CRITICAL();
 			{
-				uxQueue--;
-				pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) &( pxReadyTasksLists[ uxQueue ] ), pcNameToQuery );
+				for( pxTCB = *taskGET_NAME_REGISTRY_BUCKET( ulNameHash ); pxTCB != NULL; pxTCB = pxTCB->pxNextInNameRegistry )
+				{
+					if( ( pxTCB->ulNameHash == ulNameHash ) && ( strcmp( pxTCB->pcTaskName, pcNameToQuery ) == 0 ) )
+					{
+						/* Found the handle. */
+						break;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+			}
+			taskEXIT_CRITICAL();
+		}
+		#else
+		{
+		UBaseType_t uxQueue = configMAX_PRIORITIES;
 
-				if( pxTCB != NULL )
+			vTaskSuspendAll();
+			{
+				/* Search the ready lists. */
+				do
 				{
-					/* Found the handle. */
-					break;
+					uxQueue--;
+					pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) &( pxReadyTasksLists[ uxQueue ] ), pcNameToQuery );
+
+					if( pxTCB != NULL )
+					{
+						/* Found the handle. */
+						break;
+					}
+
+				} while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+				/* Search the delayed lists. */
+				#if( configUSE_DELAYED_TASK_WHEEL == 0 )
+				{
+					if( pxTCB == NULL )
+					{
+						pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
+					}
+
+					if( pxTCB == NULL )
+					{
+						pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+					}
 				}
+				#else
+				{
+				UBaseType_t uxSlot;
 
-			} while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+					for( uxSlot = ( UBaseType_t ) 0U; ( uxSlot < ( UBaseType_t ) configDELAYED_TASK_WHEEL_SIZE ) && ( pxTCB == NULL ); uxSlot++ )
+					{
+						pxTCB = prvSearchForNameWithinSingleList( &( xDelayedTaskWheelLevel0[ uxSlot ] ), pcNameToQuery );
 
-			/* Search the delayed lists. */
-			if( pxTCB == NULL )
-			{
-				pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
-			}
+						if( pxTCB == NULL )
+						{
+							pxTCB = prvSearchForNameWithinSingleList( &( xDelayedTaskWheelLevel1[ uxSlot ] ), pcNameToQuery );
+						}
+					}
 
-			if( pxTCB == NULL )
-			{
-				pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
-			}
+					if( pxTCB == NULL )
+					{
+						pxTCB = prvSearchForNameWithinSingleList( &xDelayedTaskWheelOverflowList, pcNameToQuery );
+					}
+				}
+				#endif
 
-			#if ( INCLUDE_vTaskSuspend == 1 )
-			{
-				if( pxTCB == NULL )
+				#if ( INCLUDE_vTaskSuspend == 1 )
 				{
-					/* Search the suspended list. */
-					pxTCB = prvSearchForNameWithinSingleList( &xSuspendedTaskList, pcNameToQuery );
+					if( pxTCB == NULL )
+					{
+						/* Search the suspended list. */
+						pxTCB = prvSearchForNameWithinSingleList( &xSuspendedTaskList, pcNameToQuery );
+					}
 				}
-			}
-			#endif
+				#endif
 
-			#if( INCLUDE_vTaskDelete == 1 )
-			{
-				if( pxTCB == NULL )
+				#if( INCLUDE_vTaskDelete == 1 )
 				{
-					/* Search the deleted list. */
-					pxTCB = prvSearchForNameWithinSingleList( &xTasksWaitingTermination, pcNameToQuery );
+					if( pxTCB == NULL )
+					{
+						/* Search the deleted list. */
+						pxTCB = prvSearchForNameWithinSingleList( &xTasksWaitingTermination, pcNameToQuery );
+					}
 				}
+				#endif
 			}
-			#endif
+			( void ) xTaskResumeAll();
 		}
-		( void ) xTaskResumeAll();
+		#endif /* configUSE_TASK_NAME_REGISTRY */
 
 		return pxTCB;
 	}
@@ -2460,7 +3213,7 @@ TCB_t *pxTCB;
 
 #if ( configUSE_TRACE_FACILITY == 1 )
 
-	UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, uint32_t * const pulTotalRunTime )
+	UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime )
 	{
 	UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
 
@@ -2480,8 +3233,24 @@ TCB_t *pxTCB;
 
 				/* Fill in an TaskStatus_t structure with information on each
 				task in the Blocked state. */
-				uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
-				uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+				#if( configUSE_DELAYED_TASK_WHEEL == 0 )
+				{
+					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
+					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+				}
+				#else
+				{
+				UBaseType_t uxSlot;
+
+					for( uxSlot = ( UBaseType_t ) 0U; uxSlot < ( UBaseType_t ) configDELAYED_TASK_WHEEL_SIZE; uxSlot++ )
+					{
+						uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( xDelayedTaskWheelLevel0[ uxSlot ] ), eBlocked );
+						uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( xDelayedTaskWheelLevel1[ uxSlot ] ), eBlocked );
+					}
+
+					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xDelayedTaskWheelOverflowList, eBlocked );
+				}
+				#endif
 
 				#if( INCLUDE_vTaskDelete == 1 )
 				{
@@ -2532,6 +3301,217 @@ TCB_t *pxTCB;
 #endif /* configUSE_TRACE_FACILITY */
 /*----------------------------------------------------------*/
 
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	void vTaskStatusIteratorInitialise( TaskStatusIterator_t * const pxIterator )
+	{
+		configASSERT( pxIterator );
+
+		pxIterator->pvLastTask = NULL;
+		pxIterator->ulLastTaskSequence = 0UL;
+		pxIterator->uxDeletedTasks = ( UBaseType_t ) 0U;
+
+		#if ( configGENERATE_RUN_TIME_STATS == 1 )
+		{
+			#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+				portALT_GET_RUN_TIME_COUNTER_VALUE( pxIterator->ulTotalRunTime );
+			#else
+				pxIterator->ulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+			#endif
+		}
+		#else
+		{
+			pxIterator->ulTotalRunTime = 0;
+		}
+		#endif
+	}
+
+#endif /* configUSE_TRACE_FACILITY */
+/*----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	BaseType_t xTaskStatusIteratorNext( TaskStatusIterator_t * const pxIterator, TaskStatus_t * const pxTaskStatus )
+	{
+	TCB_t *pxTCB = NULL;
+	const TCB_t *pxLastTCB;
+	const ListItem_t *pxItem;
+
+		configASSERT( pxIterator );
+		configASSERT( pxTaskStatus );
+
+		/* Only one task is reported per call, so the scheduler is suspended
+		for the time taken to report one task rather than for the time taken
+		to report every task. */
+		vTaskSuspendAll();
+		{
+			pxLastTCB = ( const TCB_t * ) pxIterator->pvLastTask;
+
+			if( pxLastTCB == NULL )
+			{
+				pxItem = listGET_HEAD_ENTRY( &xAllTasksList );
+			}
+			else if( pxIterator->uxDeletedTasks == uxAllTasksListDeletions )
+			{
+				/* No task has been deleted since the last call, so the task
+				reported last is still in xAllTasksList. */
+				pxItem = listGET_NEXT( &( pxLastTCB->xAllTasksListItem ) );
+			}
+			else
+			{
+				/* The task reported last may have been deleted, so must not be
+				dereferenced. */
+				pxItem = prvGetAllTasksListItemAfter( pxIterator->ulLastTaskSequence );
+			}
+
+			if( pxItem != listGET_END_MARKER( &xAllTasksList ) )
+			{
+				pxTCB = listGET_LIST_ITEM_OWNER( pxItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+				/* The task cannot be deleted while the scheduler is suspended,
+				so its TCB remains valid until the structure is filled in.  The
+				stack is not scanned as that would keep the scheduler suspended
+				for a time proportional to the stack size. */
+				vTaskGetInfo( ( TaskHandle_t ) pxTCB, pxTaskStatus, pdFALSE, eInvalid );
+
+				#if ( configUSE_STACK_WATERMARK == 1 )
+				{
+					pxTaskStatus->usStackHighWaterMark = uxTaskGetStackWatermark( ( TaskHandle_t ) pxTCB );
+				}
+				#endif
+
+				pxIterator->pvLastTask = ( void * ) pxTCB;
+				pxIterator->ulLastTaskSequence = pxTCB->ulAllTasksListSequence;
+				pxIterator->uxDeletedTasks = uxAllTasksListDeletions;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		( void ) xTaskResumeAll();
+
+		return ( pxTCB != NULL ) ? pdTRUE : pdFALSE;
+	}
+
+#endif /* configUSE_TRACE_FACILITY */
+/*----------------------------------------------------------*/
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+	static configRUN_TIME_COUNTER_TYPE prvGetTaskRunTime( const TCB_t *pxTCB, configRUN_TIME_COUNTER_TYPE *pulTotalRunTime )
+	{
+	configRUN_TIME_COUNTER_TYPE ulTaskRunTime;
+
+		#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+			portALT_GET_RUN_TIME_COUNTER_VALUE( ( *pulTotalRunTime ) );
+		#else
+			*pulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+		#endif
+
+		ulTaskRunTime = pxTCB->ulRunTimeCounter;
+
+		/* The run time of the running task is only added to its counter when
+		it is switched out. */
+		if( pxTCB == pxCurrentTCB )
+		{
+			ulTaskRunTime += ( *pulTotalRunTime - ulTaskSwitchedInTime );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return ulTaskRunTime;
+	}
+
+#endif /* configGENERATE_RUN_TIME_STATS */
+/*----------------------------------------------------------*/
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+	configRUN_TIME_COUNTER_TYPE ulTaskGetRunTimeCounter( const TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+	configRUN_TIME_COUNTER_TYPE ulReturn, ulTotalRunTimeNow;
+
+		pxTCB = prvGetTCBFromHandle( xTask );
+
+		taskENTER_CRITICAL();
+		{
+			ulReturn = prvGetTaskRunTime( pxTCB, &ulTotalRunTimeNow );
+		}
+		taskEXIT_CRITICAL();
+
+		return ulReturn;
+	}
+
+#endif /* configGENERATE_RUN_TIME_STATS */
+/*----------------------------------------------------------*/
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+	UBaseType_t uxTaskGetLoadOverWindow( const TaskHandle_t xTask, TaskLoadWindow_t * const pxWindow )
+	{
+	TCB_t *pxTCB;
+	configRUN_TIME_COUNTER_TYPE ulTaskRunTime, ulTotalRunTimeNow, ulTaskDelta, ulTotalDelta, ulLoad;
+	const configRUN_TIME_COUNTER_TYPE ulMaxTaskDelta = ( ~( configRUN_TIME_COUNTER_TYPE ) 0 ) / ( configRUN_TIME_COUNTER_TYPE ) tskLOAD_FULL_SCALE;
+
+		configASSERT( pxWindow );
+
+		pxTCB = prvGetTCBFromHandle( xTask );
+
+		taskENTER_CRITICAL();
+		{
+			ulTaskRunTime = prvGetTaskRunTime( pxTCB, &ulTotalRunTimeNow );
+		}
+		taskEXIT_CRITICAL();
+
+		/* The window is the time since the counters were last stored in
+		pxWindow.  The subtractions are unsigned so give the correct result
+		even if the counters wrapped once during the window. */
+		ulTaskDelta = ulTaskRunTime - pxWindow->ulTaskRunTime;
+		ulTotalDelta = ulTotalRunTimeNow - pxWindow->ulTotalRunTime;
+		pxWindow->ulTaskRunTime = ulTaskRunTime;
+		pxWindow->ulTotalRunTime = ulTotalRunTimeNow;
+
+		/* A task cannot run for longer than the window, so the load can never
+		exceed tskLOAD_FULL_SCALE. */
+		if( ulTaskDelta > ulTotalDelta )
+		{
+			ulTaskDelta = ulTotalDelta;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( ulTotalDelta > ( configRUN_TIME_COUNTER_TYPE ) 0 )
+		{
+			/* Multiply the task's run time up to the load resolution before
+			dividing by the window, so no precision is lost.  Only if that
+			would overflow are both run times scaled down first, which keeps
+			their ratio.  The window is never shorter than the task's run time,
+			so cannot be scaled down to zero. */
+			while( ulTaskDelta > ulMaxTaskDelta )
+			{
+				ulTaskDelta >>= 1;
+				ulTotalDelta >>= 1;
+			}
+
+			ulLoad = ( ulTaskDelta * ( configRUN_TIME_COUNTER_TYPE ) tskLOAD_FULL_SCALE ) / ulTotalDelta;
+		}
+		else
+		{
+			ulLoad = 0;
+		}
+
+		return ( UBaseType_t ) ulLoad;
+	}
+
+#endif /* configGENERATE_RUN_TIME_STATS */
+/*----------------------------------------------------------*/
+
 #if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
 
 	TaskHandle_t xTaskGetIdleTaskHandle( void )
@@ -2556,7 +3536,18 @@ implementations require configUSE_TICKLESS_IDLE to be set to a value other than
 		/* Correct the tick count value after a period during which the tick
 		was suppressed.  Note this does *not* call the tick hook function for
 		each stepped tick. */
-		configASSERT( ( xTickCount + xTicksToJump ) <= xNextTaskUnblockTime );
+		#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+		{
+			/* Only xTaskIncrementTick() processes the delayed task wheel, so the
+			tick count must not be stepped onto a time at which a task is due to
+			leave the Blocked state. */
+			configASSERT( ( xTickCount + xTicksToJump ) < xNextTaskUnblockTime );
+		}
+		#else
+		{
+			configASSERT( ( xTickCount + xTicksToJump ) <= xNextTaskUnblockTime );
+		}
+		#endif
 		xTickCount += xTicksToJump;
 		traceINCREASE_TICK_COUNT( xTicksToJump );
 	}
@@ -2642,8 +3633,6 @@ implementations require configUSE_TICKLESS_IDLE to be set to a value other than
 
 BaseType_t xTaskIncrementTick( void )
 {
-TCB_t * pxTCB;
-TickType_t xItemValue;
 BaseType_t xSwitchRequired = pdFALSE;
 
 	/* Called by the portable layer each time a tick interrupt occurs.
@@ -2660,96 +3649,172 @@ BaseType_t xSwitchRequired = pdFALSE;
 		delayed lists if it wraps to 0. */
 		xTickCount = xConstTickCount;
 
-		if( xConstTickCount == ( TickType_t ) 0U ) /*lint !e774 'if' does not always evaluate to false as it is looking for an overflow. */
+		#if( configUSE_DELAYED_TASK_WHEEL == 1 )
 		{
-			taskSWITCH_DELAYED_LISTS();
-		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
-		}
+		UBaseType_t uxHighestReadiedPriority = tskIDLE_PRIORITY;
 
-		/* See if this tick has made a timeout expire.  Tasks are stored in
-		the	queue in the order of their wake time - meaning once one task
-		has been found whose block time has not expired there is no need to
-		look any further down the list. */
-		if( xConstTickCount >= xNextTaskUnblockTime )
-		{
-			for( ;; )
+			if( xConstTickCount == ( TickType_t ) 0U ) /*lint !e774 'if' does not always evaluate to false as it is looking for an overflow. */
+			{
+				/* The wheel is indexed by the tick count itself so there are no
+				lists to switch, but tasks that were due after the overflow are
+				now due on this pass of the tick count, so xNextTaskUnblockTime
+				must be recalculated. */
+				xNumOfOverflows++;
+				xNextTaskUnblockTime = xConstTickCount;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Only the first level slot for this tick count can hold tasks
+			that are to be unblocked now, and every task in it is due.  Tasks
+			only move down from the second level and the overflow list at the
+			start of a group. */
+			if( ( ( xConstTickCount & taskDELAYED_TASK_WHEEL_MASK ) == ( TickType_t ) 0U ) ||
+				( listLIST_IS_EMPTY( &( xDelayedTaskWheelLevel0[ xConstTickCount & taskDELAYED_TASK_WHEEL_MASK ] ) ) == pdFALSE ) )
 			{
-				if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+				if( prvTurnDelayedTaskWheel( xConstTickCount, &uxHighestReadiedPriority ) != pdFALSE )
 				{
-					/* The delayed list is empty.  Set xNextTaskUnblockTime
-					to the maximum possible value so it is extremely
-					unlikely that the
-					if( xTickCount >= xNextTaskUnblockTime ) test will pass
-					next time through. */
-					xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-					break;
+					/* A task being unblocked cannot cause an immediate context
+					switch if preemption is turned off. */
+					#if (  configUSE_PREEMPTION == 1 )
+					{
+						/* Preemption is on, but a context switch should only
+						be performed if an unblocked task has a priority that
+						is equal to or higher than the currently executing
+						task. */
+						if( uxHighestReadiedPriority >= pxCurrentTCB->uxPriority )
+						{
+							xSwitchRequired = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#endif /* configUSE_PREEMPTION */
 				}
 				else
 				{
-					/* The delayed list is not empty, get the value of the
-					item at the head of the delayed list.  This is the time
-					at which the task at the head of the delayed list must
-					be removed from the Blocked state. */
-					pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-					xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
-
-					if( xConstTickCount < xItemValue )
-					{
-						/* It is not time to unblock this item yet, but the
-						item value is the time at which the task at the head
-						of the blocked list must be removed from the Blocked
-						state -	so record the item value in
-						xNextTaskUnblockTime. */
-						xNextTaskUnblockTime = xItemValue;
-						break; /*lint !e9011 Code structure here is deedmed easier to understand with multiple breaks. */
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-					/* It is time to remove the item from the Blocked state. */
-					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+			/* xNextTaskUnblockTime is a lower bound on the next time the wheel
+			has to be turned.  Once it has been reached hold it at the tick count, which marks it
+			as needing to be recalculated, rather than searching the wheel on
+			every tick.  It is only recalculated if tickless idle needs it. */
+			if( xConstTickCount >= xNextTaskUnblockTime )
+			{
+				xNextTaskUnblockTime = xConstTickCount;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#else
+		{
+		TCB_t * pxTCB;
+		TickType_t xItemValue;
 
-					/* Is the task waiting on an event also?  If so remove
-					it from the event list. */
-					if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+			if( xConstTickCount == ( TickType_t ) 0U ) /*lint !e774 'if' does not always evaluate to false as it is looking for an overflow. */
+			{
+				taskSWITCH_DELAYED_LISTS();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* See if this tick has made a timeout expire.  Tasks are stored in
+			the	queue in the order of their wake time - meaning once one task
+			has been found whose block time has not expired there is no need to
+			look any further down the list. */
+			if( xConstTickCount >= xNextTaskUnblockTime )
+			{
+				for( ;; )
+				{
+					if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
 					{
-						( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+						/* The delayed list is empty.  Set xNextTaskUnblockTime
+						to the maximum possible value so it is extremely
+						unlikely that the
+						if( xTickCount >= xNextTaskUnblockTime ) test will pass
+						next time through. */
+						xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+						break;
 					}
 					else
 					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+						/* The delayed list is not empty, get the value of the
+						item at the head of the delayed list.  This is the time
+						at which the task at the head of the delayed list must
+						be removed from the Blocked state. */
+						pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+						xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+
+						if( xConstTickCount < xItemValue )
+						{
+							/* It is not time to unblock this item yet, but the
+							item value is the time at which the task at the head
+							of the blocked list must be removed from the Blocked
+							state -	so record the item value in
+							xNextTaskUnblockTime. */
+							xNextTaskUnblockTime = xItemValue;
+							break; /*lint !e9011 Code structure here is deedmed easier to understand with multiple breaks. */
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
 
-					/* Place the unblocked task into the appropriate ready
-					list. */
-					prvAddTaskToReadyList( pxTCB );
+						/* It is time to remove the item from the Blocked state. */
+						( void ) uxListRemove( &( pxTCB->xStateListItem ) );
 
-					/* A task being unblocked cannot cause an immediate
-					context switch if preemption is turned off. */
-					#if (  configUSE_PREEMPTION == 1 )
-					{
-						/* Preemption is on, but a context switch should
-						only be performed if the unblocked task has a
-						priority that is equal to or higher than the
-						currently executing task. */
-						if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+						/* Is the task waiting on an event also?  If so remove
+						it from the event list. */
+						if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
 						{
-							xSwitchRequired = pdTRUE;
+							( void ) uxListRemove( &( pxTCB->xEventListItem ) );
 						}
 						else
 						{
 							mtCOVERAGE_TEST_MARKER();
 						}
+
+						/* Place the unblocked task into the appropriate ready
+						list. */
+						prvAddTaskToReadyList( pxTCB );
+
+						/* A task being unblocked cannot cause an immediate
+						context switch if preemption is turned off. */
+						#if (  configUSE_PREEMPTION == 1 )
+						{
+							/* Preemption is on, but a context switch should
+							only be performed if the unblocked task has a
+							priority that is equal to or higher than the
+							currently executing task. */
+							if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+							{
+								xSwitchRequired = pdTRUE;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						#endif /* configUSE_PREEMPTION */
 					}
-					#endif /* configUSE_PREEMPTION */
 				}
 			}
 		}
+		#endif /* configUSE_DELAYED_TASK_WHEEL */
 
 		/* Tasks of equal priority to the currently running task will share
 		processing time (time slice) if preemption is on, and the application
@@ -2945,19 +4010,12 @@ void vTaskSwitchContext( void )
 
 			/* Add the amount of time the task has been running to the
 			accumulated time so far.  The time the task started running was
-			stored in ulTaskSwitchedInTime.  Note that there is no overflow
-			protection here so count values are only valid until the timer
-			overflows.  The guard against negative values is to protect
-			against suspect run time stat counter implementations - which
-			are provided by the application, not the kernel. */
-			if( ulTotalRunTime > ulTaskSwitchedInTime )
-			{
-				pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
+			stored in ulTaskSwitchedInTime.  The subtraction is unsigned so
+			gives the correct result even if the counter wrapped while the task
+			was running, but the accumulated count values themselves are only
+			valid until they overflow.  Setting configRUN_TIME_COUNTER_TYPE to
+			uint64_t in FreeRTOSConfig.h prevents that with fast counters. */
+			pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
 			ulTaskSwitchedInTime = ulTotalRunTime;
 		}
 		#endif /* configGENERATE_RUN_TIME_STATS */
@@ -2965,6 +4023,10 @@ void vTaskSwitchContext( void )
 		/* Check for stack overflow, if configured. */
 		taskCHECK_FOR_STACK_OVERFLOW();
 
+		/* Record how deep the stack of the task being switched out is, if
+		configured. */
+		taskRECORD_STACK_WATERMARK();
+
 		/* Before the currently running task is switched out, save its errno. */
 		#if( configUSE_POSIX_ERRNO == 1 )
 		{
@@ -2995,7 +4057,7 @@ void vTaskSwitchContext( void )
 }
 /*-----------------------------------------------------------*/
 
-void vTaskPlaceOnEventList( List_t * const pxEventList, const TickType_t xTicksToWait )
+void vTaskPlaceOnEventList( EventList_t * const pxEventList, const TickType_t xTicksToWait )
 {
 	configASSERT( pxEventList );
 
@@ -3006,7 +4068,7 @@ void vTaskPlaceOnEventList( List_t * const pxEventList, const TickType_t xTicksT
 	This is placed in the list in priority order so the highest priority task
 	is the first to be woken by the event.  The queue that contains the event
 	list is locked, preventing simultaneous access from interrupts. */
-	vListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+	prvAddTaskToEventList( pxCurrentTCB, pxEventList );
 
 	prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
 }
@@ -3038,7 +4100,7 @@ void vTaskPlaceOnUnorderedEventList( List_t * pxEventList, const TickType_t xIte
 
 #if( configUSE_TIMERS == 1 )
 
-	void vTaskPlaceOnEventListRestricted( List_t * const pxEventList, TickType_t xTicksToWait, const BaseType_t xWaitIndefinitely )
+	void vTaskPlaceOnEventListRestricted( EventList_t * const pxEventList, TickType_t xTicksToWait, const BaseType_t xWaitIndefinitely )
 	{
 		configASSERT( pxEventList );
 
@@ -3052,7 +4114,16 @@ void vTaskPlaceOnUnorderedEventList( List_t * pxEventList, const TickType_t xIte
 		In this case it is assume that this is the only task that is going to
 		be waiting on this event list, so the faster vListInsertEnd() function
 		can be used in place of vListInsert. */
-		vListInsertEnd( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+		#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+		{
+			vListInsertEnd( &( pxEventList->xWaitingTasks[ pxCurrentTCB->uxPriority ] ), &( pxCurrentTCB->xEventListItem ) );
+			taskRECORD_EVENT_LIST_PRIORITY( pxCurrentTCB->uxPriority, pxEventList );
+		}
+		#else
+		{
+			vListInsertEnd( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+		}
+		#endif
 
 		/* If the task should block indefinitely then set the block time to a
 		value that will be recognised as an indefinite delay inside the
@@ -3069,7 +4140,7 @@ void vTaskPlaceOnUnorderedEventList( List_t * pxEventList, const TickType_t xIte
 #endif /* configUSE_TIMERS */
 /*-----------------------------------------------------------*/
 
-BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
+BaseType_t xTaskRemoveFromEventList( EventList_t * const pxEventList )
 {
 TCB_t *pxUnblockedTCB;
 BaseType_t xReturn;
@@ -3087,7 +4158,20 @@ BaseType_t xReturn;
 
 	This function assumes that a check has already been made to ensure that
 	pxEventList is not empty. */
-	pxUnblockedTCB = listGET_OWNER_OF_HEAD_ENTRY( pxEventList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+	#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+	{
+	List_t *pxHighestPriorityList = prvGetHighestPriorityEventList( pxEventList );
+
+		/* The head of the list for the highest waiting priority is the task
+		that has been waiting longest at that priority. */
+		configASSERT( pxHighestPriorityList );
+		pxUnblockedTCB = listGET_OWNER_OF_HEAD_ENTRY( pxHighestPriorityList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+	}
+	#else
+	{
+		pxUnblockedTCB = listGET_OWNER_OF_HEAD_ENTRY( pxEventList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+	}
+	#endif
 	configASSERT( pxUnblockedTCB );
 	( void ) uxListRemove( &( pxUnblockedTCB->xEventListItem ) );
 
@@ -3137,6 +4221,142 @@ BaseType_t xReturn;
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+
+	void vTaskEventListInitialise( EventList_t * const pxEventList )
+	{
+	UBaseType_t uxPriority;
+
+		for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
+		{
+			vListInitialise( &( pxEventList->xWaitingTasks[ uxPriority ] ) );
+		}
+
+		pxEventList->uxWaitingPriorities = ( UBaseType_t ) 0U;
+	}
+
+#endif /* configUSE_PRIORITY_EVENT_LISTS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+
+	BaseType_t xTaskEventListIsEmpty( EventList_t * const pxEventList )
+	{
+	BaseType_t xReturn;
+
+		if( prvGetHighestPriorityEventList( pxEventList ) == NULL )
+		{
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			xReturn = pdFALSE;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_PRIORITY_EVENT_LISTS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MUTEXES == 1 )
+
+	UBaseType_t uxTaskEventListGetHighestPriority( EventList_t * const pxEventList )
+	{
+	UBaseType_t uxReturn;
+
+		#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+		{
+		List_t *pxHighestPriorityList = prvGetHighestPriorityEventList( pxEventList );
+
+			if( pxHighestPriorityList != NULL )
+			{
+				uxReturn = ( UBaseType_t ) ( pxHighestPriorityList - &( pxEventList->xWaitingTasks[ 0 ] ) );
+			}
+			else
+			{
+				uxReturn = tskIDLE_PRIORITY;
+			}
+		}
+		#else
+		{
+			if( listCURRENT_LIST_LENGTH( pxEventList ) > 0U )
+			{
+				uxReturn = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxEventList );
+			}
+			else
+			{
+				uxReturn = tskIDLE_PRIORITY;
+			}
+		}
+		#endif /* configUSE_PRIORITY_EVENT_LISTS */
+
+		return uxReturn;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+
+	static List_t *prvGetHighestPriorityEventList( EventList_t * const pxEventList )
+	{
+	List_t *pxReturn = NULL;
+	UBaseType_t uxTopPriority;
+
+		#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+		{
+			/* Search down from the highest priority that might have waiting
+			tasks, recording the priority found so the next search starts
+			there. */
+			uxTopPriority = pxEventList->uxWaitingPriorities;
+
+			for( ;; )
+			{
+				if( listLIST_IS_EMPTY( &( pxEventList->xWaitingTasks[ uxTopPriority ] ) ) == pdFALSE )
+				{
+					pxReturn = &( pxEventList->xWaitingTasks[ uxTopPriority ] );
+					break;
+				}
+				else if( uxTopPriority == tskIDLE_PRIORITY )
+				{
+					break;
+				}
+				else
+				{
+					--uxTopPriority;
+				}
+			}
+
+			pxEventList->uxWaitingPriorities = uxTopPriority;
+		}
+		#else
+		{
+			/* Clear the bit of each empty list found until a list that is not
+			empty is found or no bits remain set. */
+			while( pxEventList->uxWaitingPriorities != ( UBaseType_t ) 0U )
+			{
+				portGET_HIGHEST_PRIORITY( uxTopPriority, pxEventList->uxWaitingPriorities );
+
+				if( listLIST_IS_EMPTY( &( pxEventList->xWaitingTasks[ uxTopPriority ] ) ) == pdFALSE )
+				{
+					pxReturn = &( pxEventList->xWaitingTasks[ uxTopPriority ] );
+					break;
+				}
+				else
+				{
+					portRESET_READY_PRIORITY( uxTopPriority, pxEventList->uxWaitingPriorities );
+				}
+			}
+		}
+		#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+
+		return pxReturn;
+	}
+
+#endif /* configUSE_PRIORITY_EVENT_LISTS */
+/*-----------------------------------------------------------*/
+
 void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem, const TickType_t xItemValue )
 {
 TCB_t *pxUnblockedTCB;
@@ -3328,6 +4548,15 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
 		is responsible for freeing the deleted task's TCB and stack. */
 		prvCheckTasksWaitingTermination();
 
+		#if ( ( configUSE_STACK_WATERMARK == 1 ) && ( configSTACK_WATERMARK_SCAN_BYTES > 0 ) )
+		{
+			/* Scan a few more bytes of the stack of one task so the stack high
+			water marks are kept up to date without ever scanning a whole stack
+			at once. */
+			prvScanStackHighWaterMark();
+		}
+		#endif /* configUSE_STACK_WATERMARK */
+
 		#if ( configUSE_PREEMPTION == 0 )
 		{
 			/* If we are not using preemption we keep forcing a task switch to
@@ -3530,8 +4759,25 @@ UBaseType_t uxPriority;
 		vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
 	}
 
-	vListInitialise( &xDelayedTaskList1 );
-	vListInitialise( &xDelayedTaskList2 );
+	#if( configUSE_DELAYED_TASK_WHEEL == 0 )
+	{
+		vListInitialise( &xDelayedTaskList1 );
+		vListInitialise( &xDelayedTaskList2 );
+	}
+	#else
+	{
+	UBaseType_t uxSlot;
+
+		for( uxSlot = ( UBaseType_t ) 0U; uxSlot < ( UBaseType_t ) configDELAYED_TASK_WHEEL_SIZE; uxSlot++ )
+		{
+			vListInitialise( &( xDelayedTaskWheelLevel0[ uxSlot ] ) );
+			vListInitialise( &( xDelayedTaskWheelLevel1[ uxSlot ] ) );
+		}
+
+		vListInitialise( &xDelayedTaskWheelOverflowList );
+	}
+	#endif /* configUSE_DELAYED_TASK_WHEEL */
+
 	vListInitialise( &xPendingReadyList );
 
 	#if ( INCLUDE_vTaskDelete == 1 )
@@ -3546,10 +4792,20 @@ UBaseType_t uxPriority;
 	}
 	#endif /* INCLUDE_vTaskSuspend */
 
-	/* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
-	using list2. */
-	pxDelayedTaskList = &xDelayedTaskList1;
-	pxOverflowDelayedTaskList = &xDelayedTaskList2;
+	#if ( tskUSE_ALL_TASKS_LIST == 1 )
+	{
+		vListInitialise( &xAllTasksList );
+	}
+	#endif /* tskUSE_ALL_TASKS_LIST */
+
+	#if( configUSE_DELAYED_TASK_WHEEL == 0 )
+	{
+		/* Start with pxDelayedTaskList using list1 and the
+		pxOverflowDelayedTaskList using list2. */
+		pxDelayedTaskList = &xDelayedTaskList1;
+		pxOverflowDelayedTaskList = &xDelayedTaskList2;
+	}
+	#endif /* configUSE_DELAYED_TASK_WHEEL */
 }
 /*-----------------------------------------------------------*/
 
@@ -3728,75 +4984,251 @@ static void prvCheckTasksWaitingTermination( void )
 		return ( configSTACK_DEPTH_TYPE ) ulCount;
 	}
 
-#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) ) */
-/*-----------------------------------------------------------*/
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 )
+
+	/* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are the
+	same except for their return type.  Using configSTACK_DEPTH_TYPE allows the
+	user to determine the return type.  It gets around the problem of the value
+	overflowing on 8-bit types without breaking backward compatibility for
+	applications that expect an 8-bit return type. */
+	configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+	uint8_t *pucEndOfStack;
+	configSTACK_DEPTH_TYPE uxReturn;
+
+		/* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are
+		the same except for their return type.  Using configSTACK_DEPTH_TYPE
+		allows the user to determine the return type.  It gets around the
+		problem of the value overflowing on 8-bit types without breaking
+		backward compatibility for applications that expect an 8-bit return
+		type. */
+
+		pxTCB = prvGetTCBFromHandle( xTask );
+
+		#if portSTACK_GROWTH < 0
+		{
+			pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+		}
+		#else
+		{
+			pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+		}
+		#endif
+
+		uxReturn = prvTaskCheckFreeStackSpace( pucEndOfStack );
+
+		return uxReturn;
+	}
+
+#endif /* INCLUDE_uxTaskGetStackHighWaterMark2 */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_uxTaskGetStackHighWaterMark == 1 )
+
+	UBaseType_t uxTaskGetStackHighWaterMark( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+	uint8_t *pucEndOfStack;
+	UBaseType_t uxReturn;
+
+		pxTCB = prvGetTCBFromHandle( xTask );
+
+		#if portSTACK_GROWTH < 0
+		{
+			pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+		}
+		#else
+		{
+			pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+		}
+		#endif
+
+		uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pucEndOfStack );
+
+		return uxReturn;
+	}
+
+#endif /* INCLUDE_uxTaskGetStackHighWaterMark */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STACK_WATERMARK == 1 )
+
+	configSTACK_DEPTH_TYPE uxTaskGetStackWatermark( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+	configSTACK_DEPTH_TYPE uxReturn;
+
+		pxTCB = prvGetTCBFromHandle( xTask );
+
+		taskENTER_CRITICAL();
+		{
+			/* The stack beyond the deepest saved stack pointer was never in use
+			when the task was switched out, but may have been used between
+			context switches, so the result of the last background scan is
+			returned instead if it is lower. */
+			#if portSTACK_GROWTH < 0
+			{
+				uxReturn = ( configSTACK_DEPTH_TYPE ) ( pxTCB->pxStackWatermark - pxTCB->pxStack );
+			}
+			#else
+			{
+				uxReturn = ( configSTACK_DEPTH_TYPE ) ( pxTCB->pxEndOfStack - pxTCB->pxStackWatermark );
+			}
+			#endif
+
+			if( pxTCB->uxStackHighWaterMark < uxReturn )
+			{
+				uxReturn = pxTCB->uxStackHighWaterMark;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return uxReturn;
+	}
+
+#endif /* configUSE_STACK_WATERMARK */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_STACK_WATERMARK == 1 ) && ( configSTACK_WATERMARK_SCAN_BYTES > 0 ) )
+
+	static void prvScanStackHighWaterMark( void )
+	{
+	TCB_t *pxTCB, *pxNextTCB;
+	const uint8_t *pucWatermark;
+	UBaseType_t uxBytesScanned;
+	BaseType_t xScanComplete = pdFALSE;
+
+		/* The scheduler is suspended so the task being scanned cannot be
+		deleted, and the lists cannot change, while this function runs. */
+		vTaskSuspendAll();
+		{
+			if( pxStackScanTCB == NULL )
+			{
+			const ListItem_t *pxItem;
+
+				/* Select the task after the task scanned last in xAllTasksList,
+				wrapping back to the start of the list after the end. */
+				if( pxLastStackScanTCB == NULL )
+				{
+					pxItem = listGET_HEAD_ENTRY( &xAllTasksList );
+				}
+				else
+				{
+					pxItem = listGET_NEXT( &( pxLastStackScanTCB->xAllTasksListItem ) );
+				}
+
+				if( pxItem == listGET_END_MARKER( &xAllTasksList ) )
+				{
+					pxItem = listGET_HEAD_ENTRY( &xAllTasksList );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* There is always at least the idle task to select. */
+				configASSERT( pxItem != listGET_END_MARKER( &xAllTasksList ) );
+				pxNextTCB = listGET_LIST_ITEM_OWNER( pxItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+				pxStackScanTCB = pxNextTCB;
+				pxLastStackScanTCB = pxNextTCB;
+				ulStackScanFreeBytes = 0UL;
 
-#if ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 )
+				#if portSTACK_GROWTH < 0
+				{
+					pucStackScanByte = ( const uint8_t * ) pxNextTCB->pxStack;
+				}
+				#else
+				{
+					pucStackScanByte = ( const uint8_t * ) pxNextTCB->pxEndOfStack;
+				}
+				#endif
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-	/* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are the
-	same except for their return type.  Using configSTACK_DEPTH_TYPE allows the
-	user to determine the return type.  It gets around the problem of the value
-	overflowing on 8-bit types without breaking backward compatibility for
-	applications that expect an 8-bit return type. */
-	configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask )
-	{
-	TCB_t *pxTCB;
-	uint8_t *pucEndOfStack;
-	configSTACK_DEPTH_TYPE uxReturn;
+			pxTCB = pxStackScanTCB;
+			pucWatermark = ( const uint8_t * ) pxTCB->pxStackWatermark;
 
-		/* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are
-		the same except for their return type.  Using configSTACK_DEPTH_TYPE
-		allows the user to determine the return type.  It gets around the
-		problem of the value overflowing on 8-bit types without breaking
-		backward compatibility for applications that expect an 8-bit return
-		type. */
+			for( uxBytesScanned = ( UBaseType_t ) 0U; uxBytesScanned < ( UBaseType_t ) configSTACK_WATERMARK_SCAN_BYTES; uxBytesScanned++ )
+			{
+				/* The scan ends at the first byte that is no longer set to the
+				value the stack was filled with when the task was created, or
+				at the deepest saved stack pointer, beyond which the stack is
+				known to have been used. */
+				#if portSTACK_GROWTH < 0
+					if( ( pucStackScanByte >= pucWatermark ) || ( *pucStackScanByte != ( uint8_t ) tskSTACK_FILL_BYTE ) )
+				#else
+					if( ( pucStackScanByte <= pucWatermark ) || ( *pucStackScanByte != ( uint8_t ) tskSTACK_FILL_BYTE ) )
+				#endif
+				{
+					xScanComplete = pdTRUE;
+					break;
+				}
 
-		pxTCB = prvGetTCBFromHandle( xTask );
+				pucStackScanByte -= portSTACK_GROWTH;
+				ulStackScanFreeBytes++;
+			}
 
-		#if portSTACK_GROWTH < 0
-		{
-			pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
-		}
-		#else
-		{
-			pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+			if( xScanComplete != pdFALSE )
+			{
+				/* The task may have used more of its stack since the start of
+				a long scan, in which case the result is slightly too high until
+				the stack is next scanned. */
+				pxTCB->uxStackHighWaterMark = ( configSTACK_DEPTH_TYPE ) ( ulStackScanFreeBytes / ( uint32_t ) sizeof( StackType_t ) );
+				pxStackScanTCB = NULL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
-		#endif
-
-		uxReturn = prvTaskCheckFreeStackSpace( pucEndOfStack );
-
-		return uxReturn;
+		( void ) xTaskResumeAll();
 	}
 
-#endif /* INCLUDE_uxTaskGetStackHighWaterMark2 */
+#endif /* ( configUSE_STACK_WATERMARK == 1 ) && ( configSTACK_WATERMARK_SCAN_BYTES > 0 ) */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_uxTaskGetStackHighWaterMark == 1 )
+#if( configUSE_TRACE_FACILITY == 1 )
 
-	UBaseType_t uxTaskGetStackHighWaterMark( TaskHandle_t xTask )
+	static const ListItem_t *prvGetAllTasksListItemAfter( uint32_t ulSequence )
 	{
-	TCB_t *pxTCB;
-	uint8_t *pucEndOfStack;
-	UBaseType_t uxReturn;
+	ListItem_t const *pxEndMarker = listGET_END_MARKER( &xAllTasksList );
+	const ListItem_t *pxItem;
 
-		pxTCB = prvGetTCBFromHandle( xTask );
+	const TCB_t *pxTCB;
 
-		#if portSTACK_GROWTH < 0
-		{
-			pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
-		}
-		#else
+		/* The sequence numbers are 32 bits on all ports and wrap, so a task
+		was created after the task with sequence number ulSequence if the
+		difference between the two sequence numbers is greater than zero and
+		less than half the range of a uint32_t. */
+		for( pxItem = listGET_HEAD_ENTRY( &xAllTasksList ); pxItem != pxEndMarker; pxItem = listGET_NEXT( pxItem ) )
 		{
-			pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
-		}
-		#endif
+			pxTCB = listGET_LIST_ITEM_OWNER( pxItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
 
-		uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pucEndOfStack );
+			if( ( uint32_t ) ( pxTCB->ulAllTasksListSequence - ulSequence - 1UL ) < 0x7fffffffUL )
+			{
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
 
-		return uxReturn;
+		return pxItem;
 	}
 
-#endif /* INCLUDE_uxTaskGetStackHighWaterMark */
+#endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
 #if ( INCLUDE_vTaskDelete == 1 )
@@ -3820,8 +5252,8 @@ static void prvCheckTasksWaitingTermination( void )
 		{
 			/* The task can only have been allocated dynamically - free both
 			the stack and TCB. */
-			vPortFree( pxTCB->pxStack );
-			vPortFree( pxTCB );
+			tskFREE_STACK( pxTCB->pxStack );
+			tskFREE_TCB( pxTCB );
 		}
 		#elif( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
 		{
@@ -3832,14 +5264,14 @@ static void prvCheckTasksWaitingTermination( void )
 			{
 				/* Both the stack and TCB were allocated dynamically, so both
 				must be freed. */
-				vPortFree( pxTCB->pxStack );
-				vPortFree( pxTCB );
+				tskFREE_STACK( pxTCB->pxStack );
+				tskFREE_TCB( pxTCB );
 			}
 			else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
 			{
 				/* Only the stack was statically allocated, so the TCB is the
 				only memory that must be freed. */
-				vPortFree( pxTCB );
+				tskFREE_TCB( pxTCB );
 			}
 			else
 			{
@@ -3857,25 +5289,37 @@ static void prvCheckTasksWaitingTermination( void )
 
 static void prvResetNextTaskUnblockTime( void )
 {
-TCB_t *pxTCB;
-
-	if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+	#if( configUSE_DELAYED_TASK_WHEEL == 0 )
 	{
-		/* The new current delayed list is empty.  Set xNextTaskUnblockTime to
-		the maximum possible value so it is	extremely unlikely that the
-		if( xTickCount >= xNextTaskUnblockTime ) test will pass until
-		there is an item in the delayed list. */
-		xNextTaskUnblockTime = portMAX_DELAY;
+	TCB_t *pxTCB;
+
+		if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+		{
+			/* The new current delayed list is empty.  Set xNextTaskUnblockTime to
+			the maximum possible value so it is	extremely unlikely that the
+			if( xTickCount >= xNextTaskUnblockTime ) test will pass until
+			there is an item in the delayed list. */
+			xNextTaskUnblockTime = portMAX_DELAY;
+		}
+		else
+		{
+			/* The new current delayed list is not empty, get the value of
+			the item at the head of the delayed list.  This is the time at
+			which the task at the head of the delayed list should be removed
+			from the Blocked state. */
+			( pxTCB ) = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+			xNextTaskUnblockTime = listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ) );
+		}
 	}
-	else
+	#else
 	{
-		/* The new current delayed list is not empty, get the value of
-		the item at the head of the delayed list.  This is the time at
-		which the task at the head of the delayed list should be removed
-		from the Blocked state. */
-		( pxTCB ) = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-		xNextTaskUnblockTime = listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ) );
+		/* Finding the next wake time means searching the whole wheel, so
+		instead hold xNextTaskUnblockTime at the tick count to mark it as
+		needing to be recalculated.  It is only recalculated if it is needed
+		by tickless idle. */
+		xNextTaskUnblockTime = xTickCount;
 	}
+	#endif /* configUSE_DELAYED_TASK_WHEEL */
 }
 /*-----------------------------------------------------------*/
 
@@ -4167,30 +5611,407 @@ TCB_t *pxTCB;
 							mtCOVERAGE_TEST_MARKER();
 						}
 
-						prvAddTaskToReadyList( pxTCB );
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+						prvAddTaskToReadyList( pxTCB );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+
+	void vTaskMutexTaken( MutexLink_t * const pxMutex )
+	{
+		pxMutex->xHolder = pvTaskIncrementMutexHeldCount();
+
+		/* If the mutex is taken before any tasks have been created then
+		pxCurrentTCB will be NULL. */
+		if( pxCurrentTCB != NULL )
+		{
+			/* The task is no longer waiting for a mutex, even if it blocked
+			before obtaining this one. */
+			pxCurrentTCB->pxWaitingForMutex = NULL;
+
+			/* Mutexes are normally given back in the opposite order to that in
+			which they were taken, so add the mutex to the front of the list of
+			mutexes held by the task. */
+			pxMutex->pxNextHeldMutex = pxCurrentTCB->pxMutexesHeld;
+			pxCurrentTCB->pxMutexesHeld = pxMutex;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_TRANSITIVE_PRIORITY_INHERITANCE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+
+	BaseType_t xTaskPriorityInheritThroughMutex( MutexLink_t * const pxMutex )
+	{
+	TCB_t *pxHolderTCB = pxMutex->xHolder;
+	MutexLink_t *pxNextMutex;
+	const UBaseType_t uxInheritedPriority = pxCurrentTCB->uxPriority;
+	BaseType_t xReturn = pdFALSE;
+
+		/* Remember the mutex the calling task is about to block on, so a task
+		that later blocks on a mutex held by the calling task can pass its
+		priority on to the holder of this mutex too. */
+		pxCurrentTCB->pxWaitingForMutex = pxMutex;
+
+		if( pxHolderTCB != NULL )
+		{
+			/* As per xTaskPriorityInherit(), inheritance has occurred if the
+			holder's priority is, or is about to be, above its base priority
+			because the calling task is waiting for the mutex. */
+			if( pxHolderTCB->uxBasePriority < uxInheritedPriority )
+			{
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Raise the priority of the holder, then of the holder of the mutex
+			the holder is blocked on, and so on.  A task that is already at or
+			above the inherited priority ends the chain, as any task holding a
+			mutex on which it is blocked will already have inherited at least
+			its priority. */
+			while( ( pxHolderTCB != NULL ) && ( pxHolderTCB->uxPriority < uxInheritedPriority ) )
+			{
+				prvSetInheritedPriority( pxHolderTCB, uxInheritedPriority );
+				traceTASK_PRIORITY_INHERIT( pxHolderTCB, uxInheritedPriority );
+
+				pxNextMutex = prvGetMutexWaitedFor( pxHolderTCB );
+
+				if( pxNextMutex != NULL )
+				{
+					pxHolderTCB = pxNextMutex->xHolder;
+				}
+				else
+				{
+					pxHolderTCB = NULL;
+				}
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TRANSITIVE_PRIORITY_INHERITANCE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+
+	BaseType_t xTaskPriorityDisinheritMutex( MutexLink_t * const pxMutex )
+	{
+	TCB_t * const pxTCB = pxMutex->xHolder;
+	UBaseType_t uxPriorityToUse;
+	BaseType_t xReturn = pdFALSE;
+
+		if( pxTCB != NULL )
+		{
+			/* A mutex that is held by a task cannot be given from an interrupt,
+			and if a mutex is given by the holding task then it must be the
+			running state task. */
+			configASSERT( pxTCB == pxCurrentTCB );
+			prvRemoveHeldMutex( pxTCB, pxMutex );
+
+			/* The task only needs to keep an inherited priority if a task of
+			that priority is waiting for one of the mutexes it still holds. */
+			uxPriorityToUse = prvGetInheritedPriority( pxTCB );
+
+			if( pxTCB->uxPriority != uxPriorityToUse )
+			{
+				traceTASK_PRIORITY_DISINHERIT( pxTCB, uxPriorityToUse );
+				prvSetInheritedPriority( pxTCB, uxPriorityToUse );
+
+				/* Return true to indicate that a context switch is required, as
+				a task that was waiting for the mutex, or that was preempted by
+				the raised priority, may now have the highest priority. */
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TRANSITIVE_PRIORITY_INHERITANCE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+
+	void vTaskPriorityDisinheritMutexAfterTimeout( MutexLink_t * const pxMutex )
+	{
+	TCB_t *pxHolderTCB = pxMutex->xHolder;
+	MutexLink_t *pxNextMutex;
+	UBaseType_t uxPriorityToUse;
+
+		/* The calling task has already been removed from the list of tasks
+		waiting for the mutex. */
+		pxCurrentTCB->pxWaitingForMutex = NULL;
+
+		/* The holder of the mutex, and any task along the chain of mutexes
+		from it, might have inherited the calling task's priority.  Recalculate
+		the priority of each in turn, stopping at the first task whose priority
+		does not change as the tasks beyond it cannot be affected. */
+		while( pxHolderTCB != NULL )
+		{
+			uxPriorityToUse = prvGetInheritedPriority( pxHolderTCB );
+
+			if( pxHolderTCB->uxPriority != uxPriorityToUse )
+			{
+				/* If a task has timed out because it already holds the mutex
+				it was trying to obtain then it cannot have inherited its own
+				priority. */
+				configASSERT( pxHolderTCB != pxCurrentTCB );
+
+				traceTASK_PRIORITY_DISINHERIT( pxHolderTCB, uxPriorityToUse );
+				prvSetInheritedPriority( pxHolderTCB, uxPriorityToUse );
+
+				pxNextMutex = prvGetMutexWaitedFor( pxHolderTCB );
+
+				if( pxNextMutex != NULL )
+				{
+					pxHolderTCB = pxNextMutex->xHolder;
+				}
+				else
+				{
+					pxHolderTCB = NULL;
+				}
+			}
+			else
+			{
+				pxHolderTCB = NULL;
+			}
+		}
+	}
+
+#endif /* configUSE_TRANSITIVE_PRIORITY_INHERITANCE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+
+	void vTaskMutexDeleted( MutexLink_t * const pxMutex )
+	{
+	TCB_t * const pxTCB = pxMutex->xHolder;
+	UBaseType_t uxPriorityToUse;
+
+		/* A mutex that is deleted while it is held must not remain in the list
+		of mutexes held by its holder, as its memory might be reused. */
+		if( pxTCB != NULL )
+		{
+			prvRemoveHeldMutex( pxTCB, pxMutex );
+			pxMutex->xHolder = NULL;
+
+			uxPriorityToUse = prvGetInheritedPriority( pxTCB );
+
+			if( pxTCB->uxPriority != uxPriorityToUse )
+			{
+				traceTASK_PRIORITY_DISINHERIT( pxTCB, uxPriorityToUse );
+				prvSetInheritedPriority( pxTCB, uxPriorityToUse );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_TRANSITIVE_PRIORITY_INHERITANCE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+
+	static void prvRemoveHeldMutex( TCB_t * const pxTCB, const MutexLink_t * const pxMutex )
+	{
+	MutexLink_t **ppxLink = &( pxTCB->pxMutexesHeld );
+
+		configASSERT( pxTCB->uxMutexesHeld );
+		( pxTCB->uxMutexesHeld )--;
+
+		/* Mutexes are normally given back in the opposite order to that in
+		which they were taken, so the mutex will normally be at the front of the
+		list. */
+		while( *ppxLink != pxMutex )
+		{
+			configASSERT( *ppxLink );
+			ppxLink = &( ( *ppxLink )->pxNextHeldMutex );
+		}
+
+		*ppxLink = pxMutex->pxNextHeldMutex;
+	}
+
+#endif /* configUSE_TRANSITIVE_PRIORITY_INHERITANCE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+
+	static MutexLink_t *prvGetMutexWaitedFor( const TCB_t * const pxTCB )
+	{
+	MutexLink_t *pxReturn = NULL;
+	const List_t * const pxContainer = listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) );
+
+		/* pxWaitingForMutex is not cleared by every path that removes a task
+		from an event list, so also check the task really is in the list of
+		tasks waiting for the mutex. */
+		if( ( pxTCB->pxWaitingForMutex != NULL ) && ( pxContainer != NULL ) )
+		{
+			#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+			{
+			const EventList_t * const pxEventList = pxTCB->pxWaitingForMutex->pxTasksWaiting;
+
+				if( ( pxContainer >= &( pxEventList->xWaitingTasks[ 0 ] ) ) && ( pxContainer < &( pxEventList->xWaitingTasks[ configMAX_PRIORITIES ] ) ) ) /*lint !e946 Pointer comparison is the cleanest way of checking which of the lists the task is in. */
+				{
+					pxReturn = pxTCB->pxWaitingForMutex;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#else
+			{
+				if( pxContainer == pxTCB->pxWaitingForMutex->pxTasksWaiting )
+				{
+					pxReturn = pxTCB->pxWaitingForMutex;
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
+			#endif /* configUSE_PRIORITY_EVENT_LISTS */
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pxReturn;
+	}
+
+#endif /* configUSE_TRANSITIVE_PRIORITY_INHERITANCE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+
+	static UBaseType_t prvGetInheritedPriority( const TCB_t * const pxTCB )
+	{
+	UBaseType_t uxPriority = pxTCB->uxBasePriority, uxWaitingPriority;
+	const MutexLink_t *pxMutex;
+
+		for( pxMutex = pxTCB->pxMutexesHeld; pxMutex != NULL; pxMutex = pxMutex->pxNextHeldMutex )
+		{
+			uxWaitingPriority = uxTaskEventListGetHighestPriority( pxMutex->pxTasksWaiting );
+
+			if( uxWaitingPriority > uxPriority )
+			{
+				uxPriority = uxWaitingPriority;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		return uxPriority;
+	}
+
+#endif /* configUSE_TRANSITIVE_PRIORITY_INHERITANCE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+
+	static void prvSetInheritedPriority( TCB_t * const pxTCB, const UBaseType_t uxNewPriority )
+	{
+	const UBaseType_t uxPriorityUsedOnEntry = pxTCB->uxPriority;
+	MutexLink_t * const pxMutex = prvGetMutexWaitedFor( pxTCB );
+
+		pxTCB->uxPriority = uxNewPriority;
+
+		/* Only reset the event list item value if the value is not being used
+		for anything else. */
+		if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+		{
+			listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+		{
+			/* There is one ready list per priority, so move the task to the
+			ready list for its new priority. */
+			if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+			{
+				portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, uxTopReadyPriority );
+			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
+
+			prvAddTaskToReadyList( pxTCB );
+		}
+		else if( pxMutex != NULL )
+		{
+			/* The task is blocked on a mutex.  Move it to the position in the
+			list of tasks waiting for the mutex that matches its new priority,
+			so the priority is seen by the mutex's holder when that holder's
+			priority is next calculated. */
+			( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+			prvAddTaskToEventList( pxTCB, pxMutex->pxTasksWaiting );
 		}
 		else
 		{
+			/* The task is in the Blocked, Suspended or pending ready state, so
+			only its priority needs to change. */
 			mtCOVERAGE_TEST_MARKER();
 		}
 	}
 
-#endif /* configUSE_MUTEXES */
+#endif /* configUSE_TRANSITIVE_PRIORITY_INHERITANCE */
 /*-----------------------------------------------------------*/
 
 #if ( portCRITICAL_NESTING_IN_TCB == 1 )
@@ -4282,6 +6103,40 @@ TCB_t *pxTCB;
 #endif /* ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) */
 /*-----------------------------------------------------------*/
 
+#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	static char *prvWriteRunTimeCounterToBuffer( char *pcBuffer, configRUN_TIME_COUNTER_TYPE ulValue )
+	{
+	/* Large enough for the digits of a 64-bit value. */
+	char cDigits[ 20 ];
+	size_t x = 0;
+
+		/* Generate the digits least significant first. */
+		do
+		{
+			cDigits[ x ] = ( char ) ( '0' + ( char ) ( ulValue % ( configRUN_TIME_COUNTER_TYPE ) 10 ) );
+			ulValue /= ( configRUN_TIME_COUNTER_TYPE ) 10;
+			x++;
+		} while( ( ulValue > ( configRUN_TIME_COUNTER_TYPE ) 0 ) && ( x < sizeof( cDigits ) ) );
+
+		/* Then copy them out most significant first. */
+		while( x > ( size_t ) 0 )
+		{
+			x--;
+			*pcBuffer = cDigits[ x ];
+			pcBuffer++;
+		}
+
+		/* Terminate. */
+		*pcBuffer = ( char ) 0x00;
+
+		/* Return the new end of string. */
+		return pcBuffer;
+	}
+
+#endif /* ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
 	void vTaskList( char * pcWriteBuffer )
@@ -4387,7 +6242,7 @@ TCB_t *pxTCB;
 	{
 	TaskStatus_t *pxTaskStatusArray;
 	UBaseType_t uxArraySize, x;
-	uint32_t ulTotalTime, ulStatsAsPercentage;
+	configRUN_TIME_COUNTER_TYPE ulTotalTime, ulStatsAsPercentage;
 
 		#if( configUSE_TRACE_FACILITY != 1 )
 		{
@@ -4456,17 +6311,24 @@ TCB_t *pxTCB;
 					easily. */
 					pcWriteBuffer = prvWriteNameToBuffer( pcWriteBuffer, pxTaskStatusArray[ x ].pcTaskName );
 
+					/* Write the task's run time.  configRUN_TIME_COUNTER_TYPE
+					can be wider than any type the sprintf() implementation can
+					print, so the digits are written directly. */
+					*pcWriteBuffer = '\t';
+					pcWriteBuffer++;
+					pcWriteBuffer = prvWriteRunTimeCounterToBuffer( pcWriteBuffer, pxTaskStatusArray[ x ].ulRunTimeCounter );
+
 					if( ulStatsAsPercentage > 0UL )
 					{
 						#ifdef portLU_PRINTF_SPECIFIER_REQUIRED
 						{
-							sprintf( pcWriteBuffer, "\t%lu\t\t%lu%%\r\n", pxTaskStatusArray[ x ].ulRunTimeCounter, ulStatsAsPercentage );
+							sprintf( pcWriteBuffer, "\t\t%lu%%\r\n", ( unsigned long ) ulStatsAsPercentage );
 						}
 						#else
 						{
 							/* sizeof( int ) == sizeof( long ) so a smaller
 							printf() library can be used. */
-							sprintf( pcWriteBuffer, "\t%u\t\t%u%%\r\n", ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter, ( unsigned int ) ulStatsAsPercentage ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
+							sprintf( pcWriteBuffer, "\t\t%u%%\r\n", ( unsigned int ) ulStatsAsPercentage ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
 						}
 						#endif
 					}
@@ -4474,17 +6336,7 @@ TCB_t *pxTCB;
 					{
 						/* If the percentage is zero here then the task has
 						consumed less than 1% of the total run time. */
-						#ifdef portLU_PRINTF_SPECIFIER_REQUIRED
-						{
-							sprintf( pcWriteBuffer, "\t%lu\t\t<1%%\r\n", pxTaskStatusArray[ x ].ulRunTimeCounter );
-						}
-						#else
-						{
-							/* sizeof( int ) == sizeof( long ) so a smaller
-							printf() library can be used. */
-							sprintf( pcWriteBuffer, "\t%u\t\t<1%%\r\n", ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
-						}
-						#endif
+						strcpy( pcWriteBuffer, "\t\t<1%\r\n" );
 					}
 
 					pcWriteBuffer += strlen( pcWriteBuffer ); /*lint !e9016 Pointer arithmetic ok on char pointers especially as in this case where it best denotes the intent of the code. */
@@ -4541,17 +6393,19 @@ TickType_t uxReturn;
 
 #if( configUSE_TASK_NOTIFICATIONS == 1 )
 
-	uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait )
+	uint32_t ulTaskGenericNotifyTake( UBaseType_t uxIndexToWaitOn, BaseType_t xClearCountOnExit, TickType_t xTicksToWait )
 	{
 	uint32_t ulReturn;
 
+		configASSERT( uxIndexToWaitOn < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
 		taskENTER_CRITICAL();
 		{
 			/* Only block if the notification count is not already non-zero. */
-			if( pxCurrentTCB->ulNotifiedValue == 0UL )
+			if( pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ] == 0UL )
 			{
 				/* Mark this task as waiting for a notification. */
-				pxCurrentTCB->ucNotifyState = taskWAITING_NOTIFICATION;
+				pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] = taskWAITING_NOTIFICATION;
 
 				if( xTicksToWait > ( TickType_t ) 0 )
 				{
@@ -4579,17 +6433,17 @@ TickType_t uxReturn;
 		taskENTER_CRITICAL();
 		{
 			traceTASK_NOTIFY_TAKE();
-			ulReturn = pxCurrentTCB->ulNotifiedValue;
+			ulReturn = pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ];
 
 			if( ulReturn != 0UL )
 			{
 				if( xClearCountOnExit != pdFALSE )
 				{
-					pxCurrentTCB->ulNotifiedValue = 0UL;
+					pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ] = 0UL;
 				}
 				else
 				{
-					pxCurrentTCB->ulNotifiedValue = ulReturn - ( uint32_t ) 1;
+					pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ] = ulReturn - ( uint32_t ) 1;
 				}
 			}
 			else
@@ -4597,7 +6451,7 @@ TickType_t uxReturn;
 				mtCOVERAGE_TEST_MARKER();
 			}
 
-			pxCurrentTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+			pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] = taskNOT_WAITING_NOTIFICATION;
 		}
 		taskEXIT_CRITICAL();
 
@@ -4609,22 +6463,24 @@ TickType_t uxReturn;
 
 #if( configUSE_TASK_NOTIFICATIONS == 1 )
 
-	BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait )
+	BaseType_t xTaskGenericNotifyWait( UBaseType_t uxIndexToWaitOn, uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait )
 	{
 	BaseType_t xReturn;
 
+		configASSERT( uxIndexToWaitOn < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
 		taskENTER_CRITICAL();
 		{
 			/* Only block if a notification is not already pending. */
-			if( pxCurrentTCB->ucNotifyState != taskNOTIFICATION_RECEIVED )
+			if( pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] != taskNOTIFICATION_RECEIVED )
 			{
 				/* Clear bits in the task's notification value as bits may get
 				set	by the notifying task or interrupt.  This can be used to
 				clear the value to zero. */
-				pxCurrentTCB->ulNotifiedValue &= ~ulBitsToClearOnEntry;
+				pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ] &= ~ulBitsToClearOnEntry;
 
 				/* Mark this task as waiting for a notification. */
-				pxCurrentTCB->ucNotifyState = taskWAITING_NOTIFICATION;
+				pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] = taskWAITING_NOTIFICATION;
 
 				if( xTicksToWait > ( TickType_t ) 0 )
 				{
@@ -4657,14 +6513,14 @@ TickType_t uxReturn;
 			{
 				/* Output the current notification value, which may or may not
 				have changed. */
-				*pulNotificationValue = pxCurrentTCB->ulNotifiedValue;
+				*pulNotificationValue = pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ];
 			}
 
 			/* If ucNotifyValue is set then either the task never entered the
 			blocked state (because a notification was already pending) or the
 			task unblocked because of a notification.  Otherwise the task
 			unblocked because of a timeout. */
-			if( pxCurrentTCB->ucNotifyState != taskNOTIFICATION_RECEIVED )
+			if( pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] != taskNOTIFICATION_RECEIVED )
 			{
 				/* A notification was not received. */
 				xReturn = pdFALSE;
@@ -4673,11 +6529,11 @@ TickType_t uxReturn;
 			{
 				/* A notification was already pending or a notification was
 				received while the task was waiting. */
-				pxCurrentTCB->ulNotifiedValue &= ~ulBitsToClearOnExit;
+				pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ] &= ~ulBitsToClearOnExit;
 				xReturn = pdTRUE;
 			}
 
-			pxCurrentTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+			pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] = taskNOT_WAITING_NOTIFICATION;
 		}
 		taskEXIT_CRITICAL();
 
@@ -4689,44 +6545,45 @@ TickType_t uxReturn;
 
 #if( configUSE_TASK_NOTIFICATIONS == 1 )
 
-	BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue )
+	BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue )
 	{
 	TCB_t * pxTCB;
 	BaseType_t xReturn = pdPASS;
 	uint8_t ucOriginalNotifyState;
 
 		configASSERT( xTaskToNotify );
+		configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
 		pxTCB = xTaskToNotify;
 
 		taskENTER_CRITICAL();
 		{
 			if( pulPreviousNotificationValue != NULL )
 			{
-				*pulPreviousNotificationValue = pxTCB->ulNotifiedValue;
+				*pulPreviousNotificationValue = pxTCB->ulNotifiedValue[ uxIndexToNotify ];
 			}
 
-			ucOriginalNotifyState = pxTCB->ucNotifyState;
+			ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
 
-			pxTCB->ucNotifyState = taskNOTIFICATION_RECEIVED;
+			pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
 
 			switch( eAction )
 			{
 				case eSetBits	:
-					pxTCB->ulNotifiedValue |= ulValue;
+					pxTCB->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
 					break;
 
 				case eIncrement	:
-					( pxTCB->ulNotifiedValue )++;
+					( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
 					break;
 
 				case eSetValueWithOverwrite	:
-					pxTCB->ulNotifiedValue = ulValue;
+					pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
 					break;
 
 				case eSetValueWithoutOverwrite :
 					if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
 					{
-						pxTCB->ulNotifiedValue = ulValue;
+						pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
 					}
 					else
 					{
@@ -4744,7 +6601,7 @@ TickType_t uxReturn;
 					/* Should not get here if all enums are handled.
 					Artificially force an assert by testing a value the
 					compiler can't assume is const. */
-					configASSERT( pxTCB->ulNotifiedValue == ~0UL );
+					configASSERT( pxTCB->ulNotifiedValue[ uxIndexToNotify ] == ~0UL );
 
 					break;
 			}
@@ -4803,7 +6660,7 @@ TickType_t uxReturn;
 
 #if( configUSE_TASK_NOTIFICATIONS == 1 )
 
-	BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue, BaseType_t *pxHigherPriorityTaskWoken )
+	BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue, BaseType_t *pxHigherPriorityTaskWoken )
 	{
 	TCB_t * pxTCB;
 	uint8_t ucOriginalNotifyState;
@@ -4811,6 +6668,7 @@ TickType_t uxReturn;
 	UBaseType_t uxSavedInterruptStatus;
 
 		configASSERT( xTaskToNotify );
+		configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
 
 		/* RTOS ports that support interrupt nesting have the concept of a
 		maximum	system call (or maximum API call) interrupt priority.
@@ -4836,30 +6694,30 @@ TickType_t uxReturn;
 		{
 			if( pulPreviousNotificationValue != NULL )
 			{
-				*pulPreviousNotificationValue = pxTCB->ulNotifiedValue;
+				*pulPreviousNotificationValue = pxTCB->ulNotifiedValue[ uxIndexToNotify ];
 			}
 
-			ucOriginalNotifyState = pxTCB->ucNotifyState;
-			pxTCB->ucNotifyState = taskNOTIFICATION_RECEIVED;
+			ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
+			pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
 
 			switch( eAction )
 			{
 				case eSetBits	:
-					pxTCB->ulNotifiedValue |= ulValue;
+					pxTCB->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
 					break;
 
 				case eIncrement	:
-					( pxTCB->ulNotifiedValue )++;
+					( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
 					break;
 
 				case eSetValueWithOverwrite	:
-					pxTCB->ulNotifiedValue = ulValue;
+					pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
 					break;
 
 				case eSetValueWithoutOverwrite :
 					if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
 					{
-						pxTCB->ulNotifiedValue = ulValue;
+						pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
 					}
 					else
 					{
@@ -4877,7 +6735,7 @@ TickType_t uxReturn;
 					/* Should not get here if all enums are handled.
 					Artificially force an assert by testing a value the
 					compiler can't assume is const. */
-					configASSERT( pxTCB->ulNotifiedValue == ~0UL );
+					configASSERT( pxTCB->ulNotifiedValue[ uxIndexToNotify ] == ~0UL );
 					break;
 			}
 
@@ -4932,13 +6790,14 @@ TickType_t uxReturn;
 
 #if( configUSE_TASK_NOTIFICATIONS == 1 )
 
-	void vTaskNotifyGiveFromISR( TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPriorityTaskWoken )
+	void vTaskGenericNotifyGiveFromISR( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, BaseType_t *pxHigherPriorityTaskWoken )
 	{
 	TCB_t * pxTCB;
 	uint8_t ucOriginalNotifyState;
 	UBaseType_t uxSavedInterruptStatus;
 
 		configASSERT( xTaskToNotify );
+		configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
 
 		/* RTOS ports that support interrupt nesting have the concept of a
 		maximum	system call (or maximum API call) interrupt priority.
@@ -4962,12 +6821,12 @@ TickType_t uxReturn;
 
 		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
 		{
-			ucOriginalNotifyState = pxTCB->ucNotifyState;
-			pxTCB->ucNotifyState = taskNOTIFICATION_RECEIVED;
+			ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
+			pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
 
 			/* 'Giving' is equivalent to incrementing a count in a counting
 			semaphore. */
-			( pxTCB->ulNotifiedValue )++;
+			( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
 
 			traceTASK_NOTIFY_GIVE_FROM_ISR();
 
@@ -5019,20 +6878,22 @@ TickType_t uxReturn;
 
 #if( configUSE_TASK_NOTIFICATIONS == 1 )
 
-	BaseType_t xTaskNotifyStateClear( TaskHandle_t xTask )
+	BaseType_t xTaskGenericNotifyStateClear( TaskHandle_t xTask, UBaseType_t uxIndexToClear )
 	{
 	TCB_t *pxTCB;
 	BaseType_t xReturn;
 
+		configASSERT( uxIndexToClear < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
 		/* If null is passed in here then it is the calling task that is having
 		its notification state cleared. */
 		pxTCB = prvGetTCBFromHandle( xTask );
 
 		taskENTER_CRITICAL();
 		{
-			if( pxTCB->ucNotifyState == taskNOTIFICATION_RECEIVED )
+			if( pxTCB->ucNotifyState[ uxIndexToClear ] == taskNOTIFICATION_RECEIVED )
 			{
-				pxTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+				pxTCB->ucNotifyState[ uxIndexToClear ] = taskNOT_WAITING_NOTIFICATION;
 				xReturn = pdPASS;
 			}
 			else
@@ -5092,24 +6953,72 @@ const TickType_t xConstTickCount = xTickCount;
 			kernel will manage it correctly. */
 			xTimeToWake = xConstTickCount + xTicksToWait;
 
+			#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+			{
+				prvAddCurrentTaskToDelayedTaskWheel( xTimeToWake, xConstTickCount );
+			}
+			#else
+			{
+				/* The list item will be inserted in wake time order. */
+				listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
+
+				if( xTimeToWake < xConstTickCount )
+				{
+					/* Wake time has overflowed.  Place this item in the overflow
+					list. */
+					vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+				}
+				else
+				{
+					/* The wake time has not overflowed, so the current block list
+					is used. */
+					vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+
+					/* If the task entering the blocked state was placed at the
+					head of the list of blocked tasks then xNextTaskUnblockTime
+					needs to be updated too. */
+					if( xTimeToWake < xNextTaskUnblockTime )
+					{
+						xNextTaskUnblockTime = xTimeToWake;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+			}
+			#endif /* configUSE_DELAYED_TASK_WHEEL */
+		}
+	}
+	#else /* INCLUDE_vTaskSuspend */
+	{
+		/* Calculate the time at which the task should be woken if the event
+		does not occur.  This may overflow but this doesn't matter, the kernel
+		will manage it correctly. */
+		xTimeToWake = xConstTickCount + xTicksToWait;
+
+		#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+		{
+			prvAddCurrentTaskToDelayedTaskWheel( xTimeToWake, xConstTickCount );
+		}
+		#else
+		{
 			/* The list item will be inserted in wake time order. */
 			listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
 			if( xTimeToWake < xConstTickCount )
 			{
-				/* Wake time has overflowed.  Place this item in the overflow
-				list. */
+				/* Wake time has overflowed.  Place this item in the overflow list. */
 				vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
 			}
 			else
 			{
-				/* The wake time has not overflowed, so the current block list
-				is used. */
+				/* The wake time has not overflowed, so the current block list is used. */
 				vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
 
-				/* If the task entering the blocked state was placed at the
-				head of the list of blocked tasks then xNextTaskUnblockTime
-				needs to be updated too. */
+				/* If the task entering the blocked state was placed at the head of the
+				list of blocked tasks then xNextTaskUnblockTime needs to be updated
+				too. */
 				if( xTimeToWake < xNextTaskUnblockTime )
 				{
 					xNextTaskUnblockTime = xTimeToWake;
@@ -5120,45 +7029,255 @@ const TickType_t xConstTickCount = xTickCount;
 				}
 			}
 		}
+		#endif /* configUSE_DELAYED_TASK_WHEEL */
+
+		/* Avoid compiler warning when INCLUDE_vTaskSuspend is not 1. */
+		( void ) xCanBlockIndefinitely;
 	}
-	#else /* INCLUDE_vTaskSuspend */
+	#endif /* INCLUDE_vTaskSuspend */
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+	static void prvAddCurrentTaskToDelayedTaskWheel( TickType_t xTimeToWake, const TickType_t xConstTickCount )
 	{
-		/* Calculate the time at which the task should be woken if the event
-		does not occur.  This may overflow but this doesn't matter, the kernel
-		will manage it correctly. */
-		xTimeToWake = xConstTickCount + xTicksToWait;
+	TickType_t xEventTime;
+	List_t *pxList;
+
+		/* The wheel has already been turned to the current tick count, so a
+		task that is to wake now cannot be woken before the next tick. */
+		if( xTimeToWake == xConstTickCount )
+		{
+			xTimeToWake++;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-		/* The list item will be inserted in wake time order. */
+		/* The item value records the wake time so the task can be moved to a
+		lower level as the wheel turns.  The lists are not sorted, so the task
+		is simply added to the end of its list. */
 		listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
+		pxList = prvGetDelayedTaskWheelList( xTimeToWake, xConstTickCount, &xEventTime );
+		vListInsertEnd( pxList, &( pxCurrentTCB->xStateListItem ) );
+
+		/* As with the delayed lists, xNextTaskUnblockTime only tracks times
+		that have not overflowed the tick count. */
+		if( ( xEventTime > xConstTickCount ) && ( xEventTime < xNextTaskUnblockTime ) )
+		{
+			xNextTaskUnblockTime = xEventTime;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static List_t * prvGetDelayedTaskWheelList( const TickType_t xTimeToWake, const TickType_t xWheelTime, TickType_t * const pxEventTime )
+	{
+	const TickType_t xDifference = xTimeToWake ^ xWheelTime;
+	List_t *pxList;
 
-		if( xTimeToWake < xConstTickCount )
+		/* A task that is due in the same group as the wheel time goes in the
+		first level, and a task that is due in a later group of the same
+		revolution goes in the second level, where it is handled at the start
+		of its group.  Any other task, including one whose wake time has
+		overflowed the tick count, stays in the overflow list until the start of
+		the next revolution. */
+		if( xTimeToWake < xWheelTime )
+		{
+			pxList = &xDelayedTaskWheelOverflowList;
+			*pxEventTime = ( TickType_t ) ( ( xWheelTime | taskDELAYED_TASK_WHEEL_REVOLUTION_MASK ) + ( TickType_t ) 1U );
+		}
+		else if( ( xDifference / taskDELAYED_TASK_WHEEL_SIZE ) == ( TickType_t ) 0U )
+		{
+			pxList = &( xDelayedTaskWheelLevel0[ xTimeToWake & taskDELAYED_TASK_WHEEL_MASK ] );
+			*pxEventTime = xTimeToWake;
+		}
+		else if( ( ( xDifference / taskDELAYED_TASK_WHEEL_SIZE ) / taskDELAYED_TASK_WHEEL_SIZE ) == ( TickType_t ) 0U )
 		{
-			/* Wake time has overflowed.  Place this item in the overflow list. */
-			vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+			pxList = &( xDelayedTaskWheelLevel1[ ( xTimeToWake / taskDELAYED_TASK_WHEEL_SIZE ) & taskDELAYED_TASK_WHEEL_MASK ] );
+			*pxEventTime = xTimeToWake - ( xTimeToWake & taskDELAYED_TASK_WHEEL_MASK );
 		}
 		else
 		{
-			/* The wake time has not overflowed, so the current block list is used. */
-			vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+			pxList = &xDelayedTaskWheelOverflowList;
+			*pxEventTime = ( TickType_t ) ( ( xWheelTime | taskDELAYED_TASK_WHEEL_REVOLUTION_MASK ) + ( TickType_t ) 1U );
+		}
+
+		return pxList;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvCascadeDelayedTaskList( List_t * const pxList, const TickType_t xWheelTime )
+	{
+	ListItem_t const * const pxEndMarker = listGET_END_MARKER( pxList );
+	ListItem_t *pxItem, *pxNextItem;
+	List_t *pxNewList;
+	TickType_t xEventTime;
+
+		/* Tasks that are not yet due to leave the overflow list are left where
+		they are.  A task is never moved to the list being walked, so each task
+		is only visited once. */
+		pxItem = listGET_HEAD_ENTRY( pxList );
+
+		while( pxItem != pxEndMarker )
+		{
+			/* Note the next item before this item is moved. */
+			pxNextItem = listGET_NEXT( pxItem );
+			pxNewList = prvGetDelayedTaskWheelList( listGET_LIST_ITEM_VALUE( pxItem ), xWheelTime, &xEventTime );
 
-			/* If the task entering the blocked state was placed at the head of the
-			list of blocked tasks then xNextTaskUnblockTime needs to be updated
-			too. */
-			if( xTimeToWake < xNextTaskUnblockTime )
+			if( pxNewList != pxList )
 			{
-				xNextTaskUnblockTime = xTimeToWake;
+				( void ) uxListRemove( pxItem );
+				vListInsertEnd( pxNewList, pxItem );
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
+
+			pxItem = pxNextItem;
 		}
+	}
+	/*-----------------------------------------------------------*/
 
-		/* Avoid compiler warning when INCLUDE_vTaskSuspend is not 1. */
-		( void ) xCanBlockIndefinitely;
+	static BaseType_t prvTurnDelayedTaskWheel( const TickType_t xWheelTime, UBaseType_t * const puxHighestReadiedPriority )
+	{
+	List_t * const pxSlot = &( xDelayedTaskWheelLevel0[ xWheelTime & taskDELAYED_TASK_WHEEL_MASK ] );
+	TCB_t *pxTCB;
+	BaseType_t xTaskReadied = pdFALSE;
+
+		if( ( xWheelTime & taskDELAYED_TASK_WHEEL_MASK ) == ( TickType_t ) 0U )
+		{
+			/* A new group starts, so the tasks that are due in it move down
+			from the second level - after the tasks that are due in this
+			revolution have moved out of the overflow list if a new revolution
+			also starts. */
+			if( ( ( xWheelTime / taskDELAYED_TASK_WHEEL_SIZE ) & taskDELAYED_TASK_WHEEL_MASK ) == ( TickType_t ) 0U )
+			{
+				prvCascadeDelayedTaskList( &xDelayedTaskWheelOverflowList, xWheelTime );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			prvCascadeDelayedTaskList( &( xDelayedTaskWheelLevel1[ ( xWheelTime / taskDELAYED_TASK_WHEEL_SIZE ) & taskDELAYED_TASK_WHEEL_MASK ] ), xWheelTime );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Every task in the first level slot for the wheel time is due. */
+		while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+		{
+			pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxSlot ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+			prvMoveDelayedTaskToReadyList( pxTCB );
+			xTaskReadied = pdTRUE;
+
+			if( pxTCB->uxPriority > *puxHighestReadiedPriority )
+			{
+				*puxHighestReadiedPriority = pxTCB->uxPriority;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		return xTaskReadied;
 	}
-	#endif /* INCLUDE_vTaskSuspend */
-}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvGetNextDelayedTaskWheelEvent( const TickType_t xWheelTime, const TickType_t xMaxTicksAhead, TickType_t * const pxNextEventTime )
+	{
+	TickType_t xTime = xWheelTime + ( TickType_t ) 1U, xTicksAhead = ( TickType_t ) 1U;
+	BaseType_t xFound = pdFALSE, xEndOfSearch = pdFALSE;
+
+		/* The first level only holds tasks that are due later in the current
+		group, so the first occupied slot after the wheel time gives the next
+		wake time. */
+		while( ( xFound == pdFALSE ) && ( xTicksAhead <= xMaxTicksAhead ) && ( ( xTime & taskDELAYED_TASK_WHEEL_MASK ) != ( TickType_t ) 0U ) )
+		{
+			if( listLIST_IS_EMPTY( &( xDelayedTaskWheelLevel0[ xTime & taskDELAYED_TASK_WHEEL_MASK ] ) ) == pdFALSE )
+			{
+				xFound = pdTRUE;
+			}
+			else
+			{
+				xTime++;
+				xTicksAhead++;
+			}
+		}
+
+		/* Otherwise the wheel must next be turned at the start of the first
+		later group that has tasks in the second level, or at the start of the
+		next revolution if there are tasks in the overflow list.  The ticks
+		searched are counted, rather than times compared, so the search stops
+		at xMaxTicksAhead even if the tick count overflows. */
+		while( ( xFound == pdFALSE ) && ( xEndOfSearch == pdFALSE ) && ( xTicksAhead <= xMaxTicksAhead ) )
+		{
+			if( ( ( xTime / taskDELAYED_TASK_WHEEL_SIZE ) & taskDELAYED_TASK_WHEEL_MASK ) == ( TickType_t ) 0U )
+			{
+				if( listLIST_IS_EMPTY( &xDelayedTaskWheelOverflowList ) == pdFALSE )
+				{
+					xFound = pdTRUE;
+				}
+				else
+				{
+					xEndOfSearch = pdTRUE;
+				}
+			}
+			else if( listLIST_IS_EMPTY( &( xDelayedTaskWheelLevel1[ ( xTime / taskDELAYED_TASK_WHEEL_SIZE ) & taskDELAYED_TASK_WHEEL_MASK ] ) ) == pdFALSE )
+			{
+				xFound = pdTRUE;
+			}
+			else if( ( xMaxTicksAhead - xTicksAhead ) < taskDELAYED_TASK_WHEEL_SIZE )
+			{
+				xEndOfSearch = pdTRUE;
+			}
+			else
+			{
+				xTime += taskDELAYED_TASK_WHEEL_SIZE;
+				xTicksAhead += taskDELAYED_TASK_WHEEL_SIZE;
+			}
+		}
+
+		*pxNextEventTime = xTime;
+
+		return xFound;
+	}
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_DELAYED_TASK_WHEEL == 1 ) && ( configUSE_TICKLESS_IDLE != 0 ) )
+
+	static TickType_t prvGetNextTaskUnblockTimeFromWheel( void )
+	{
+	TickType_t xNextUnblockTime;
+
+		/* Times at or beyond portMAX_DELAY cannot be represented, and any time
+		after an overflow of the tick count is not tracked by
+		xNextTaskUnblockTime, so the search stops at portMAX_DELAY. */
+		if( prvGetNextDelayedTaskWheelEvent( xTickCount, portMAX_DELAY - xTickCount, &xNextUnblockTime ) == pdFALSE )
+		{
+			xNextUnblockTime = portMAX_DELAY;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xNextUnblockTime;
+	}
+
+#endif /* ( configUSE_DELAYED_TASK_WHEEL == 1 ) && ( configUSE_TICKLESS_IDLE != 0 ) */
 
 /* Code below here allows additional code to be inserted into this source file,
 especially where access to file scope functions and data is needed (for example
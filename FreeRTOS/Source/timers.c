@@ -37,6 +37,7 @@ task.h is included from an application file. */
 #include "task.h"
 #include "queue.h"
 #include "timers.h"
+#include "object_pool.h"
 
 #if ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 0 )
 	#error configUSE_TIMERS must be set to 1 to make the xTimerPendFunctionCall() function available.
@@ -64,6 +65,11 @@ defining trmTIMER_SERVICE_TASK_NAME in FreeRTOSConfig.h. */
 	#define configTIMER_SERVICE_TASK_NAME "Tmr Svc"
 #endif
 
+/* The number of slots in each level of the timer wheel, and the mask used to
+obtain a slot index, when configUSE_TIMER_WHEEL is 1. */
+#define tmrWHEEL_SIZE						( ( TickType_t ) configTIMER_WHEEL_SIZE )
+#define tmrWHEEL_MASK						( tmrWHEEL_SIZE - ( TickType_t ) 1 )
+
 /* Bit definitions used in the ucStatus member of a timer structure. */
 #define tmrSTATUS_IS_ACTIVE					( ( uint8_t ) 0x01 )
 #define tmrSTATUS_IS_STATICALLY_ALLOCATED	( ( uint8_t ) 0x02 )
@@ -132,15 +138,41 @@ timer service task is allowed to access these lists.
 xActiveTimerList1 and xActiveTimerList2 could be at function scope but that
 breaks some kernel aware debuggers, and debuggers that reply on removing the
 static qualifier. */
-PRIVILEGED_DATA static List_t xActiveTimerList1;
-PRIVILEGED_DATA static List_t xActiveTimerList2;
-PRIVILEGED_DATA static List_t *pxCurrentTimerList;
-PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+#if( configUSE_TIMER_WHEEL == 0 )
+	PRIVILEGED_DATA static List_t xActiveTimerList1;
+	PRIVILEGED_DATA static List_t xActiveTimerList2;
+	PRIVILEGED_DATA static List_t *pxCurrentTimerList;
+	PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+#else
+	/* When configUSE_TIMER_WHEEL is 1 the active timers are instead held in
+	unsorted lists, so starting or stopping a timer takes a constant time.  The
+	wheel turns to each time at which the timer service task has something to
+	do, which is recorded in xTimerWheelTime.  The first level holds the timers
+	that expire later in the same group of tmrWHEEL_SIZE ticks as
+	xTimerWheelTime, by expiry time.  The second level holds the timers that
+	expire in later groups of the same revolution of tmrWHEEL_SIZE groups, by
+	group.  All other timers are held in the overflow list. */
+	PRIVILEGED_DATA static List_t xTimerWheelLevel0[ configTIMER_WHEEL_SIZE ];
+	PRIVILEGED_DATA static List_t xTimerWheelLevel1[ configTIMER_WHEEL_SIZE ];
+	PRIVILEGED_DATA static List_t xTimerWheelOverflowList;
+	PRIVILEGED_DATA static TickType_t xTimerWheelTime = ( TickType_t ) 0U;
+#endif /* configUSE_TIMER_WHEEL */
 
 /* A queue that is used to send commands to the timer service task. */
 PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
 PRIVILEGED_DATA static TaskHandle_t xTimerTaskHandle = NULL;
 
+/* Timers that are created dynamically are taken from a pool, rather than the
+heap, when configTIMER_POOL_SIZE is not 0. */
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configTIMER_POOL_SIZE > 0 ) )
+	objectpoolDEFINE_POOL( xTimerPool, ucTimerPoolStorage, sizeof( Timer_t ), configTIMER_POOL_SIZE );
+	#define tmrMALLOC( xSize )		pvObjectPoolMalloc( &xTimerPool, ( xSize ) )
+	#define tmrFREE( pv )			vObjectPoolFree( &xTimerPool, ( pv ) )
+#else
+	#define tmrMALLOC( xSize )		pvPortMalloc( xSize )
+	#define tmrFREE( pv )			vPortFree( pv )
+#endif /* configTIMER_POOL_SIZE */
+
 /*lint -restore */
 
 /*-----------------------------------------------------------*/
@@ -176,21 +208,50 @@ static void prvProcessReceivedCommands( void ) PRIVILEGED_FUNCTION;
 
 /*
  * Insert the timer into either xActiveTimerList1, or xActiveTimerList2,
- * depending on if the expire time causes a timer counter overflow.
+ * depending on if the expire time causes a timer counter overflow.  When
+ * configUSE_TIMER_WHEEL is 1 the timer is instead placed in the timer wheel.
  */
 static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime ) PRIVILEGED_FUNCTION;
 
 /*
  * An active timer has reached its expire time.  Reload the timer if it is an
- * auto reload timer, then call its callback.
+ * auto reload timer, then call its callback.  When configUSE_TIMER_WHEEL is 1
+ * the wheel is turned to xNextExpireTime and all the timers that expire at that
+ * time are processed together.
  */
 static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
 
-/*
- * The tick count has overflowed.  Switch the timer lists after ensuring the
- * current timer list does not still reference some timers.
- */
-static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+#if( configUSE_TIMER_WHEEL == 0 )
+
+	/*
+	 * The tick count has overflowed.  Switch the timer lists after ensuring the
+	 * current timer list does not still reference some timers.
+	 */
+	static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+
+#else
+
+	/*
+	 * Place an active timer in the level of the timer wheel that matches how far
+	 * its expiry time is from xTimerWheelTime.
+	 */
+	static void prvPlaceTimerInWheel( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Place each timer that is in pxList in the timer wheel again, after the
+	 * wheel has turned far enough for the timers to move to a lower level.
+	 */
+	static void prvCascadeTimerList( List_t * const pxList ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * If the timer wheel contains any active timers then set *pxNextEventTime
+	 * to the next time at which the wheel must be turned, either because timers
+	 * expire or because timers must move to a lower level, and return pdTRUE.
+	 * Otherwise return pdFALSE.
+	 */
+	static BaseType_t prvGetNextTimerWheelEvent( TickType_t * const pxNextEventTime ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TIMER_WHEEL */
 
 /*
  * Obtain the current tick count, setting *pxTimerListsWereSwitched to pdTRUE
@@ -287,7 +348,7 @@ BaseType_t xReturn = pdFAIL;
 	{
 	Timer_t *pxNewTimer;
 
-		pxNewTimer = ( Timer_t * ) pvPortMalloc( sizeof( Timer_t ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of Timer_t is always a pointer to the timer's mame. */
+		pxNewTimer = ( Timer_t * ) tmrMALLOC( sizeof( Timer_t ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of Timer_t is always a pointer to the timer's mame. */
 
 		if( pxNewTimer != NULL )
 		{
@@ -459,45 +520,110 @@ Timer_t *pxTimer = xTimer;
 }
 /*-----------------------------------------------------------*/
 
-static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
-{
-BaseType_t xResult;
-Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-
-	/* Remove the timer from the list of active timers.  A check has already
-	been performed to ensure the list is not empty. */
-	( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
-	traceTIMER_EXPIRED( pxTimer );
+#if( configUSE_TIMER_WHEEL == 0 )
 
-	/* If the timer is an auto reload timer then calculate the next
-	expiry time and re-insert the timer in the list of active timers. */
-	if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
+	static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
 	{
-		/* The timer is inserted into a list using a time relative to anything
-		other than the current time.  It will therefore be inserted into the
-		correct list relative to the time this task thinks it is now. */
-		if( prvInsertTimerInActiveList( pxTimer, ( xNextExpireTime + pxTimer->xTimerPeriodInTicks ), xTimeNow, xNextExpireTime ) != pdFALSE )
+	BaseType_t xResult;
+	Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+		/* Remove the timer from the list of active timers.  A check has already
+		been performed to ensure the list is not empty. */
+		( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+		traceTIMER_EXPIRED( pxTimer );
+
+		/* If the timer is an auto reload timer then calculate the next
+		expiry time and re-insert the timer in the list of active timers. */
+		if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
 		{
-			/* The timer expired before it was added to the active timer
-			list.  Reload it now.  */
-			xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xNextExpireTime, NULL, tmrNO_DELAY );
-			configASSERT( xResult );
-			( void ) xResult;
+			/* The timer is inserted into a list using a time relative to anything
+			other than the current time.  It will therefore be inserted into the
+			correct list relative to the time this task thinks it is now. */
+			if( prvInsertTimerInActiveList( pxTimer, ( xNextExpireTime + pxTimer->xTimerPeriodInTicks ), xTimeNow, xNextExpireTime ) != pdFALSE )
+			{
+				/* The timer expired before it was added to the active timer
+				list.  Reload it now.  */
+				xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xNextExpireTime, NULL, tmrNO_DELAY );
+				configASSERT( xResult );
+				( void ) xResult;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
 		else
 		{
+			pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
 			mtCOVERAGE_TEST_MARKER();
 		}
+
+		/* Call the timer callback. */
+		pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
 	}
-	else
+
+#else /* configUSE_TIMER_WHEEL */
+
+	static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
 	{
-		pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
-		mtCOVERAGE_TEST_MARKER();
+	List_t * const pxSlot = &( xTimerWheelLevel0[ xNextExpireTime & tmrWHEEL_MASK ] );
+	Timer_t *pxTimer;
+
+		/* The wheel has caught up with the time at which the timers expire. */
+		( void ) xTimeNow;
+
+		/* Turn the wheel to the expire time.  If the expire time is the start
+		of a group then first move the timers that expire in the group to the
+		first level, and if it is also the start of a revolution then first move
+		the timers that expire in the revolution out of the overflow list. */
+		xTimerWheelTime = xNextExpireTime;
+
+		if( ( xNextExpireTime & tmrWHEEL_MASK ) == ( TickType_t ) 0U )
+		{
+			if( ( ( xNextExpireTime / tmrWHEEL_SIZE ) & tmrWHEEL_MASK ) == ( TickType_t ) 0U )
+			{
+				prvCascadeTimerList( &xTimerWheelOverflowList );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			prvCascadeTimerList( &( xTimerWheelLevel1[ ( xNextExpireTime / tmrWHEEL_SIZE ) & tmrWHEEL_MASK ] ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Every timer in the first level slot for the expire time expires now,
+		so they are all processed in one pass. */
+		while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+		{
+			pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+			( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+			traceTIMER_EXPIRED( pxTimer );
+
+			/* If the timer is an auto reload timer then its next expire time
+			is always after the wheel time, so it can be placed straight back in
+			the wheel.  If the timer service task has fallen more than a period
+			behind then the timer will expire again as the wheel catches up. */
+			if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
+			{
+				listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), ( xNextExpireTime + pxTimer->xTimerPeriodInTicks ) );
+				prvPlaceTimerInWheel( pxTimer );
+			}
+			else
+			{
+				pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
+			}
+
+			/* Call the timer callback. */
+			pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+		}
 	}
 
-	/* Call the timer callback. */
-	pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
-}
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static void prvTimerTask( void *pvParameters )
@@ -536,41 +662,91 @@ BaseType_t xListWasEmpty;
 }
 /*-----------------------------------------------------------*/
 
-static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
-{
-TickType_t xTimeNow;
-BaseType_t xTimerListsWereSwitched;
+#if( configUSE_TIMER_WHEEL == 0 )
+
+	static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
+	{
+	TickType_t xTimeNow;
+	BaseType_t xTimerListsWereSwitched;
+
+		vTaskSuspendAll();
+		{
+			/* Obtain the time now to make an assessment as to whether the timer
+			has expired or not.  If obtaining the time causes the lists to switch
+			then don't process this timer as any timers that remained in the list
+			when the lists were switched will have been processed within the
+			prvSampleTimeNow() function. */
+			xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+			if( xTimerListsWereSwitched == pdFALSE )
+			{
+				/* The tick count has not overflowed, has the timer expired? */
+				if( ( xListWasEmpty == pdFALSE ) && ( xNextExpireTime <= xTimeNow ) )
+				{
+					( void ) xTaskResumeAll();
+					prvProcessExpiredTimer( xNextExpireTime, xTimeNow );
+				}
+				else
+				{
+					/* The tick count has not overflowed, and the next expire
+					time has not been reached yet.  This task should therefore
+					block to wait for the next expire time or a command to be
+					received - whichever comes first.  The following line cannot
+					be reached unless xNextExpireTime > xTimeNow, except in the
+					case when the current timer list is empty. */
+					if( xListWasEmpty != pdFALSE )
+					{
+						/* The current timer list is empty - is the overflow list
+						also empty? */
+						xListWasEmpty = listLIST_IS_EMPTY( pxOverflowTimerList );
+					}
+
+					vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
+
+					if( xTaskResumeAll() == pdFALSE )
+					{
+						/* Yield to wait for either a command to arrive, or the
+						block time to expire.  If a command arrived between the
+						critical section being exited and this yield then the yield
+						will not cause the task to block. */
+						portYIELD_WITHIN_API();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+			}
+			else
+			{
+				( void ) xTaskResumeAll();
+			}
+		}
+	}
 
-	vTaskSuspendAll();
+#else /* configUSE_TIMER_WHEEL */
+
+	static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
 	{
-		/* Obtain the time now to make an assessment as to whether the timer
-		has expired or not.  If obtaining the time causes the lists to switch
-		then don't process this timer as any timers that remained in the list
-		when the lists were switched will have been processed within the
-		prvSampleTimeNow() function. */
-		xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
-		if( xTimerListsWereSwitched == pdFALSE )
+	TickType_t xTimeNow;
+
+		vTaskSuspendAll();
 		{
-			/* The tick count has not overflowed, has the timer expired? */
-			if( ( xListWasEmpty == pdFALSE ) && ( xNextExpireTime <= xTimeNow ) )
+			/* Times are compared relative to the wheel time, which is never
+			ahead of the tick count, so an overflow of the tick count needs no
+			special handling. */
+			xTimeNow = xTaskGetTickCount();
+
+			if( ( xListWasEmpty == pdFALSE ) && ( ( ( TickType_t ) ( xNextExpireTime - xTimerWheelTime ) ) <= ( ( TickType_t ) ( xTimeNow - xTimerWheelTime ) ) ) )
 			{
 				( void ) xTaskResumeAll();
 				prvProcessExpiredTimer( xNextExpireTime, xTimeNow );
 			}
 			else
 			{
-				/* The tick count has not overflowed, and the next expire
-				time has not been reached yet.  This task should therefore
-				block to wait for the next expire time or a command to be
-				received - whichever comes first.  The following line cannot
-				be reached unless xNextExpireTime > xTimeNow, except in the
-				case when the current timer list is empty. */
-				if( xListWasEmpty != pdFALSE )
-				{
-					/* The current timer list is empty - is the overflow list
-					also empty? */
-					xListWasEmpty = listLIST_IS_EMPTY( pxOverflowTimerList );
-				}
+				/* Nothing happens on the wheel before xNextExpireTime, so the
+				wheel can be turned straight to the current time.  That keeps
+				timers that are started from now on close to the first level. */
+				xTimerWheelTime = xTimeNow;
 
 				vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
 
@@ -588,12 +764,9 @@ BaseType_t xTimerListsWereSwitched;
 				}
 			}
 		}
-		else
-		{
-			( void ) xTaskResumeAll();
-		}
 	}
-}
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
@@ -607,16 +780,37 @@ TickType_t xNextExpireTime;
 	this task to unblock when the tick count overflows, at which point the
 	timer lists will be switched and the next expiry time can be
 	re-assessed.  */
-	*pxListWasEmpty = listLIST_IS_EMPTY( pxCurrentTimerList );
-	if( *pxListWasEmpty == pdFALSE )
+	#if( configUSE_TIMER_WHEEL == 0 )
 	{
-		xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+		*pxListWasEmpty = listLIST_IS_EMPTY( pxCurrentTimerList );
+		if( *pxListWasEmpty == pdFALSE )
+		{
+			xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+		}
+		else
+		{
+			/* Ensure the task unblocks when the tick count rolls over. */
+			xNextExpireTime = ( TickType_t ) 0U;
+		}
 	}
-	else
+	#else
 	{
-		/* Ensure the task unblocks when the tick count rolls over. */
-		xNextExpireTime = ( TickType_t ) 0U;
+		/* When the timer wheel is used the next expire time is the next time
+		at which the wheel must be turned, which is not necessarily a time at
+		which a timer expires.  The wheel does not need to be turned when the
+		tick count rolls over, so if it is empty the task can block
+		indefinitely. */
+		if( prvGetNextTimerWheelEvent( &xNextExpireTime ) != pdFALSE )
+		{
+			*pxListWasEmpty = pdFALSE;
+		}
+		else
+		{
+			*pxListWasEmpty = pdTRUE;
+			xNextExpireTime = xTimerWheelTime;
+		}
 	}
+	#endif /* configUSE_TIMER_WHEEL */
 
 	return xNextExpireTime;
 }
@@ -625,21 +819,31 @@ TickType_t xNextExpireTime;
 static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
 {
 TickType_t xTimeNow;
-PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U; /*lint !e956 Variable is only accessible to one task. */
 
 	xTimeNow = xTaskGetTickCount();
 
-	if( xTimeNow < xLastTime )
+	#if( configUSE_TIMER_WHEEL == 0 )
 	{
-		prvSwitchTimerLists();
-		*pxTimerListsWereSwitched = pdTRUE;
+	PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U; /*lint !e956 Variable is only accessible to one task. */
+
+		if( xTimeNow < xLastTime )
+		{
+			prvSwitchTimerLists();
+			*pxTimerListsWereSwitched = pdTRUE;
+		}
+		else
+		{
+			*pxTimerListsWereSwitched = pdFALSE;
+		}
+
+		xLastTime = xTimeNow;
 	}
-	else
+	#else
 	{
+		/* There are no timer lists to switch when the timer wheel is used. */
 		*pxTimerListsWereSwitched = pdFALSE;
 	}
-
-	xLastTime = xTimeNow;
+	#endif /* configUSE_TIMER_WHEEL */
 
 	return xTimeNow;
 }
@@ -652,35 +856,56 @@ BaseType_t xProcessTimerNow = pdFALSE;
 	listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xNextExpiryTime );
 	listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
 
-	if( xNextExpiryTime <= xTimeNow )
+	#if( configUSE_TIMER_WHEEL == 0 )
 	{
-		/* Has the expiry time elapsed between the command to start/reset a
-		timer was issued, and the time the command was processed? */
-		if( ( ( TickType_t ) ( xTimeNow - xCommandTime ) ) >= pxTimer->xTimerPeriodInTicks ) /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		if( xNextExpiryTime <= xTimeNow )
 		{
-			/* The time between a command being issued and the command being
-			processed actually exceeds the timers period.  */
-			xProcessTimerNow = pdTRUE;
+			/* Has the expiry time elapsed between the command to start/reset a
+			timer was issued, and the time the command was processed? */
+			if( ( ( TickType_t ) ( xTimeNow - xCommandTime ) ) >= pxTimer->xTimerPeriodInTicks ) /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+			{
+				/* The time between a command being issued and the command being
+				processed actually exceeds the timers period.  */
+				xProcessTimerNow = pdTRUE;
+			}
+			else
+			{
+				vListInsert( pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+			}
 		}
 		else
 		{
-			vListInsert( pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+			if( ( xTimeNow < xCommandTime ) && ( xNextExpiryTime >= xCommandTime ) )
+			{
+				/* If, since the command was issued, the tick count has overflowed
+				but the expiry time has not, then the timer must have already passed
+				its expiry time and should be processed immediately. */
+				xProcessTimerNow = pdTRUE;
+			}
+			else
+			{
+				vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+			}
 		}
 	}
-	else
+	#else
 	{
-		if( ( xTimeNow < xCommandTime ) && ( xNextExpiryTime >= xCommandTime ) )
+		/* Has the expiry time elapsed between the command to start/reset a
+		timer being issued and the command being processed?  The times are
+		compared relative to the time the command was issued, so it does not
+		matter if the tick count overflowed in between.  If the expiry time has
+		not elapsed then it is after the wheel time, so the timer can be placed
+		in the wheel. */
+		if( ( ( TickType_t ) ( xTimeNow - xCommandTime ) ) >= ( ( TickType_t ) ( xNextExpiryTime - xCommandTime ) ) ) /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 		{
-			/* If, since the command was issued, the tick count has overflowed
-			but the expiry time has not, then the timer must have already passed
-			its expiry time and should be processed immediately. */
 			xProcessTimerNow = pdTRUE;
 		}
 		else
 		{
-			vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+			prvPlaceTimerInWheel( pxTimer );
 		}
 	}
+	#endif /* configUSE_TIMER_WHEEL */
 
 	return xProcessTimerNow;
 }
@@ -805,7 +1030,7 @@ TickType_t xTimeNow;
 					allocated. */
 					if( ( pxTimer->ucStatus & tmrSTATUS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
 					{
-						vPortFree( pxTimer );
+						tmrFREE( pxTimer );
 					}
 					else
 					{
@@ -822,63 +1047,170 @@ TickType_t xTimeNow;
 }
 /*-----------------------------------------------------------*/
 
-static void prvSwitchTimerLists( void )
-{
-TickType_t xNextExpireTime, xReloadTime;
-List_t *pxTemp;
-Timer_t *pxTimer;
-BaseType_t xResult;
+#if( configUSE_TIMER_WHEEL == 0 )
 
-	/* The tick count has overflowed.  The timer lists must be switched.
-	If there are any timers still referenced from the current timer list
-	then they must have expired and should be processed before the lists
-	are switched. */
-	while( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
+	static void prvSwitchTimerLists( void )
 	{
-		xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+	TickType_t xNextExpireTime, xReloadTime;
+	List_t *pxTemp;
+	Timer_t *pxTimer;
+	BaseType_t xResult;
+
+		/* The tick count has overflowed.  The timer lists must be switched.
+		If there are any timers still referenced from the current timer list
+		then they must have expired and should be processed before the lists
+		are switched. */
+		while( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
+		{
+			xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
 
-		/* Remove the timer from the list. */
-		pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-		( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
-		traceTIMER_EXPIRED( pxTimer );
+			/* Remove the timer from the list. */
+			pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+			( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+			traceTIMER_EXPIRED( pxTimer );
 
-		/* Execute its callback, then send a command to restart the timer if
-		it is an auto-reload timer.  It cannot be restarted here as the lists
-		have not yet been switched. */
-		pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+			/* Execute its callback, then send a command to restart the timer if
+			it is an auto-reload timer.  It cannot be restarted here as the lists
+			have not yet been switched. */
+			pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
 
-		if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
-		{
-			/* Calculate the reload value, and if the reload value results in
-			the timer going into the same timer list then it has already expired
-			and the timer should be re-inserted into the current list so it is
-			processed again within this loop.  Otherwise a command should be sent
-			to restart the timer to ensure it is only inserted into a list after
-			the lists have been swapped. */
-			xReloadTime = ( xNextExpireTime + pxTimer->xTimerPeriodInTicks );
-			if( xReloadTime > xNextExpireTime )
+			if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
 			{
-				listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xReloadTime );
-				listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
-				vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+				/* Calculate the reload value, and if the reload value results in
+				the timer going into the same timer list then it has already expired
+				and the timer should be re-inserted into the current list so it is
+				processed again within this loop.  Otherwise a command should be sent
+				to restart the timer to ensure it is only inserted into a list after
+				the lists have been swapped. */
+				xReloadTime = ( xNextExpireTime + pxTimer->xTimerPeriodInTicks );
+				if( xReloadTime > xNextExpireTime )
+				{
+					listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xReloadTime );
+					listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+					vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+				}
+				else
+				{
+					xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xNextExpireTime, NULL, tmrNO_DELAY );
+					configASSERT( xResult );
+					( void ) xResult;
+				}
 			}
 			else
 			{
-				xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xNextExpireTime, NULL, tmrNO_DELAY );
-				configASSERT( xResult );
-				( void ) xResult;
+				mtCOVERAGE_TEST_MARKER();
 			}
 		}
+
+		pxTemp = pxCurrentTimerList;
+		pxCurrentTimerList = pxOverflowTimerList;
+		pxOverflowTimerList = pxTemp;
+	}
+
+#else /* configUSE_TIMER_WHEEL */
+
+	static void prvPlaceTimerInWheel( Timer_t * const pxTimer )
+	{
+	const TickType_t xExpiryTime = listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) );
+	const TickType_t xDifference = xExpiryTime ^ xTimerWheelTime;
+	List_t *pxList;
+
+		/* A timer that expires in the same group as the wheel time goes in the
+		first level, and a timer that expires in a later group of the same
+		revolution goes in the second level.  Any other timer, including one
+		whose expiry time has overflowed the tick count, stays in the overflow
+		list until the wheel reaches its revolution. */
+		if( xExpiryTime < xTimerWheelTime )
+		{
+			pxList = &xTimerWheelOverflowList;
+		}
+		else if( ( xDifference / tmrWHEEL_SIZE ) == ( TickType_t ) 0U )
+		{
+			pxList = &( xTimerWheelLevel0[ xExpiryTime & tmrWHEEL_MASK ] );
+		}
+		else if( ( ( xDifference / tmrWHEEL_SIZE ) / tmrWHEEL_SIZE ) == ( TickType_t ) 0U )
+		{
+			pxList = &( xTimerWheelLevel1[ ( xExpiryTime / tmrWHEEL_SIZE ) & tmrWHEEL_MASK ] );
+		}
 		else
 		{
-			mtCOVERAGE_TEST_MARKER();
+			pxList = &xTimerWheelOverflowList;
 		}
+
+		vListInsertEnd( pxList, &( pxTimer->xTimerListItem ) );
 	}
+	/*-----------------------------------------------------------*/
 
-	pxTemp = pxCurrentTimerList;
-	pxCurrentTimerList = pxOverflowTimerList;
-	pxOverflowTimerList = pxTemp;
-}
+	static void prvCascadeTimerList( List_t * const pxList )
+	{
+	UBaseType_t uxTimersToPlace = listCURRENT_LIST_LENGTH( pxList );
+	Timer_t *pxTimer;
+
+		/* Timers that are not yet due to leave the overflow list are placed
+		back at its end, so only the timers originally in the list are
+		visited. */
+		while( uxTimersToPlace > ( UBaseType_t ) 0U )
+		{
+			pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+			( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+			prvPlaceTimerInWheel( pxTimer );
+			uxTimersToPlace--;
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvGetNextTimerWheelEvent( TickType_t * const pxNextEventTime )
+	{
+	TickType_t xTime = xTimerWheelTime + ( TickType_t ) 1U;
+	BaseType_t xFound = pdFALSE, xEndOfRevolution = pdFALSE;
+
+		/* The first level only holds timers that expire later in the current
+		group, so the first occupied slot after the wheel time gives the next
+		expire time. */
+		while( ( xFound == pdFALSE ) && ( ( xTime & tmrWHEEL_MASK ) != ( TickType_t ) 0U ) )
+		{
+			if( listLIST_IS_EMPTY( &( xTimerWheelLevel0[ xTime & tmrWHEEL_MASK ] ) ) == pdFALSE )
+			{
+				xFound = pdTRUE;
+			}
+			else
+			{
+				xTime++;
+			}
+		}
+
+		/* Otherwise the wheel must next be turned at the start of the first
+		later group that has timers in the second level, or at the start of the
+		next revolution if there are timers in the overflow list. */
+		while( ( xFound == pdFALSE ) && ( xEndOfRevolution == pdFALSE ) )
+		{
+			if( ( ( xTime / tmrWHEEL_SIZE ) & tmrWHEEL_MASK ) == ( TickType_t ) 0U )
+			{
+				if( listLIST_IS_EMPTY( &xTimerWheelOverflowList ) == pdFALSE )
+				{
+					xFound = pdTRUE;
+				}
+				else
+				{
+					xEndOfRevolution = pdTRUE;
+				}
+			}
+			else if( listLIST_IS_EMPTY( &( xTimerWheelLevel1[ ( xTime / tmrWHEEL_SIZE ) & tmrWHEEL_MASK ] ) ) == pdFALSE )
+			{
+				xFound = pdTRUE;
+			}
+			else
+			{
+				xTime += tmrWHEEL_SIZE;
+			}
+		}
+
+		*pxNextEventTime = xTime;
+
+		return xFound;
+	}
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static void prvCheckForValidListAndQueue( void )
@@ -890,10 +1222,27 @@ static void prvCheckForValidListAndQueue( void )
 	{
 		if( xTimerQueue == NULL )
 		{
-			vListInitialise( &xActiveTimerList1 );
-			vListInitialise( &xActiveTimerList2 );
-			pxCurrentTimerList = &xActiveTimerList1;
-			pxOverflowTimerList = &xActiveTimerList2;
+			#if( configUSE_TIMER_WHEEL == 0 )
+			{
+				vListInitialise( &xActiveTimerList1 );
+				vListInitialise( &xActiveTimerList2 );
+				pxCurrentTimerList = &xActiveTimerList1;
+				pxOverflowTimerList = &xActiveTimerList2;
+			}
+			#else
+			{
+			UBaseType_t uxSlot;
+
+				for( uxSlot = ( UBaseType_t ) 0U; uxSlot < ( UBaseType_t ) configTIMER_WHEEL_SIZE; uxSlot++ )
+				{
+					vListInitialise( &( xTimerWheelLevel0[ uxSlot ] ) );
+					vListInitialise( &( xTimerWheelLevel1[ uxSlot ] ) );
+				}
+
+				vListInitialise( &xTimerWheelOverflowList );
+				xTimerWheelTime = xTaskGetTickCount();
+			}
+			#endif /* configUSE_TIMER_WHEEL */
 
 			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 			{